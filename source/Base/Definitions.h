@@ -47,6 +47,16 @@ inline int toInt(T const& value)
         throw std::runtime_error("check failed"); \
     }
 
+//functions with loops that are vectorized by the compiler are compiled for several instruction sets if supported
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(_WIN32)
+#define VECTORIZED_FUNCTION __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define VECTORIZED_FUNCTION
+#endif
+
+//marks output arrays of vectorized functions which do not overlap with other arrays, otherwise the compiler may give up on the runtime overlap checks
+#define RESTRICT __restrict
+
 #define MEMBER_DECLARATION(className, type, name, initialValue) \
     type _##name = initialValue; \
     className& name(type const& name) \
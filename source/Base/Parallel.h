@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+
+class Parallel
+{
+public:
+    static int getNumThreads() { return std::max(1, static_cast<int>(std::thread::hardware_concurrency())); }
+
+    //calls func(chunkIndex, startIndex, endIndex) for disjoint index ranges covering [0, numElements), one chunk per thread
+    template <typename Func>
+    static void forEachChunk(int numElements, Func const& func, int minChunkSize = 1);
+
+    //returns the number of chunks forEachChunk will use for the given arguments
+    static int getNumChunks(int numElements, int minChunkSize = 1)
+    {
+        if (numElements <= 0) {
+            return 0;
+        }
+        return std::max(1, std::min(getNumThreads(), (numElements + minChunkSize - 1) / minChunkSize));
+    }
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+template <typename Func>
+void Parallel::forEachChunk(int numElements, Func const& func, int minChunkSize)
+{
+    auto numChunks = getNumChunks(numElements, minChunkSize);
+    if (numChunks == 0) {
+        return;
+    }
+    auto getChunkStart = [&](int chunkIndex) { return static_cast<int>(static_cast<int64_t>(numElements) * chunkIndex / numChunks); };
+    if (numChunks == 1) {
+        func(0, 0, numElements);
+        return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(numChunks);
+    std::vector<std::thread> threads;
+    threads.reserve(numChunks - 1);
+    for (int chunkIndex = 1; chunkIndex < numChunks; ++chunkIndex) {
+        threads.emplace_back([&, chunkIndex] {
+            try {
+                func(chunkIndex, getChunkStart(chunkIndex), getChunkStart(chunkIndex + 1));
+            } catch (...) {
+                exceptions[chunkIndex] = std::current_exception();
+            }
+        });
+    }
+    try {
+        func(0, 0, getChunkStart(1));
+    } catch (...) {
+        exceptions[0] = std::current_exception();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+//SplitMix64 generator for reproducible random numbers on the host
+class SplitMix64
+{
+public:
+    //advances the state and returns the next value of the sequence
+    static uint64_t next(uint64_t& state)
+    {
+        auto result = (state += 0x9e3779b97f4a7c15ull);
+        result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ull;
+        result = (result ^ (result >> 27)) * 0x94d049bb133111ebull;
+        return result ^ (result >> 31);
+    }
+
+    //first value of the sequence starting at value, serves as a hash function
+    static uint64_t hash(uint64_t value) { return next(value); }
+};
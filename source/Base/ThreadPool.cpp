@@ -0,0 +1,135 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(int numThreads)
+{
+    if (numThreads <= 0) {
+        numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        _queues.emplace_back(std::make_unique<Queue>());
+    }
+    for (int threadIndex = 1; threadIndex < numThreads; ++threadIndex) {
+        _workers.emplace_back([this, threadIndex] { runWorker(threadIndex); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(_wakeMutex);
+        _shutdown = true;
+    }
+    _wakeCondition.notify_all();
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::execute(int numElements, RangeFunc const& func, int grainSize)
+{
+    grainSize = std::max(1, grainSize);
+    auto numRanges = (numElements + grainSize - 1) / grainSize;
+    auto numThreads = getNumThreads();
+    if (numRanges == 1 || numThreads == 1) {
+        for (int startIndex = 0; startIndex < numElements; startIndex += grainSize) {
+            func(0, startIndex, std::min(startIndex + grainSize, numElements));
+        }
+        return;
+    }
+
+    std::lock_guard jobLock(_jobMutex);
+    _job = &func;
+    _exception = nullptr;
+    _numRemainingRanges = numRanges;
+
+    //contiguous blocks of ranges per thread for cache locality, stealing balances uneven workloads
+    for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+        auto startRange = static_cast<int>(static_cast<int64_t>(numRanges) * threadIndex / numThreads);
+        auto endRange = static_cast<int>(static_cast<int64_t>(numRanges) * (threadIndex + 1) / numThreads);
+        auto& queue = *_queues.at(threadIndex);
+        std::lock_guard queueLock(queue.mutex);
+        for (int rangeIndex = startRange; rangeIndex < endRange; ++rangeIndex) {
+            auto startIndex = rangeIndex * grainSize;
+            queue.ranges.emplace_back(Range{startIndex, std::min(startIndex + grainSize, numElements)});
+        }
+    }
+    {
+        std::lock_guard lock(_wakeMutex);
+        ++_generation;
+    }
+    _wakeCondition.notify_all();
+
+    processRanges(0);
+    {
+        std::unique_lock lock(_doneMutex);
+        _doneCondition.wait(lock, [this] { return _numRemainingRanges.load() == 0; });
+    }
+    _job = nullptr;
+
+    if (_exception) {
+        std::rethrow_exception(_exception);
+    }
+}
+
+void ThreadPool::runWorker(int threadIndex)
+{
+    uint64_t processedGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock lock(_wakeMutex);
+            _wakeCondition.wait(lock, [&] { return _shutdown || _generation != processedGeneration; });
+            if (_shutdown) {
+                return;
+            }
+            processedGeneration = _generation;
+        }
+        processRanges(threadIndex);
+    }
+}
+
+void ThreadPool::processRanges(int threadIndex)
+{
+    Range range;
+    while (tryPopRange(threadIndex, range)) {
+
+        //_job is published before the ranges are queued, popping a range under the queue lock makes it visible
+        try {
+            (*_job)(threadIndex, range.startIndex, range.endIndex);
+        } catch (...) {
+            std::lock_guard lock(_exceptionMutex);
+            if (!_exception) {
+                _exception = std::current_exception();
+            }
+        }
+        if (--_numRemainingRanges == 0) {
+            std::lock_guard lock(_doneMutex);
+            _doneCondition.notify_all();
+        }
+    }
+}
+
+bool ThreadPool::tryPopRange(int threadIndex, Range& range)
+{
+    {
+        auto& ownQueue = *_queues.at(threadIndex);
+        std::lock_guard lock(ownQueue.mutex);
+        if (!ownQueue.ranges.empty()) {
+            range = ownQueue.ranges.front();
+            ownQueue.ranges.pop_front();
+            return true;
+        }
+    }
+    auto numThreads = getNumThreads();
+    for (int offset = 1; offset < numThreads; ++offset) {
+        auto& otherQueue = *_queues.at((threadIndex + offset) % numThreads);
+        std::lock_guard lock(otherQueue.mutex);
+        if (!otherQueue.ranges.empty()) {
+            range = otherQueue.ranges.back();
+            otherQueue.ranges.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
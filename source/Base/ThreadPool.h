@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//persistent worker threads for parallel loops with work stealing:
+//the index range of a loop is cut into ranges of grainSize elements, which are distributed in contiguous blocks to per-thread queues
+//each thread processes its own queue from the front and steals from the back of the other queues when it runs dry
+//the calling thread participates as thread 0, concurrent calls from different threads are serialized
+class ThreadPool
+{
+public:
+    ThreadPool(int numThreads = 0);  //0 = number of hardware threads
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    void operator=(ThreadPool const&) = delete;
+
+    int getNumThreads() const { return static_cast<int>(_queues.size()); }
+
+    //calls func(threadIndex, startIndex, endIndex) for disjoint ranges covering [0, numElements)
+    //threadIndex is in [0, getNumThreads()) and can be used to address per-thread buffers
+    //exceptions thrown by func are rethrown in the calling thread (the first one if there are several)
+    template <typename Func>
+    void forEachRange(int numElements, Func const& func, int grainSize = 256);
+
+private:
+    using RangeFunc = std::function<void(int, int, int)>;
+
+    struct Range
+    {
+        int startIndex;
+        int endIndex;
+    };
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+    };
+
+    void execute(int numElements, RangeFunc const& func, int grainSize);
+    void runWorker(int threadIndex);
+    void processRanges(int threadIndex);
+    bool tryPopRange(int threadIndex, Range& range);
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::vector<std::thread> _workers;
+
+    std::mutex _jobMutex;
+    RangeFunc const* _job = nullptr;
+    std::atomic<int> _numRemainingRanges{0};
+    std::mutex _exceptionMutex;
+    std::exception_ptr _exception;
+
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+    uint64_t _generation = 0;
+    bool _shutdown = false;
+
+    std::mutex _doneMutex;
+    std::condition_variable _doneCondition;
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+template <typename Func>
+void ThreadPool::forEachRange(int numElements, Func const& func, int grainSize)
+{
+    if (numElements <= 0) {
+        return;
+    }
+    execute(numElements, [&func](int threadIndex, int startIndex, int endIndex) { func(threadIndex, startIndex, endIndex); }, grainSize);
+}
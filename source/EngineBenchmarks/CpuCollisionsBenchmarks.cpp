@@ -0,0 +1,87 @@
+#include <cmath>
+#include <random>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineCpuKernels/CpuCellProcessor.h"
+
+namespace
+{
+    auto constexpr CellsPerUnitSquare = 0.5f;
+
+    //state.range(0): number of cells, state.range(1): number of threads
+    std::shared_ptr<CpuSimulationData> createCollisionData(benchmark::State const& state)
+    {
+        auto numCells = toInt(state.range(0));
+        auto worldSize = toInt(std::sqrt(toFloat(numCells) / CellsPerUnitSquare));
+        auto result = std::make_shared<CpuSimulationData>(int2{worldSize, worldSize}, 0, toInt(state.range(1)));
+        result->parameters.motionType = MotionType_Collision;
+        result->parameters.motionData.collisionMotion = CollisionMotion();
+
+        std::mt19937 randomEngine(numCells);
+        std::uniform_real_distribution<float> posDistribution(0, toFloat(worldSize));
+        std::uniform_real_distribution<float> velDistribution(-0.1f, 0.1f);
+        result->cells.reserve(numCells);
+        for (int i = 0; i < numCells; ++i) {
+            CellTO cell{};
+            cell.id = i + 1;
+            cell.pos = {posDistribution(randomEngine), posDistribution(randomEngine)};
+            cell.vel = {velDistribution(randomEngine), velDistribution(randomEngine)};
+            cell.energy = 100;
+            cell.maxConnections = 6;
+            result->addCell(cell);
+        }
+        return result;
+    }
+
+    void applyNumCellsAndThreads(benchmark::internal::Benchmark* benchmark)
+    {
+        auto maxThreads = std::max(1, toInt(std::thread::hardware_concurrency()));
+        for (auto numCells : {100000, 1000000, 10000000}) {
+            for (int numThreads = 1; numThreads < maxThreads; numThreads *= 2) {
+                benchmark->Args({numCells, numThreads});
+            }
+            benchmark->Args({numCells, maxThreads});
+        }
+    }
+}
+
+//collisions of a time step where the neighbor lists are mostly reused
+static void BM_CpuCollisions(benchmark::State& state)
+{
+    auto data = createCollisionData(state);
+    data->prepareForNextTimestep();
+    CpuCellProcessor::updateMap(*data);
+    CpuCellProcessor::collisions(*data);
+    for (auto _ : state) {
+        state.PauseTiming();
+        data->prepareForNextTimestep();
+        CpuCellProcessor::updateMap(*data);
+        state.ResumeTiming();
+
+        CpuCellProcessor::collisions(*data);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data->getNumCells());
+    state.counters["rebuilds"] = toFloat(data->cellNeighbors.getNumRebuilds());
+}
+BENCHMARK(BM_CpuCollisions)->Apply(applyNumCellsAndThreads)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+//collisions with a rebuild of the neighbor lists in each time step
+static void BM_CpuCollisionsWithRebuild(benchmark::State& state)
+{
+    auto data = createCollisionData(state);
+    for (auto _ : state) {
+        state.PauseTiming();
+        data->prepareForNextTimestep();
+        CpuCellProcessor::updateMap(*data);
+        data->cellNeighbors.invalidate();
+        state.ResumeTiming();
+
+        CpuCellProcessor::collisions(*data);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data->getNumCells());
+}
+BENCHMARK(BM_CpuCollisionsWithRebuild)->Apply(applyNumCellsAndThreads)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,193 @@
+#include <cmath>
+#include <random>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineCpuKernels/CpuCellProcessor.h"
+
+namespace
+{
+    //state.range(0): number of cells, state.range(1): number of threads
+    //connected square lattice on the whole torus with horizontal, vertical and some diagonal connections
+    std::shared_ptr<CpuSimulationData> createLatticeData(benchmark::State const& state)
+    {
+        auto numCells = toInt(state.range(0));
+        auto latticeSize = toInt(std::sqrt(toFloat(numCells)));
+        auto result = std::make_shared<CpuSimulationData>(int2{latticeSize, latticeSize}, 0, toInt(state.range(1)));
+
+        std::mt19937 randomEngine(numCells);
+        std::uniform_real_distribution<float> posDistribution(-0.1f, 0.1f);
+        std::uniform_int_distribution<int> flagDistribution(0, 9);
+        result->cells.reserve(latticeSize * latticeSize);
+        for (int y = 0; y < latticeSize; ++y) {
+            for (int x = 0; x < latticeSize; ++x) {
+                CellTO cell{};
+                cell.id = y * latticeSize + x + 1;
+                cell.pos = {toFloat(x) + posDistribution(randomEngine), toFloat(y) + posDistribution(randomEngine)};
+                result->cellMap.correctPosition(cell.pos);
+                cell.energy = 100;
+                cell.stiffness = 1.0f;
+                cell.maxConnections = MAX_CELL_BONDS;
+                result->addCell(cell);
+            }
+        }
+        auto connect = [&](int index1, int index2, float distance) {
+            auto& cell1 = result->cells[index1];
+            auto& cell2 = result->cells[index2];
+            cell1.connections[cell1.numConnections++] = {index2, distance, 90.0f};
+            cell2.connections[cell2.numConnections++] = {index1, distance, 90.0f};
+        };
+        auto toIndex = [&](int x, int y) { return (y % latticeSize) * latticeSize + x % latticeSize; };
+        for (int y = 0; y < latticeSize; ++y) {
+            for (int x = 0; x < latticeSize; ++x) {
+                connect(toIndex(x, y), toIndex(x + 1, y), 1.0f);
+                connect(toIndex(x, y), toIndex(x, y + 1), 1.0f);
+                if (flagDistribution(randomEngine) == 0) {
+                    connect(toIndex(x, y), toIndex(x + 1, y + 1), 1.4f);
+                }
+            }
+        }
+        return result;
+    }
+
+    void applyNumCellsAndThreads(benchmark::internal::Benchmark* benchmark)
+    {
+        auto maxThreads = std::max(1, toInt(std::thread::hardware_concurrency()));
+        for (auto numCells : {100000, 1000000}) {
+            for (int numThreads = 1; numThreads < maxThreads; numThreads *= 2) {
+                benchmark->Args({numCells, numThreads});
+            }
+            benchmark->Args({numCells, maxThreads});
+        }
+    }
+
+    //previous per-cell implementation visiting the connections of each cell and collecting the angle forces from per-connection slots
+    void calcConnectionForcesPerCell(CpuSimulationData& data, std::vector<float2>& connectionForces)
+    {
+        auto isConnectedTo = [](CellTO const& cell, int otherIndex) {
+            for (int i = 0; i < cell.numConnections; ++i) {
+                if (cell.connections[i].cellIndex == otherIndex) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        data.forEachCell([&](int index) {
+            auto slots = &connectionForces[index * MAX_CELL_BONDS];
+            for (int i = 0; i < MAX_CELL_BONDS; ++i) {
+                slots[i] = {0, 0};
+            }
+            auto const& cell = data.cells[index];
+            if (0 == cell.numConnections || cell.barrier) {
+                return;
+            }
+            float2 force{0, 0};
+            auto prevDisplacement = data.cellMap.getCorrectedDirection(data.cells[cell.connections[cell.numConnections - 1].cellIndex].pos - cell.pos);
+            auto cellStiffnessSquared = cell.stiffness * cell.stiffness;
+            auto numConnections = cell.numConnections;
+            for (int i = 0; i < numConnections; ++i) {
+                auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+                auto displacement = data.cellMap.getCorrectedDirection(connectedCell.pos - cell.pos);
+                auto deviation = CpuMath::length(displacement) - cell.connections[i].distance;
+                force += CpuMath::normalized(displacement) * deviation * (cellStiffnessSquared + connectedCell.stiffness * connectedCell.stiffness) / 6;
+
+                auto lastIndex = (i + numConnections - 1) % numConnections;
+                if ((numConnections > 2 || (numConnections == 2 && i == 0)) && !isConnectedTo(connectedCell, cell.connections[lastIndex].cellIndex)) {
+                    auto actualAngleFromPrevious =
+                        CpuMath::subtractAngle(CpuMath::angleOfVector(displacement), CpuMath::angleOfVector(prevDisplacement));
+                    auto referenceAngleFromPrevious = cell.connections[i].angleFromPrevious;
+                    auto strength = std::abs(referenceAngleFromPrevious - actualAngleFromPrevious) / 2000 * cellStiffnessSquared;
+                    auto force1 = CpuMath::rotateQuarterClockwise(
+                        CpuMath::normalized(displacement) / std::max(CpuMath::length(displacement), data.parameters.cellMinDistance) * strength);
+                    auto force2 = CpuMath::rotateQuarterCounterClockwise(
+                        CpuMath::normalized(prevDisplacement) / std::max(CpuMath::length(prevDisplacement), data.parameters.cellMinDistance) * strength);
+                    if (referenceAngleFromPrevious < actualAngleFromPrevious) {
+                        force1 = force1 * (-1);
+                        force2 = force2 * (-1);
+                    }
+                    slots[i] += force1;
+                    slots[lastIndex] += force2;
+                    force -= force1 + force2;
+                }
+                prevDisplacement = displacement;
+            }
+            data.cellForces[index] += force;
+        });
+
+        data.forEachCell([&](int index) {
+            auto const& cell = data.cells[index];
+            if (cell.barrier) {
+                return;
+            }
+            float2 force{0, 0};
+            for (int i = 0; i < cell.numConnections; ++i) {
+                auto connectedCellIndex = cell.connections[i].cellIndex;
+                auto const& connectedCell = data.cells[connectedCellIndex];
+                for (int j = 0; j < connectedCell.numConnections; ++j) {
+                    if (connectedCell.connections[j].cellIndex == index) {
+                        force += connectionForces[connectedCellIndex * MAX_CELL_BONDS + j];
+                        break;
+                    }
+                }
+            }
+            data.cellForces[index] += force;
+        });
+    }
+}
+
+//first connection force calculation of a time step including the packing, warmed up such that the buffers are allocated
+static void BM_CpuConnectionForces(benchmark::State& state)
+{
+    auto data = createLatticeData(state);
+    data->prepareForNextTimestep();
+    CpuCellProcessor::calcConnectionForces(*data, true);
+    for (auto _ : state) {
+        state.PauseTiming();
+        data->prepareForNextTimestep();
+        state.ResumeTiming();
+
+        CpuCellProcessor::calcConnectionForces(*data, true);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data->getNumCells());
+}
+BENCHMARK(BM_CpuConnectionForces)->Apply(applyNumCellsAndThreads)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_CpuConnectionForcesPerCell(benchmark::State& state)
+{
+    auto data = createLatticeData(state);
+    std::vector<float2> connectionForces(data->getNumCells() * MAX_CELL_BONDS);
+    for (auto _ : state) {
+        state.PauseTiming();
+        data->prepareForNextTimestep();
+        state.ResumeTiming();
+
+        calcConnectionForcesPerCell(*data, connectionForces);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data->getNumCells());
+}
+BENCHMARK(BM_CpuConnectionForcesPerCell)->Apply(applyNumCellsAndThreads)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+//both force calculations and the verlet integration of a time step where the packed data is reused after the first calculation
+static void BM_CpuConnectionForcesAndIntegration(benchmark::State& state)
+{
+    auto data = createLatticeData(state);
+    data->prepareForNextTimestep();
+    CpuCellProcessor::calcConnectionForces(*data, true);
+    for (auto _ : state) {
+        state.PauseTiming();
+        data->prepareForNextTimestep();
+        state.ResumeTiming();
+
+        CpuCellProcessor::calcConnectionForces(*data, true);
+        CpuCellProcessor::verletPositionUpdate(*data);
+        CpuCellProcessor::calcConnectionForces(*data, true);
+        CpuCellProcessor::verletVelocityUpdate(*data);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data->getNumCells());
+}
+BENCHMARK(BM_CpuConnectionForcesAndIntegration)->Apply(applyNumCellsAndThreads)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,61 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineCpuKernels/CpuCellProcessor.h"
+
+namespace
+{
+    auto constexpr WorldSize = 256;
+
+    //state.range(0): cells per 1000 unit squares, state.range(1): smoothing length in percent, state.range(2): number of threads
+    std::shared_ptr<CpuSimulationData> createFluidData(benchmark::State const& state)
+    {
+        auto result = std::make_shared<CpuSimulationData>(int2{WorldSize, WorldSize}, 0, toInt(state.range(2)));
+        result->parameters.motionType = MotionType_Fluid;
+        result->parameters.motionData.fluidMotion = FluidMotion();
+        result->parameters.motionData.fluidMotion.smoothingLength = toFloat(state.range(1)) / 100;
+
+        auto numCells = toInt(state.range(0) * WorldSize * WorldSize / 1000);
+        std::mt19937 randomEngine(numCells);
+        std::uniform_real_distribution<float> posDistribution(0, toFloat(WorldSize));
+        std::uniform_real_distribution<float> velDistribution(-0.1f, 0.1f);
+        for (int i = 0; i < numCells; ++i) {
+            CellTO cell{};
+            cell.id = i + 1;
+            cell.pos = {posDistribution(randomEngine), posDistribution(randomEngine)};
+            cell.vel = {velDistribution(randomEngine), velDistribution(randomEngine)};
+            cell.energy = 100;
+            cell.maxConnections = 6;
+            result->addCell(cell);
+        }
+        return result;
+    }
+
+    void applyDensitiesAndSmoothingLengths(benchmark::internal::Benchmark* benchmark)
+    {
+        for (auto density : {200, 1000, 2000}) {
+            for (auto smoothingLength : {50, 80, 150}) {
+                benchmark->Args({density, smoothingLength, 1});
+            }
+        }
+        benchmark->Args({1000, 80, 4});
+    }
+}
+
+static void BM_CpuFluidForces(benchmark::State& state)
+{
+    auto data = createFluidData(state);
+    for (auto _ : state) {
+        state.PauseTiming();
+        data->prepareForNextTimestep();
+        CpuCellProcessor::updateMap(*data);
+        state.ResumeTiming();
+
+        CpuCellProcessor::fluidForces(*data);
+        data->structuralOperations.clear();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data->getNumCells());
+}
+BENCHMARK(BM_CpuFluidForces)->Apply(applyDensitiesAndSmoothingLengths)->UseRealTime();
@@ -0,0 +1,101 @@
+#include <cmath>
+#include <random>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineCpuKernels/CpuGarbageCollector.h"
+#include "EngineCpuKernels/CpuSimulationKernels.h"
+
+namespace
+{
+    auto constexpr CellsPerUnitSquare = 0.5f;
+
+    //cells and particles are created in random spatial order as after a long simulation without reordering
+    //state.range(0): number of cells, state.range(1): number of threads, state.range(2): spatial order interval
+    std::shared_ptr<CpuSimulationData> createRandomOrderData(benchmark::State const& state)
+    {
+        auto numCells = toInt(state.range(0));
+        auto worldSize = toInt(std::sqrt(toFloat(numCells) / CellsPerUnitSquare));
+        auto result = std::make_shared<CpuSimulationData>(int2{worldSize, worldSize}, 0, toInt(state.range(1)));
+        result->parameters.motionType = MotionType_Collision;
+        result->parameters.motionData.collisionMotion = CollisionMotion();
+        result->spatialOrderInterval = toInt(state.range(2));
+
+        std::mt19937 randomEngine(numCells);
+        std::uniform_real_distribution<float> posDistribution(0, toFloat(worldSize));
+        std::uniform_real_distribution<float> velDistribution(-0.1f, 0.1f);
+        for (int i = 0; i < numCells; ++i) {
+            CellTO cell{};
+            cell.id = i + 1;
+            cell.pos = {posDistribution(randomEngine), posDistribution(randomEngine)};
+            cell.vel = {velDistribution(randomEngine), velDistribution(randomEngine)};
+            cell.energy = 100;
+            cell.maxConnections = 6;
+            cell.cellFunction = CellFunction_None;
+            result->addCell(cell);
+        }
+        for (int i = 0; i < numCells / 10; ++i) {
+            ParticleTO particle{};
+            particle.id = numCells + i + 1;
+            particle.pos = {posDistribution(randomEngine), posDistribution(randomEngine)};
+            particle.vel = {velDistribution(randomEngine), velDistribution(randomEngine)};
+            particle.energy = 1;
+            result->addParticle(particle);
+        }
+        return result;
+    }
+
+    void applyNumCellsThreadsAndIntervals(benchmark::internal::Benchmark* benchmark)
+    {
+        auto maxThreads = std::max(1, toInt(std::thread::hardware_concurrency()));
+        for (auto numCells : {100000, 1000000}) {
+            for (auto numThreads : {1, maxThreads}) {
+                for (auto interval : {0, 50}) {
+                    benchmark->Args({numCells, numThreads, interval});
+                }
+            }
+        }
+    }
+}
+
+//whole time steps with (interval > 0) and without (interval = 0) periodic reordering of the objects
+static void BM_CpuTimestepWithSpatialOrder(benchmark::State& state)
+{
+    auto data = createRandomOrderData(state);
+    CpuSimulationStatistics statistics;
+    CpuSimulationKernels::calcTimestep(*data, statistics);
+    ++data->timestep;
+
+    int numReorderings = 0;
+    for (auto _ : state) {
+        numReorderings += CpuGarbageCollector::isSpatialOrderScheduled(*data) ? 1 : 0;
+        CpuSimulationKernels::calcTimestep(*data, statistics);
+        ++data->timestep;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data->getNumCells());
+    state.counters["reorderings"] = toFloat(numReorderings);
+}
+BENCHMARK(BM_CpuTimestepWithSpatialOrder)->Apply(applyNumCellsThreadsAndIntervals)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+//costs of a single reordering of randomly ordered objects
+static void BM_CpuSpatialOrder(benchmark::State& state)
+{
+    std::shared_ptr<CpuSimulationData> data;
+    for (auto _ : state) {
+        state.PauseTiming();
+        data = createRandomOrderData(state);
+        data->spatialOrderInterval = 1;
+        state.ResumeTiming();
+
+        CpuGarbageCollector::cleanupAfterTimestep(*data);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CpuSpatialOrder)
+    ->Args({1000000, 1, 0})
+    ->Args({1000000, std::max(1, toInt(std::thread::hardware_concurrency())), 0})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
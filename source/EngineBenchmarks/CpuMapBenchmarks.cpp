@@ -0,0 +1,101 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineCpuKernels/CpuMap.h"
+
+namespace
+{
+    auto constexpr WorldSize = 1024;
+
+    //state.range(0): cells per 1000 unit squares, state.range(1): bucket size
+    struct CellMapFixture
+    {
+        CellMapFixture(benchmark::State const& state)
+        {
+            auto numCells = toInt(state.range(0) * WorldSize * WorldSize / 1000);
+            std::mt19937 randomEngine(numCells);
+            std::uniform_real_distribution<float> distribution(0, toFloat(WorldSize));
+            cells.resize(numCells);
+            for (auto& cell : cells) {
+                cell.pos = {distribution(randomEngine), distribution(randomEngine)};
+            }
+            cellDetached.assign(numCells, 0);
+            cellRemoved.assign(numCells, 0);
+            map.init({WorldSize, WorldSize}, toInt(state.range(1)));
+        }
+
+        std::vector<CellTO> cells;
+        std::vector<uint8_t> cellDetached;
+        std::vector<uint8_t> cellRemoved;
+        CpuCellMap map;
+    };
+
+    void applyDensitiesAndBucketSizes(benchmark::internal::Benchmark* benchmark)
+    {
+        for (auto density : {50, 200, 1000}) {
+            for (auto bucketSize : {1, 2, 4}) {
+                benchmark->Args({density, bucketSize});
+            }
+        }
+    }
+}
+
+static void BM_CellMapUpdate(benchmark::State& state)
+{
+    CellMapFixture fixture(state);
+    for (auto _ : state) {
+        fixture.map.update(fixture.cells, fixture.cellDetached, fixture.cellRemoved);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * fixture.cells.size());
+}
+BENCHMARK(BM_CellMapUpdate)->Apply(applyDensitiesAndBucketSizes);
+
+//neighborhood query with the collision distance of CollisionMotion for each cell
+static void BM_CellMapNeighborhoodQuery(benchmark::State& state)
+{
+    CellMapFixture fixture(state);
+    fixture.map.update(fixture.cells, fixture.cellDetached, fixture.cellRemoved);
+    for (auto _ : state) {
+        int numNeighbors = 0;
+        for (auto const& cell : fixture.cells) {
+            fixture.map.executeForEach(cell.pos, 1.3f, 0, [&](int) { ++numNeighbors; });
+        }
+        benchmark::DoNotOptimize(numNeighbors);
+    }
+    state.SetItemsProcessed(state.iterations() * fixture.cells.size());
+}
+BENCHMARK(BM_CellMapNeighborhoodQuery)->Apply(applyDensitiesAndBucketSizes);
+
+//larger radius as used by the editor for the selection of cells within a brush
+static void BM_CellMapLargeRadiusQuery(benchmark::State& state)
+{
+    CellMapFixture fixture(state);
+    fixture.map.update(fixture.cells, fixture.cellDetached, fixture.cellRemoved);
+    int numQueries = 1000;
+    for (auto _ : state) {
+        int numNeighbors = 0;
+        for (int i = 0; i < numQueries; ++i) {
+            fixture.map.executeForEach(fixture.cells[i].pos, 20.0f, 0, [&](int) { ++numNeighbors; });
+        }
+        benchmark::DoNotOptimize(numNeighbors);
+    }
+    state.SetItemsProcessed(state.iterations() * numQueries);
+}
+BENCHMARK(BM_CellMapLargeRadiusQuery)->Apply(applyDensitiesAndBucketSizes);
+
+static void BM_CellMapGetFirst(benchmark::State& state)
+{
+    CellMapFixture fixture(state);
+    fixture.map.update(fixture.cells, fixture.cellDetached, fixture.cellRemoved);
+    for (auto _ : state) {
+        int numFound = 0;
+        for (auto const& cell : fixture.cells) {
+            numFound += fixture.map.getFirst(cell.pos + float2{0.5f, 0.5f}) != -1 ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(numFound);
+    }
+    state.SetItemsProcessed(state.iterations() * fixture.cells.size());
+}
+BENCHMARK(BM_CellMapGetFirst)->Apply(applyDensitiesAndBucketSizes);
@@ -0,0 +1,131 @@
+#include <random>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineCpuKernels/CpuCellFunctionProcessor.h"
+#include "EngineCpuKernels/CpuCellProcessor.h"
+
+namespace
+{
+    auto constexpr WorldSize = 1024;
+    auto constexpr NumCells = 200000;
+
+    //state.range(0): number of sensors, state.range(1): sensor mode, state.range(2): number of threads
+    //the sensors search a color which only occurs in a few clusters such that most of the scans run over empty regions
+    std::shared_ptr<CpuSimulationData> createSensorData(benchmark::State const& state)
+    {
+        auto numSensors = toInt(state.range(0));
+        auto result = std::make_shared<CpuSimulationData>(int2{WorldSize, WorldSize}, 0, toInt(state.range(2)));
+
+        std::mt19937 randomEngine(numSensors);
+        std::uniform_real_distribution<float> posDistribution(0, toFloat(WorldSize));
+        std::uniform_real_distribution<float> realDistribution(0, 1.0f);
+        std::normal_distribution<float> clusterDistribution(0, 10.0f);
+        std::vector<float2> clusterCenters;
+        for (int i = 0; i < 10; ++i) {
+            clusterCenters.emplace_back(float2{posDistribution(randomEngine), posDistribution(randomEngine)});
+        }
+        for (int i = 0; i < NumCells; ++i) {
+            CellTO cell{};
+            cell.id = i + 1;
+            cell.energy = 100;
+            cell.livingState = LivingState_Ready;
+            cell.cellFunction = CellFunction_None;
+            if (i % 20 == 0) {
+                cell.color = 1;
+                cell.pos = clusterCenters[i % clusterCenters.size()] + float2{clusterDistribution(randomEngine), clusterDistribution(randomEngine)};
+            } else {
+                cell.pos = {posDistribution(randomEngine), posDistribution(randomEngine)};
+            }
+            result->addCell(cell);
+        }
+
+        std::vector<int> sensorIndices;
+        for (int i = 0; i < numSensors; ++i) {
+            CellTO inputCell{};
+            inputCell.pos = {posDistribution(randomEngine), posDistribution(randomEngine)};
+            inputCell.livingState = LivingState_Ready;
+            inputCell.inputExecutionOrderNumber = -1;
+            inputCell.cellFunction = CellFunction_None;
+            inputCell.activity.channels[0] = 1.0f;
+            auto inputIndex = result->addCell(inputCell);
+
+            auto sensorCell = inputCell;
+            sensorCell.pos = inputCell.pos + CpuMath::unitVectorOfAngle(realDistribution(randomEngine) * 360.0f);
+            sensorCell.executionOrderNumber = 1;
+            sensorCell.inputExecutionOrderNumber = 0;
+            sensorCell.cellFunction = CellFunction_Sensor;
+            sensorCell.cellFunctionData.sensor.mode = static_cast<SensorMode>(state.range(1));
+            sensorCell.cellFunctionData.sensor.angle = realDistribution(randomEngine) * 360.0f;
+            sensorCell.cellFunctionData.sensor.minDensity = 0.05f;
+            sensorCell.cellFunctionData.sensor.color = 1;
+            sensorCell.connections[sensorCell.numConnections++] = ConnectionTO{inputIndex, 1.0f, 0};
+            sensorIndices.emplace_back(result->addCell(sensorCell));
+        }
+
+        result->prepareForNextTimestep();
+        result->cellFunctionOperations[CellFunction_Sensor] = sensorIndices;
+        CpuCellProcessor::updateMap(*result);
+        CpuCellProcessor::fillDensityMap(*result);
+        return result;
+    }
+
+    void applyNumSensorsModesAndThreads(benchmark::internal::Benchmark* benchmark)
+    {
+        auto maxThreads = std::max(1, toInt(std::thread::hardware_concurrency()));
+        for (auto numSensors : {1000, 10000}) {
+            for (auto mode : {SensorMode_Neighborhood, SensorMode_FixedAngle}) {
+                benchmark->Args({numSensors, mode, 1});
+                if (maxThreads > 1) {
+                    benchmark->Args({numSensors, mode, maxThreads});
+                }
+            }
+        }
+    }
+}
+
+static void BM_CpuSensors(benchmark::State& state)
+{
+    auto data = createSensorData(state);
+    CpuSimulationStatistics statistics;
+    for (auto _ : state) {
+        CpuCellFunctionProcessor::processSensors(*data, statistics);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CpuSensors)->Apply(applyNumSensorsModesAndThreads)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_CpuFillDensityMap(benchmark::State& state)
+{
+    auto data = createSensorData(state);
+    for (auto _ : state) {
+        CpuCellProcessor::fillDensityMap(*data);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * data->getNumCells());
+}
+BENCHMARK(BM_CpuFillDensityMap)->Args({0, 0, 1})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_CpuFindNearestNonEmptyRegion(benchmark::State& state)
+{
+    auto data = createSensorData(state);
+    std::mt19937 randomEngine(0);
+    std::uniform_real_distribution<float> posDistribution(0, toFloat(WorldSize));
+    std::vector<float2> positions;
+    for (int i = 0; i < 10000; ++i) {
+        positions.emplace_back(float2{posDistribution(randomEngine), posDistribution(randomEngine)});
+    }
+    for (auto _ : state) {
+        int numFound = 0;
+        for (auto const& pos : positions) {
+            float2 regionStart;
+            float2 regionEnd;
+            numFound += data->densityMap.findNearestNonEmptyRegion(pos, 1, toFloat(WorldSize), regionStart, regionEnd) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(numFound);
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+BENCHMARK(BM_CpuFindNearestNonEmptyRegion)->Args({0, 0, 1})->UseRealTime()->Unit(benchmark::kMillisecond);
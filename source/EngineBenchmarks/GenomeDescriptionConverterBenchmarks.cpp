@@ -0,0 +1,66 @@
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineTests/GenomeTestData.h"
+
+static void BM_ConvertDescriptionToBytes(benchmark::State& state)
+{
+    auto genome = GenomeTestData::createGenomeDescription(toInt(state.range(0)));
+    int64_t numBytes = 0;
+    for (auto _ : state) {
+        auto data = GenomeDescriptionConverter::convertDescriptionToBytes(genome);
+        numBytes += toInt(data.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetBytesProcessed(numBytes);
+}
+BENCHMARK(BM_ConvertDescriptionToBytes)->DenseRange(0, 4);
+
+static void BM_ConvertBytesToDescription(benchmark::State& state)
+{
+    auto data = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeTestData::createGenomeDescription(toInt(state.range(0))));
+    for (auto _ : state) {
+        auto genome = GenomeDescriptionConverter::convertBytesToDescription(data);
+        benchmark::DoNotOptimize(genome.cells.data());
+    }
+    state.SetBytesProcessed(state.iterations() * toInt(data.size()));
+}
+BENCHMARK(BM_ConvertBytesToDescription)->DenseRange(0, 4);
+
+//decodes the genome and all its subgenomes as the genome editor does when opening nested genomes
+static void BM_ConvertBytesToDescriptionRecursively(benchmark::State& state)
+{
+    auto data = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeTestData::createGenomeDescription(toInt(state.range(0))));
+    std::function<int(std::vector<uint8_t> const&)> convertRecursively = [&](std::vector<uint8_t> const& genomeData) {
+        auto genome = GenomeDescriptionConverter::convertBytesToDescription(genomeData);
+        auto result = toInt(genome.cells.size());
+        for (auto const& cell : genome.cells) {
+            if (auto subGenome = cell.getGenome()) {
+                result += convertRecursively(*subGenome);
+            }
+        }
+        return result;
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(convertRecursively(data));
+    }
+    state.SetBytesProcessed(state.iterations() * toInt(data.size()));
+}
+BENCHMARK(BM_ConvertBytesToDescriptionRecursively)->DenseRange(0, 4);
+
+//round trip of an edit in the genome editor
+static void BM_GenomeRoundTrip(benchmark::State& state)
+{
+    auto data = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeTestData::createGenomeDescription(toInt(state.range(0))));
+    int frame = 0;
+    for (auto _ : state) {
+        auto genome = GenomeDescriptionConverter::convertBytesToDescription(data);
+        genome.cells.front().color = ++frame % MAX_COLORS;
+        data = GenomeDescriptionConverter::convertDescriptionToBytes(genome);
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetBytesProcessed(state.iterations() * toInt(data.size()));
+}
+BENCHMARK(BM_GenomeRoundTrip)->DenseRange(0, 4);
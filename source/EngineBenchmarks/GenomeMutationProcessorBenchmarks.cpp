@@ -0,0 +1,76 @@
+#include <atomic>
+
+#include <benchmark/benchmark.h>
+
+#include "Base/Parallel.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/GenomeMutationProcessor.h"
+#include "EngineTests/GenomeTestData.h"
+
+namespace
+{
+    auto constexpr NumMutationTypes = static_cast<int>(MutationType::UniformColor) + 1;
+    auto constexpr NumGenomes = 1024;
+
+    SimulationParameters createParameters()
+    {
+        SimulationParameters result;
+        result.cellFunctionConstructorMutationSelfReplication = true;
+        return result;
+    }
+}
+
+static void BM_Mutation(benchmark::State& state)
+{
+    auto type = static_cast<MutationType>(state.range(0));
+    auto parameters = createParameters();
+    auto genome = GenomeTestData::createGenome(3);
+    std::vector<MutatedGenome> population(NumGenomes, MutatedGenome{.genome = genome});
+    GenomeMutationRandomGenerator randomGenerator(1);
+    for (auto _ : state) {
+        for (auto& target : population) {
+            GenomeMutationProcessor::applyMutation(type, randomGenerator, parameters, target);
+        }
+        benchmark::DoNotOptimize(population.data());
+    }
+    state.SetItemsProcessed(state.iterations() * NumGenomes);
+}
+BENCHMARK(BM_Mutation)->DenseRange(0, NumMutationTypes - 1);
+
+//applies state.range(0) random mutations distributed over a population on all threads and validates every state.range(1)-th result
+static void BM_MutationFuzzing(benchmark::State& state)
+{
+    auto numMutationsPerGenome = toInt(state.range(0)) / NumGenomes;
+    auto validationInterval = toInt(state.range(1));
+    auto parameters = createParameters();
+    auto genome = GenomeTestData::createGenome(3);
+
+    std::atomic<int> numInvalidGenomes = 0;
+    uint64_t seed = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<MutatedGenome> population(NumGenomes, MutatedGenome{.genome = genome});
+        seed += NumGenomes;
+        state.ResumeTiming();
+
+        Parallel::forEachChunk(NumGenomes, [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                GenomeMutationRandomGenerator randomGenerator(seed + index);
+                auto& target = population[index];
+                for (int i = 1; i <= numMutationsPerGenome; ++i) {
+                    auto type = static_cast<MutationType>(randomGenerator.random(NumMutationTypes - 1));
+                    GenomeMutationProcessor::applyMutation(type, randomGenerator, parameters, target);
+                    if (validationInterval > 0 && i % validationInterval == 0 && !GenomeTestData::isConsistent(target.genome)) {
+                        ++numInvalidGenomes;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+    if (numInvalidGenomes > 0) {
+        state.SkipWithError("mutation produced an inconsistent genome");
+    }
+    state.SetItemsProcessed(state.iterations() * numMutationsPerGenome * NumGenomes);
+}
+BENCHMARK(BM_MutationFuzzing)->Args({1 << 22, 0})->Args({1 << 20, 16})->Unit(benchmark::kMillisecond)->UseRealTime();
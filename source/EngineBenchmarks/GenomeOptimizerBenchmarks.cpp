@@ -0,0 +1,142 @@
+#include <iostream>
+
+#include <benchmark/benchmark.h>
+
+#include "Base/Parallel.h"
+#include "Base/Resources.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeDecoderBase.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/GenomeMutationProcessor.h"
+#include "EngineInterface/GenomeOptimizer.h"
+#include "EngineInterface/Serializer.h"
+#include "EngineTests/GenomeTestData.h"
+
+namespace
+{
+    auto constexpr NumCreatures = 2048;
+    auto constexpr NumCellsPerCreature = 8;
+    auto constexpr NumMutationsPerCreature = 200;
+    auto constexpr NumMutationTypes = static_cast<int>(MutationType::UniformColor) + 1;
+
+    //synthetic world of creatures whose genomes evolved by random mutations from a common ancestor, all cells of a creature share its genome
+    ClusteredDataDescription createSyntheticWorld()
+    {
+        SimulationParameters parameters;
+        parameters.cellFunctionConstructorMutationSelfReplication = true;
+        auto ancestor = GenomeTestData::createGenome(3);
+
+        std::vector<MutatedGenome> population(NumCreatures, MutatedGenome{.genome = ancestor});
+        Parallel::forEachChunk(NumCreatures, [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                GenomeMutationRandomGenerator randomGenerator(index);
+                for (int i = 0; i < NumMutationsPerCreature; ++i) {
+                    auto type = static_cast<MutationType>(randomGenerator.random(NumMutationTypes - 1));
+                    GenomeMutationProcessor::applyMutation(type, randomGenerator, parameters, population[index]);
+                }
+            }
+        });
+
+        ClusteredDataDescription result;
+        uint64_t id = 0;
+        for (auto const& creature : population) {
+            ClusterDescription cluster;
+            for (int i = 0; i < NumCellsPerCreature; ++i) {
+                cluster.addCell(CellDescription().setId(++id).setCellFunction(ConstructorDescription().setGenome(creature.genome)));
+            }
+            result.addCluster(cluster);
+        }
+        return result;
+    }
+
+    //prefers the autosave of a real evolved simulation (only available in checkouts with git-lfs files and when run from the project directory)
+    //the synthetic world lacks the selection pressure of a simulation and hence the redundancies real genomes accumulate
+    ClusteredDataDescription loadEvolvedWorld()
+    {
+        DeserializedSimulation deserializedData;
+        if (Serializer::deserializeSimulationFromFiles(deserializedData, Const::AutosaveFile)) {
+            return deserializedData.mainData;
+        }
+        std::cerr << "Could not load " << Const::AutosaveFile << ", benchmarking a synthetic world instead." << std::endl;
+        return createSyntheticWorld();
+    }
+
+    ClusteredDataDescription const& getEvolvedWorld()
+    {
+        static auto result = loadEvolvedWorld();
+        return result;
+    }
+
+    int getNumCells(ClusteredDataDescription const& data)
+    {
+        int result = 0;
+        for (auto const& cluster : data.clusters) {
+            result += toInt(cluster.cells.size());
+        }
+        return result;
+    }
+
+    std::vector<std::vector<uint8_t>> getGenomes(ClusteredDataDescription const& data)
+    {
+        std::vector<std::vector<uint8_t>> result;
+        for (auto const& cluster : data.clusters) {
+            for (auto const& cell : cluster.cells) {
+                if (!cell.cellFunction) {
+                    continue;
+                }
+                if (auto constructor = std::get_if<ConstructorDescription>(&*cell.cellFunction)) {
+                    result.emplace_back(constructor->genome);
+                }
+                if (auto injector = std::get_if<InjectorDescription>(&*cell.cellFunction)) {
+                    result.emplace_back(injector->genome);
+                }
+            }
+        }
+        return result;
+    }
+
+    void setGenomeCounters(benchmark::State& state, GenomeOptimizationStatistics const& statistics)
+    {
+        auto numGenomes = std::max(1, statistics.numGenomes);
+        state.counters["bytes_per_cell_before"] = static_cast<double>(statistics.numBytesBefore) / numGenomes;
+        state.counters["bytes_per_cell_after"] = static_cast<double>(statistics.numBytesAfter) / numGenomes;
+        state.counters["changed_genomes"] = statistics.numChangedGenomes;
+        state.counters["invalid_genomes"] = statistics.numInvalidGenomes;
+        state.counters["distinct_genomes"] = statistics.numDistinctGenomes;
+    }
+}
+
+static void BM_OptimizeEvolvedWorld(benchmark::State& state)
+{
+    auto const& world = getEvolvedWorld();
+    GenomeOptimizationStatistics statistics;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto data = world;
+        state.ResumeTiming();
+        statistics = GenomeOptimizer::optimize(data);
+        benchmark::DoNotOptimize(data.clusters.data());
+    }
+    setGenomeCounters(state, statistics);
+    state.SetItemsProcessed(state.iterations() * getNumCells(world));
+}
+BENCHMARK(BM_OptimizeEvolvedWorld)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//state.range(0) == 1: genomes of the evolved world after optimization
+static void BM_GetNumNodesRecursively(benchmark::State& state)
+{
+    auto data = getEvolvedWorld();
+    if (state.range(0) == 1) {
+        setGenomeCounters(state, GenomeOptimizer::optimize(data));
+    }
+    auto genomes = getGenomes(data);
+    for (auto _ : state) {
+        int numNodes = 0;
+        for (auto const& genome : genomes) {
+            numNodes += GenomeDecoderBase::getNumNodesRecursively(genome.data(), toInt(genome.size()));
+        }
+        benchmark::DoNotOptimize(numNodes);
+    }
+    state.SetItemsProcessed(state.iterations() * toInt(genomes.size()));
+}
+BENCHMARK(BM_GetNumNodesRecursively)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
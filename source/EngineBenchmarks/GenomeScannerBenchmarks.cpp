@@ -0,0 +1,140 @@
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/GenomeScanner.h"
+
+namespace
+{
+    //genome with nodes of different cell functions and nested subgenomes up to the given depth
+    std::vector<uint8_t> createGenome(int numNodesPerLevel, int depth)
+    {
+        std::vector<CellGenomeDescription> cells;
+        for (int i = 0; i < numNodesPerLevel; ++i) {
+            switch (i % 8) {
+            case 0:
+                cells.emplace_back(CellGenomeDescription().setCellFunction(NeuronGenomeDescription()));
+                break;
+            case 1:
+                cells.emplace_back(CellGenomeDescription().setCellFunction(SensorGenomeDescription()));
+                break;
+            case 2:
+                if (depth > 0) {
+                    cells.emplace_back(CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(createGenome(numNodesPerLevel, depth - 1))));
+                } else {
+                    cells.emplace_back(CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setMakeGenomeCopy()));
+                }
+                break;
+            case 3:
+                cells.emplace_back(CellGenomeDescription().setCellFunction(NerveGenomeDescription()));
+                break;
+            case 4:
+                cells.emplace_back(CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setMakeGenomeCopy()));
+                break;
+            case 5:
+                cells.emplace_back(CellGenomeDescription().setCellFunction(MuscleGenomeDescription()));
+                break;
+            case 6:
+                cells.emplace_back(CellGenomeDescription().setCellFunction(TransmitterGenomeDescription()));
+                break;
+            default:
+                cells.emplace_back(CellGenomeDescription());
+                break;
+            }
+        }
+        return GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells(cells));
+    }
+
+    std::vector<std::vector<uint8_t>> createPopulation(int numGenomes)
+    {
+        std::vector<std::vector<uint8_t>> result;
+        result.reserve(numGenomes);
+        for (int i = 0; i < numGenomes; ++i) {
+            result.emplace_back(createGenome(8 + i % 16, 2));
+        }
+        return result;
+    }
+}
+
+//former approach of GenomeDescriptionConverter::getNumNodesRecursively, kept as reference
+static void BM_NumNodesRecursivelyViaDescriptions(benchmark::State& state)
+{
+    auto population = createPopulation(toInt(state.range(0)));
+    std::function<int(std::vector<uint8_t> const&)> getNumNodes = [&](std::vector<uint8_t> const& data) {
+        auto genome = GenomeDescriptionConverter::convertBytesToDescription(data);
+        auto result = toInt(genome.cells.size());
+        for (auto const& node : genome.cells) {
+            if (auto subgenome = node.getGenome()) {
+                result += getNumNodes(*subgenome);
+            }
+        }
+        return result;
+    };
+    for (auto _ : state) {
+        auto numNodes = 0;
+        for (auto const& genome : population) {
+            numNodes += getNumNodes(genome);
+        }
+        benchmark::DoNotOptimize(numNodes);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NumNodesRecursivelyViaDescriptions)->Arg(1000);
+
+static void BM_NumNodesRecursively(benchmark::State& state)
+{
+    auto population = createPopulation(toInt(state.range(0)));
+    for (auto _ : state) {
+        auto numNodes = 0;
+        for (auto const& genome : population) {
+            numNodes += GenomeScanner::getNumNodesRecursively(genome);
+        }
+        benchmark::DoNotOptimize(numNodes);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NumNodesRecursively)->Arg(1000)->Arg(100000);
+
+static void BM_NodeIndexBuild(benchmark::State& state)
+{
+    auto population = createPopulation(toInt(state.range(0)));
+    GenomeNodeIndex index;
+    for (auto _ : state) {
+        auto numNodes = 0;
+        for (auto const& genome : population) {
+            index.build(genome);
+            numNodes += index.getNumNodesRecursively();
+        }
+        benchmark::DoNotOptimize(numNodes);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NodeIndexBuild)->Arg(1000)->Arg(100000);
+
+static void BM_ConvertNodeAddressToNodeIndex(benchmark::State& state)
+{
+    auto genome = createGenome(toInt(state.range(0)), 0);
+    for (auto _ : state) {
+        auto sum = 0;
+        for (int address = 0; address < toInt(genome.size()); address += Const::CellBasicBytes) {
+            sum += GenomeDescriptionConverter::convertNodeAddressToNodeIndex(genome, address);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_ConvertNodeAddressToNodeIndex)->Arg(16)->Arg(256);
+
+static void BM_NodeIndexLookup(benchmark::State& state)
+{
+    auto genome = createGenome(toInt(state.range(0)), 0);
+    GenomeNodeIndex index(genome);
+    for (auto _ : state) {
+        auto sum = 0;
+        for (int address = 0; address < toInt(genome.size()); address += Const::CellBasicBytes) {
+            sum += index.getNodeIndex(address);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_NodeIndexLookup)->Arg(16)->Arg(256);
@@ -0,0 +1,83 @@
+#include <cmath>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/NeuronNetworkEvaluator.h"
+
+namespace
+{
+    std::vector<float> createRandomValues(int size, float range)
+    {
+        std::mt19937 randomEngine(size);
+        std::uniform_real_distribution<float> distribution(-range, range);
+        std::vector<float> result(size);
+        for (auto& value : result) {
+            value = distribution(randomEngine);
+        }
+        return result;
+    }
+}
+
+//one network after another with row-major weights as stored in NeuronFunction::NeuronState
+static void BM_EvaluateNeuronsSequentially(benchmark::State& state)
+{
+    auto numNetworks = toInt(state.range(0));
+    auto weights = createRandomValues(numNetworks * MAX_CHANNELS * MAX_CHANNELS, 4.0f);
+    auto biases = createRandomValues(numNetworks * MAX_CHANNELS, 1.0f);
+    auto inputs = createRandomValues(numNetworks * MAX_CHANNELS, 1.0f);
+    std::vector<float> outputs(numNetworks * MAX_CHANNELS);
+    for (auto _ : state) {
+        for (int i = 0; i < numNetworks; ++i) {
+            for (int row = 0; row < MAX_CHANNELS; ++row) {
+                auto sum = biases[i * MAX_CHANNELS + row];
+                for (int col = 0; col < MAX_CHANNELS; ++col) {
+                    sum += weights[(i * MAX_CHANNELS + row) * MAX_CHANNELS + col] * inputs[i * MAX_CHANNELS + col];
+                }
+                outputs[i * MAX_CHANNELS + row] = NeuronNetworkEvaluator::scaledSigmoid(sum);
+            }
+        }
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numNetworks);
+}
+BENCHMARK(BM_EvaluateNeuronsSequentially)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+static void BM_EvaluateNeuronsBatched(benchmark::State& state)
+{
+    auto numNetworks = toInt(state.range(0));
+    auto weights = createRandomValues(numNetworks * MAX_CHANNELS * MAX_CHANNELS, 4.0f);
+    auto biases = createRandomValues(numNetworks * MAX_CHANNELS, 1.0f);
+    auto inputs = createRandomValues(numNetworks * MAX_CHANNELS, 1.0f);
+    std::vector<float> outputs(numNetworks * MAX_CHANNELS);
+
+    NeuronNetworkEvaluator evaluator;
+    evaluator.reserve(numNetworks);
+    for (int i = 0; i < numNetworks; ++i) {
+        evaluator.addNetwork(weights.data() + i * MAX_CHANNELS * MAX_CHANNELS, biases.data() + i * MAX_CHANNELS);
+    }
+    for (auto _ : state) {
+        evaluator.evaluate(inputs, outputs);
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numNetworks);
+}
+BENCHMARK(BM_EvaluateNeuronsBatched)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+static void BM_ReplayNeuronSequence(benchmark::State& state)
+{
+    auto numSteps = toInt(state.range(0));
+    auto weights = createRandomValues(MAX_CHANNELS * MAX_CHANNELS, 4.0f);
+    auto biases = createRandomValues(MAX_CHANNELS, 1.0f);
+    auto inputs = createRandomValues(numSteps * MAX_CHANNELS, 1.0f);
+    std::vector<float> outputs(numSteps * MAX_CHANNELS);
+
+    NeuronNetworkEvaluator evaluator;
+    evaluator.addNetwork(weights.data(), biases.data());
+    for (auto _ : state) {
+        evaluator.evaluateSequence(0, inputs, outputs);
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numSteps);
+}
+BENCHMARK(BM_ReplayNeuronSequence)->RangeMultiplier(8)->Range(64, 1 << 18);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/PreviewDescriptionConverter.h"
+
+namespace
+{
+    //genome with the given number of constructors on each level, each of them carrying a subgenome
+    GenomeDescription createGenome(int numNodesPerLevel, int depth)
+    {
+        std::vector<CellGenomeDescription> cells;
+        for (int i = 0; i < numNodesPerLevel; ++i) {
+            if (depth > 0 && i % 4 == 1) {
+                auto subGenome = GenomeDescriptionConverter::convertDescriptionToBytes(createGenome(numNodesPerLevel, depth - 1));
+                cells.emplace_back(CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)));
+            } else {
+                cells.emplace_back(CellGenomeDescription().setCellFunction(NeuronGenomeDescription()));
+            }
+        }
+        return GenomeDescription().setCells(cells);
+    }
+
+    //genome without subgenomes whose cells are folded into a dense cluster
+    GenomeDescription createFoldedGenome(int numNodes)
+    {
+        std::vector<CellGenomeDescription> cells;
+        for (int i = 0; i < numNodes; ++i) {
+            cells.emplace_back(CellGenomeDescription().setReferenceAngle(toFloat((i * 37) % 240 - 120)).setColor(i % MAX_COLORS));
+        }
+        return GenomeDescription().setCells(cells);
+    }
+
+    //simulates an edit in the genome editor: the color of the first node changes in every frame
+    std::vector<uint8_t> createEditedGenome(GenomeDescription genome, int frame)
+    {
+        genome.cells.front().color = frame % MAX_COLORS;
+        return GenomeDescriptionConverter::convertDescriptionToBytes(genome);
+    }
+}
+
+static void BM_PreviewUncached(benchmark::State& state)
+{
+    auto genome = createGenome(toInt(state.range(0)), 2);
+    SimulationParameters parameters;
+    int frame = 0;
+    for (auto _ : state) {
+        auto genomeData = createEditedGenome(genome, ++frame);
+        auto preview = PreviewDescriptionConverter::convert(GenomeDescriptionConverter::convertBytesToDescription(genomeData), std::nullopt, parameters);
+        benchmark::DoNotOptimize(preview);
+    }
+}
+BENCHMARK(BM_PreviewUncached)->Arg(8)->Arg(16);
+
+static void BM_PreviewCached(benchmark::State& state)
+{
+    auto genome = createGenome(toInt(state.range(0)), 2);
+    SimulationParameters parameters;
+    PreviewDescriptionCache cache;
+    int frame = 0;
+    for (auto _ : state) {
+        auto genomeData = createEditedGenome(genome, ++frame);
+        auto const& preview = cache.getPreview(genomeData, parameters);
+        benchmark::DoNotOptimize(preview);
+    }
+}
+BENCHMARK(BM_PreviewCached)->Arg(8)->Arg(16);
+
+static void BM_PreviewLargeGenome(benchmark::State& state)
+{
+    auto genome = createFoldedGenome(toInt(state.range(0)));
+    SimulationParameters parameters;
+    for (auto _ : state) {
+        auto preview = PreviewDescriptionConverter::convert(genome, std::nullopt, parameters);
+        benchmark::DoNotOptimize(preview);
+    }
+}
+BENCHMARK(BM_PreviewLargeGenome)->Arg(1000)->Unit(benchmark::kMillisecond);
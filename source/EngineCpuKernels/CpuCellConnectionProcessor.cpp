@@ -0,0 +1,269 @@
+#include "CpuCellConnectionProcessor.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "CpuParticleProcessor.h"
+
+void CpuCellConnectionProcessor::scheduleAddConnectionPair(CpuSimulationData& data, int threadIndex, int cellIndex1, int cellIndex2)
+{
+    data.structuralOperations.schedule(threadIndex, {CpuStructuralOperation::Type::AddConnectionPair, cellIndex1, cellIndex2});
+}
+
+void CpuCellConnectionProcessor::scheduleDeleteAllConnections(CpuSimulationData& data, int threadIndex, int cellIndex)
+{
+    data.structuralOperations.schedule(threadIndex, {CpuStructuralOperation::Type::DelAllConnections, cellIndex, -1});
+}
+
+void CpuCellConnectionProcessor::scheduleDeleteConnectionPair(CpuSimulationData& data, int threadIndex, int cellIndex1, int cellIndex2)
+{
+    data.structuralOperations.schedule(threadIndex, {CpuStructuralOperation::Type::DelConnectionPair, cellIndex1, cellIndex2});
+}
+
+void CpuCellConnectionProcessor::scheduleDeleteCell(CpuSimulationData& data, int threadIndex, int cellIndex)
+{
+    data.structuralOperations.schedule(threadIndex, {CpuStructuralOperation::Type::DelCell, cellIndex, -1});
+}
+
+void CpuCellConnectionProcessor::processOperations(CpuSimulationData& data)
+{
+    auto& operations = data.structuralOperations.merge();
+    resolveConnectionLimits(data, operations);
+
+    //keys of the particles from deleted cells are above those of the radiation pass in the same time step
+    auto orderKey = uint64_t(1) << 32;
+    for (auto const& operation : operations) {
+        switch (operation.type) {
+        case CpuStructuralOperation::Type::AddConnectionPair: {
+            auto const& cell1 = data.cells[operation.cellIndex];
+            auto const& cell2 = data.cells[operation.otherCellIndex];
+            if (cell1.numConnections < getMaxConnections(cell1) && cell2.numConnections < getMaxConnections(cell2)) {
+                tryAddConnections(data, operation.cellIndex, operation.otherCellIndex);
+            }
+        } break;
+        case CpuStructuralOperation::Type::DelCell: {
+            deleteCell(data, operation.cellIndex, orderKey++);
+        } break;
+        case CpuStructuralOperation::Type::DelAllConnections: {
+            deleteAllConnections(data, operation.cellIndex);
+        } break;
+        case CpuStructuralOperation::Type::DelConnectionPair: {
+            deleteConnections(data, operation.cellIndex, operation.otherCellIndex);
+        } break;
+        }
+    }
+    operations.clear();
+    data.addScheduledParticles();
+}
+
+void CpuCellConnectionProcessor::resolveConnectionLimits(CpuSimulationData const& data, std::vector<CpuStructuralOperation>& operations)
+{
+    auto additionsEnd = std::partition_point(
+        operations.begin(), operations.end(), [](auto const& operation) { return operation.type == CpuStructuralOperation::Type::AddConnectionPair; });
+
+    //invalid additions are removed beforehand such that they do not occupy free bond slots
+    std::vector<std::pair<float, CpuStructuralOperation>> additions;
+    for (auto it = operations.begin(); it != additionsEnd; ++it) {
+        auto cellIndex1 = it->cellIndex;
+        auto cellIndex2 = it->otherCellIndex;
+        if (cellIndex1 == cellIndex2 || data.cellRemoved[cellIndex1] || data.cellRemoved[cellIndex2] || isConnected(data, cellIndex1, cellIndex2)) {
+            continue;
+        }
+        additions.emplace_back(data.cellMap.getDistance(data.cells[cellIndex1].pos, data.cells[cellIndex2].pos), *it);
+    }
+
+    //ties are resolved by the cell indices since the additions are sorted
+    std::stable_sort(additions.begin(), additions.end(), [](auto const& addition1, auto const& addition2) { return addition1.first < addition2.first; });
+
+    std::unordered_map<int, int> numFreeSlots;
+    auto getNumFreeSlots = [&](int cellIndex) -> int& {
+        auto [it, inserted] = numFreeSlots.try_emplace(cellIndex, 0);
+        if (inserted) {
+            auto const& cell = data.cells[cellIndex];
+            it->second = getMaxConnections(cell) - cell.numConnections;
+        }
+        return it->second;
+    };
+    auto resolvedEnd = operations.begin();
+    for (auto const& [distance, operation] : additions) {
+        auto& numFreeSlots1 = getNumFreeSlots(operation.cellIndex);
+        auto& numFreeSlots2 = getNumFreeSlots(operation.otherCellIndex);
+        if (numFreeSlots1 > 0 && numFreeSlots2 > 0) {
+            --numFreeSlots1;
+            --numFreeSlots2;
+            *resolvedEnd++ = operation;
+        }
+    }
+    operations.erase(resolvedEnd, additionsEnd);
+}
+
+bool CpuCellConnectionProcessor::isConnected(CpuSimulationData const& data, int cellIndex1, int cellIndex2)
+{
+    auto const& cell1 = data.cells[cellIndex1];
+    for (int i = 0; i < cell1.numConnections; ++i) {
+        if (cell1.connections[i].cellIndex == cellIndex2) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CpuCellConnectionProcessor::tryAddConnections(CpuSimulationData& data, int cellIndex1, int cellIndex2)
+{
+    auto& cell1 = data.cells[cellIndex1];
+    auto posDelta = data.cellMap.getCorrectedDirection(data.cells[cellIndex2].pos - cell1.pos);
+
+    ConnectionTO origConnections[MAX_CELL_BONDS];
+    auto origNumConnections = cell1.numConnections;
+    std::copy(cell1.connections, cell1.connections + origNumConnections, origConnections);
+
+    if (!tryAddConnectionOneWay(data, cellIndex1, cellIndex2, posDelta)) {
+        return false;
+    }
+    if (!tryAddConnectionOneWay(data, cellIndex2, cellIndex1, posDelta * (-1))) {
+        cell1.numConnections = origNumConnections;
+        std::copy(origConnections, origConnections + origNumConnections, cell1.connections);
+        return false;
+    }
+    return true;
+}
+
+void CpuCellConnectionProcessor::deleteConnections(CpuSimulationData& data, int cellIndex1, int cellIndex2)
+{
+    deleteConnectionOneWay(data.cells[cellIndex1], cellIndex2);
+    deleteConnectionOneWay(data.cells[cellIndex2], cellIndex1);
+}
+
+void CpuCellConnectionProcessor::deleteAllConnections(CpuSimulationData& data, int cellIndex)
+{
+    auto& cell = data.cells[cellIndex];
+    for (int i = 0; i < cell.numConnections; ++i) {
+        deleteConnectionOneWay(data.cells[cell.connections[i].cellIndex], cellIndex);
+    }
+    cell.numConnections = 0;
+}
+
+void CpuCellConnectionProcessor::deleteCell(CpuSimulationData& data, int cellIndex, uint64_t orderKey)
+{
+    if (data.cellRemoved[cellIndex]) {
+        return;
+    }
+    auto const& cell = data.cells[cellIndex];
+    CpuParticleProcessor::radiate(data, orderKey, cell.pos, cell.vel, cell.color, cell.energy);
+    deleteAllConnections(data, cellIndex);
+    data.cellRemoved[cellIndex] = 1;
+}
+
+bool CpuCellConnectionProcessor::tryAddConnectionOneWay(CpuSimulationData& data, int cellIndex1, int cellIndex2, float2 const& posDelta)
+{
+    auto& cell1 = data.cells[cellIndex1];
+    if (wouldResultInOverlappingConnection(data, cellIndex1, cell1.pos + posDelta)) {
+        return false;
+    }
+
+    auto newAngle = CpuMath::angleOfVector(posDelta);
+    auto desiredDistance = CpuMath::length(posDelta);
+
+    if (0 == cell1.numConnections) {
+        cell1.numConnections++;
+        cell1.connections[0] = {cellIndex2, desiredDistance, 360.0f};
+        return true;
+    }
+
+    auto getAngleOfConnection = [&](int index) {
+        return CpuMath::angleOfVector(data.cellMap.getCorrectedDirection(data.cells[cell1.connections[index].cellIndex].pos - cell1.pos));
+    };
+    if (1 == cell1.numConnections) {
+        auto angleDiff = newAngle - getAngleOfConnection(0);
+        if (angleDiff < 0) {
+            angleDiff += 360.0;
+        }
+        if (std::abs(angleDiff) < NEAR_ZERO || std::abs(angleDiff - 360.0f) < NEAR_ZERO || std::abs(angleDiff + 360.0f) < NEAR_ZERO) {
+            return false;
+        }
+        cell1.connections[1] = {cellIndex2, desiredDistance, angleDiff};
+        cell1.connections[0].angleFromPrevious = 360.0f - angleDiff;
+        cell1.numConnections++;
+        return true;
+    }
+
+    //find appropriate index for new connection
+    int index = 0;
+    float prevAngle = 0;
+    float nextAngle = 0;
+    for (; index < cell1.numConnections; ++index) {
+        prevAngle = getAngleOfConnection((index + cell1.numConnections - 1) % cell1.numConnections);
+        nextAngle = getAngleOfConnection(index);
+        if (CpuMath::isAngleInBetween(prevAngle, nextAngle, newAngle)) {
+            break;
+        }
+    }
+
+    auto angleFromPrevious = 0.0f;
+    auto refAngle = cell1.connections[index % cell1.numConnections].angleFromPrevious;
+    if (CpuMath::isAngleInBetween(prevAngle, nextAngle, newAngle)) {
+        auto angleDiff1 = CpuMath::subtractAngle(newAngle, prevAngle);
+        auto angleDiff2 = CpuMath::subtractAngle(nextAngle, prevAngle);
+        auto factor = angleDiff2 != 0 ? angleDiff1 / angleDiff2 : 0.5f;
+        angleFromPrevious = std::min(refAngle * factor, refAngle);
+    }
+    if (angleFromPrevious < NEAR_ZERO) {
+        return false;
+    }
+
+    //adjust reference angle of next connection
+    auto nextAngleFromPrevious = refAngle - angleFromPrevious;
+    if (nextAngleFromPrevious < NEAR_ZERO) {
+        return false;
+    }
+    cell1.connections[index % cell1.numConnections].angleFromPrevious = nextAngleFromPrevious;
+
+    //add connection
+    for (int j = cell1.numConnections; j > index; --j) {
+        cell1.connections[j] = cell1.connections[j - 1];
+    }
+    cell1.connections[index] = {cellIndex2, desiredDistance, angleFromPrevious};
+    ++cell1.numConnections;
+    return true;
+}
+
+void CpuCellConnectionProcessor::deleteConnectionOneWay(CellTO& cell1, int cellIndex2)
+{
+    for (int i = 0; i < cell1.numConnections; ++i) {
+        if (cell1.connections[i].cellIndex == cellIndex2) {
+            auto angleToAdd = cell1.connections[i].angleFromPrevious;
+            for (int j = i; j < cell1.numConnections - 1; ++j) {
+                cell1.connections[j] = cell1.connections[j + 1];
+            }
+            if (i < cell1.numConnections - 1) {
+                cell1.connections[i].angleFromPrevious += angleToAdd;
+            } else {
+                cell1.connections[0].angleFromPrevious += angleToAdd;
+            }
+            --cell1.numConnections;
+            return;
+        }
+    }
+}
+
+bool CpuCellConnectionProcessor::wouldResultInOverlappingConnection(CpuSimulationData const& data, int cellIndex1, float2 const& otherCellPos)
+{
+    auto const& cell1 = data.cells[cellIndex1];
+    auto const& n = cell1.numConnections;
+    if (n < 2) {
+        return false;
+    }
+    for (int i = 0; i < n; ++i) {
+        auto connectedCellIndex = cell1.connections[i].cellIndex;
+        auto nextConnectedCellIndex = cell1.connections[(i + 1) % n].cellIndex;
+        if (!isConnected(data, connectedCellIndex, nextConnectedCellIndex)) {
+            continue;
+        }
+        auto connectedCellPos = cell1.pos + data.cellMap.getCorrectedDirection(data.cells[connectedCellIndex].pos - cell1.pos);
+        auto nextConnectedCellPos = cell1.pos + data.cellMap.getCorrectedDirection(data.cells[nextConnectedCellIndex].pos - cell1.pos);
+        if (CpuMath::crossing(cell1.pos, otherCellPos, connectedCellPos, nextConnectedCellPos)) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+
+#include "CpuSimulationData.h"
+
+//host counterpart of CellConnectionProcessor: structural changes are scheduled during the parallel passes
+//and processed serially in a deterministic order afterwards
+//threadIndex has to be the one passed by the ThreadPool to the scheduling pass, serial code such as the editing operations uses 0
+class CpuCellConnectionProcessor
+{
+public:
+    static void scheduleAddConnectionPair(CpuSimulationData& data, int threadIndex, int cellIndex1, int cellIndex2);
+    static void scheduleDeleteAllConnections(CpuSimulationData& data, int threadIndex, int cellIndex);
+    static void scheduleDeleteConnectionPair(CpuSimulationData& data, int threadIndex, int cellIndex1, int cellIndex2);
+    static void scheduleDeleteCell(CpuSimulationData& data, int threadIndex, int cellIndex);
+
+    static void processOperations(CpuSimulationData& data);
+
+    //the additions are ordered by the lengths of the new connections and those exceeding the free bond slots of a cell are removed
+    //such that competing additions are resolved in favor of the shortest connections
+    //prerequisite: operations are merged
+    static void resolveConnectionLimits(CpuSimulationData const& data, std::vector<CpuStructuralOperation>& operations);
+    static int getMaxConnections(CellTO const& cell) { return std::min(cell.maxConnections, MAX_CELL_BONDS); }
+
+    static bool isConnected(CpuSimulationData const& data, int cellIndex1, int cellIndex2);
+    static bool tryAddConnections(CpuSimulationData& data, int cellIndex1, int cellIndex2);
+    static void deleteConnections(CpuSimulationData& data, int cellIndex1, int cellIndex2);
+    static void deleteAllConnections(CpuSimulationData& data, int cellIndex);
+    static void deleteCell(CpuSimulationData& data, int cellIndex, uint64_t orderKey);
+
+private:
+    static bool tryAddConnectionOneWay(CpuSimulationData& data, int cellIndex1, int cellIndex2, float2 const& posDelta);
+    static void deleteConnectionOneWay(CellTO& cell1, int cellIndex2);
+    static bool wouldResultInOverlappingConnection(CpuSimulationData const& data, int cellIndex1, float2 const& otherCellPos);
+};
@@ -0,0 +1,398 @@
+#include "CpuCellFunctionProcessor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+    auto constexpr NothingFound = 0xffffffffffffffffull;
+    auto constexpr NoCreatureId = 0xffffffffu;
+
+    //0 to 180 degree => 0 to 128
+    //-180 to 0 degree => 128 to 256 (= 0)
+    uint8_t convertAngleToData(float angle)
+    {
+        angle = std::remainder(std::remainder(angle, 360.0f) + 360.0f, 360.0f);  //get angle between 0 and 360
+        if (angle > 180.0f) {
+            angle -= 360.0f;
+        }
+        int result = static_cast<int>(angle * 128.0f / 180.0f);
+        return static_cast<uint8_t>(result);
+    }
+
+    //0 to 127 => 0 to 179 degree
+    //128 to 255 => -179 to 0 degree
+    float convertDataToAngle(uint8_t b)
+    {
+        if (b < 128) {
+            return (0.5f + static_cast<float>(b)) * (180.0f / 128.0f);
+        } else {
+            return (-256.0f - 0.5f + static_cast<float>(b)) * (180.0f / 128.0f);
+        }
+    }
+
+    //creature id of a cell with the searched color near the scan position if the sensors are detectable
+    uint32_t findCreatureId(CpuSimulationData const& data, CellTO const& cell, float2 const& scanPos, int color)
+    {
+        if (data.parameters.cellFunctionAttackerSensorDetectionFactor[cell.color] > NEAR_ZERO) {
+            for (float dx = -3.0f; dx < 3.0f + NEAR_ZERO; dx += 1.0f) {
+                for (float dy = -3.0f; dy < 3.0f + NEAR_ZERO; dy += 1.0f) {
+                    auto otherIndex = data.cellMap.getFirst(scanPos + float2{dx, dy});
+                    if (otherIndex != -1 && data.cells[otherIndex].color == color) {
+                        return static_cast<uint32_t>(data.cells[otherIndex].creatureId);
+                    }
+                }
+            }
+        }
+        return NoCreatureId;
+    }
+
+    //true if no scan point within maxDistance can reach a density of at least minDensity since the nearest slot with cells of the color is farther away
+    //the remaining units of a world size which is not a multiple of the slot size are addressed as other slots as on the gpu, hence they are not excluded
+    bool isOutOfRange(CpuSimulationData const& data, CellTO const& cell, int color, int minDensity, float maxDistance)
+    {
+        if (minDensity <= 0 || data.worldSize.x % CpuDensityMap::DefaultSlotSize != 0) {
+            return false;
+        }
+        float2 regionStart;
+        float2 regionEnd;
+        return !data.densityMap.findNearestNonEmptyRegion(cell.pos, color, maxDistance + 1.0f, regionStart, regionEnd);  //margin for rounding errors
+    }
+
+    //distance along the direction until pos leaves the block shrunk by a margin which covers the rounding errors of the scan positions
+    float calcBlockExitDistance(float2 const& pos, float2 const& direction, float2 const& blockStart, float2 const& blockEnd)
+    {
+        auto constexpr Margin = 0.01f;
+        auto result = std::numeric_limits<float>::max();
+        if (direction.x > 0) {
+            result = std::min(result, (blockEnd.x - Margin - pos.x) / direction.x);
+        } else if (direction.x < 0) {
+            result = std::min(result, (blockStart.x + Margin - pos.x) / direction.x);
+        }
+        if (direction.y > 0) {
+            result = std::min(result, (blockEnd.y - Margin - pos.y) / direction.y);
+        } else if (direction.y < 0) {
+            result = std::min(result, (blockStart.y + Margin - pos.y) / direction.y);
+        }
+        return result;
+    }
+
+    //calls onMatch(distance, scanPos, density) for the scan points cell.pos + getOffset(i) with a density of the color of at least minDensity
+    //the offsets have to lie on the ray with the given direction at the distances in increasing order
+    //the scan stops behind the distance of the lookup result and skips empty blocks of the density pyramid
+    template <typename GetOffsetFunc, typename MatchFunc>
+    void scanRay(
+        CpuSimulationData const& data,
+        CellTO const& cell,
+        float2 const& direction,
+        std::vector<float> const& distances,
+        GetOffsetFunc const& getOffset,
+        int color,
+        int minDensity,
+        uint64_t const& lookupResult,
+        MatchFunc const& onMatch)
+    {
+        auto worldSize = float2{toFloat(data.worldSize.x), toFloat(data.worldSize.y)};
+        auto numDistances = toInt(distances.size());
+        for (int i = 0; i < numDistances; ++i) {
+            auto distance = distances[i];
+            if (static_cast<uint64_t>(distance) > (lookupResult >> 48)) {
+                break;
+            }
+            auto scanPos = cell.pos + getOffset(i);
+
+            //positions inside the world are not changed by the torus correction
+            if (scanPos.x < 0 || scanPos.y < 0 || scanPos.x >= worldSize.x || scanPos.y >= worldSize.y) {
+                data.cellMap.correctPosition(scanPos);
+            }
+            if (minDensity > 0) {
+                float2 blockStart;
+                float2 blockEnd;
+                if (data.densityMap.isEmpty(scanPos, color, blockStart, blockEnd)) {
+                    auto skipUntilDistance = distance + calcBlockExitDistance(scanPos, direction, blockStart, blockEnd);
+                    i = toInt(std::lower_bound(distances.begin() + i + 1, distances.end(), skipUntilDistance) - distances.begin()) - 1;
+                    continue;
+                }
+            }
+            auto density = static_cast<unsigned char>(data.densityMap.getDensity(scanPos, color));
+            if (density >= minDensity) {
+                onMatch(distance, scanPos, density);
+            }
+        }
+    }
+}
+
+void CpuCellFunctionProcessor::collectCellFunctionOperations(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    auto executionOrderNumber = toInt(data.timestep % parameters.cellNumExecutionOrderNumbers);
+
+    for (auto& operations : data.cellFunctionOperations) {
+        operations.clear();
+    }
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        auto const& cell = data.cells[index];
+        if (cell.cellFunction != CellFunction_None && cell.executionOrderNumber == executionOrderNumber && cell.activationTime == 0
+            && cell.livingState == LivingState_Ready && !data.cellRemoved[index]) {
+            data.cellFunctionOperations[cell.cellFunction].emplace_back(index);
+        }
+    }
+}
+
+void CpuCellFunctionProcessor::resetFetchedActivities(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    auto executionOrderNumber = toInt(data.timestep % parameters.cellNumExecutionOrderNumbers);
+
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        if (cell.cellFunction == CellFunction_None) {
+            return;
+        }
+        int maxOtherExecutionOrderNumber = -1;
+        if (!cell.outputBlocked) {
+            for (int i = 0, j = cell.numConnections; i < j; ++i) {
+                auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+                auto otherExecutionOrderNumber = connectedCell.executionOrderNumber;
+                auto otherInputExecutionOrderNumber = connectedCell.inputExecutionOrderNumber;
+                if (otherInputExecutionOrderNumber == cell.executionOrderNumber) {
+                    if (maxOtherExecutionOrderNumber == -1) {
+                        maxOtherExecutionOrderNumber = otherExecutionOrderNumber;
+                    } else {
+                        if ((maxOtherExecutionOrderNumber > cell.executionOrderNumber
+                             && (otherExecutionOrderNumber > maxOtherExecutionOrderNumber || otherExecutionOrderNumber < cell.executionOrderNumber))
+                            || (maxOtherExecutionOrderNumber < cell.executionOrderNumber && otherExecutionOrderNumber > maxOtherExecutionOrderNumber
+                                && otherExecutionOrderNumber < cell.executionOrderNumber)) {
+                            maxOtherExecutionOrderNumber = otherExecutionOrderNumber;
+                        }
+                    }
+                }
+            }
+        }
+        if ((maxOtherExecutionOrderNumber == -1 && executionOrderNumber == (cell.executionOrderNumber + 1) % parameters.cellNumExecutionOrderNumbers)
+            || (maxOtherExecutionOrderNumber != -1 && maxOtherExecutionOrderNumber == executionOrderNumber)) {
+            for (int i = 0; i < MAX_CHANNELS; ++i) {
+                cell.activity.channels[i] = 0;
+            }
+        }
+    });
+}
+
+void CpuCellFunctionProcessor::processNerves(CpuSimulationData& data, CpuSimulationStatistics& statistics)
+{
+    auto const& parameters = data.parameters;
+    auto const& numExecutionOrderNumbers = parameters.cellNumExecutionOrderNumbers;
+
+    forEachOperation(data, CellFunction_Nerve, [&](int, int cellIndex) {
+        auto& cell = data.cells[cellIndex];
+        auto activity = calcInputActivity(data, cell);
+
+        auto const& nerve = cell.cellFunctionData.nerve;
+        auto counter = (cell.age / numExecutionOrderNumbers) * numExecutionOrderNumbers + cell.executionOrderNumber % numExecutionOrderNumbers;
+        if (nerve.pulseMode > 0 && (counter % (numExecutionOrderNumbers * nerve.pulseMode) == cell.executionOrderNumber)) {
+            statistics.incNumNervePulses(cell.color);
+            if (nerve.alternationMode == 0) {
+                activity.channels[0] += 1.0f;
+            } else {
+                auto evenPulse = counter % (numExecutionOrderNumbers * nerve.pulseMode * nerve.alternationMode * 2)
+                    < cell.executionOrderNumber + numExecutionOrderNumbers * nerve.pulseMode * nerve.alternationMode;
+                activity.channels[0] += evenPulse ? 1.0f : -1.0f;
+            }
+        }
+        cell.activity = activity;
+    });
+}
+
+void CpuCellFunctionProcessor::processNeurons(CpuSimulationData& data, CpuSimulationStatistics& statistics)
+{
+    auto const& operations = data.cellFunctionOperations[CellFunction_Neuron];
+    if (operations.empty()) {
+        return;
+    }
+
+    //the networks of all operations are evaluated in one batch
+    auto& evaluator = data.neuronNetworkEvaluator;
+    evaluator.clear();
+    evaluator.reserve(toInt(operations.size()));
+    for (auto const& cellIndex : operations) {
+        float weights[MAX_CHANNELS * MAX_CHANNELS];
+        float biases[MAX_CHANNELS];
+        auto neuronState = data.auxiliaryData.data() + data.cells[cellIndex].cellFunctionData.neuron.weightsAndBiasesDataIndex;
+        std::memcpy(weights, neuronState, sizeof(weights));
+        std::memcpy(biases, neuronState + sizeof(weights), sizeof(biases));
+        evaluator.addNetwork(weights, biases);
+    }
+
+    std::vector<float> inputs(operations.size() * MAX_CHANNELS);
+    std::vector<float> outputs(operations.size() * MAX_CHANNELS);
+    forEachOperation(data, CellFunction_Neuron, [&](int operationIndex, int cellIndex) {
+        auto activity = calcInputActivity(data, data.cells[cellIndex]);
+        std::copy(activity.channels, activity.channels + MAX_CHANNELS, inputs.begin() + operationIndex * MAX_CHANNELS);
+    });
+
+    evaluator.evaluate(inputs, outputs);
+
+    forEachOperation(data, CellFunction_Neuron, [&](int operationIndex, int cellIndex) {
+        auto& cell = data.cells[cellIndex];
+        std::copy(outputs.begin() + operationIndex * MAX_CHANNELS, outputs.begin() + (operationIndex + 1) * MAX_CHANNELS, cell.activity.channels);
+        statistics.incNumNeuronActivities(cell.color);
+    });
+}
+
+void CpuCellFunctionProcessor::processSensors(CpuSimulationData& data, CpuSimulationStatistics& statistics)
+{
+    if (data.cellFunctionOperations[CellFunction_Sensor].empty()) {
+        return;
+    }
+    data.sensorRayTables.update(data.parameters);
+
+    //each thread processes a contiguous batch of sensors, since the operations follow the spatial order of the cells
+    //the scans of a batch mostly touch the same regions of the maps
+    forEachOperation(data, CellFunction_Sensor, [&](int, int cellIndex) {
+        auto& cell = data.cells[cellIndex];
+        auto activity = calcInputActivity(data, cell);
+        if (std::abs(activity.channels[0]) > data.parameters.cellFunctionSensorActivityThreshold) {
+            statistics.incNumSensorActivities(cell.color);
+            switch (cell.cellFunctionData.sensor.mode) {
+            case SensorMode_Neighborhood: {
+                searchNeighborhood(data, statistics, cell, activity);
+            } break;
+            case SensorMode_FixedAngle: {
+                searchByAngle(data, statistics, cell, activity);
+            } break;
+            }
+        }
+        cell.activity = activity;
+    });
+}
+
+ActivityTO CpuCellFunctionProcessor::calcInputActivity(CpuSimulationData const& data, CellTO const& cell)
+{
+    ActivityTO result;
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        result.channels[i] = 0;
+    }
+
+    if (cell.inputExecutionOrderNumber == -1 || cell.inputExecutionOrderNumber == cell.executionOrderNumber) {
+        return result;
+    }
+
+    for (int i = 0, j = cell.numConnections; i < j; ++i) {
+        auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+        if (connectedCell.outputBlocked || connectedCell.livingState != LivingState_Ready) {
+            continue;
+        }
+        if (connectedCell.executionOrderNumber == cell.inputExecutionOrderNumber) {
+            for (int k = 0; k < MAX_CHANNELS; ++k) {
+                result.channels[k] += connectedCell.activity.channels[k];
+            }
+        }
+    }
+    return result;
+}
+
+float2 CpuCellFunctionProcessor::calcSignalDirection(CpuSimulationData const& data, CellTO const& cell)
+{
+    float2 result{0, 0};
+    for (int i = 0; i < cell.numConnections; ++i) {
+        auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+        if (connectedCell.executionOrderNumber == cell.inputExecutionOrderNumber && !connectedCell.outputBlocked) {
+            auto directionDelta = cell.pos - connectedCell.pos;
+            data.cellMap.correctDirection(directionDelta);
+            result += CpuMath::normalized(directionDelta);
+        }
+    }
+    return CpuMath::normalized(result);
+}
+
+void CpuCellFunctionProcessor::searchNeighborhood(CpuSimulationData& data, CpuSimulationStatistics& statistics, CellTO& cell, ActivityTO& activity)
+{
+    auto& sensor = cell.cellFunctionData.sensor;
+    auto const& rayTables = data.sensorRayTables;
+    auto refScanAngle = CpuMath::angleOfVector(calcSignalDirection(data, cell));
+    auto minDensity = toInt(sensor.minDensity * 100);
+    auto color = sensor.color;
+    auto ownColor = color == cell.color;
+    auto const& radii = rayTables.getNeighborhoodRadii(cell.color, ownColor);
+
+    //the distance has the highest priority in the lookup result, hence each ray is only scanned up to its first match
+    uint64_t lookupResult = NothingFound;
+    if (!radii.empty() && !isOutOfRange(data, cell, color, minDensity, radii.back())) {
+        for (int angleIndex = 0; angleIndex < CpuSensorRayTables::NumScanAngles; ++angleIndex) {
+            auto const& offsets = rayTables.getNeighborhoodOffsets(cell.color, ownColor, angleIndex);
+            scanRay(
+                data,
+                cell,
+                rayTables.getNeighborhoodDirection(angleIndex),
+                radii,
+                [&](int i) { return offsets[i]; },
+                color,
+                minDensity,
+                lookupResult,
+                [&](float radius, float2 const& scanPos, unsigned char density) {
+                    auto creatureId = findCreatureId(data, cell, scanPos, color);
+                    auto relAngle = CpuMath::subtractAngle(CpuSensorRayTables::getNeighborhoodAngle(angleIndex), refScanAngle);
+                    uint32_t angle = convertAngleToData(relAngle);
+                    uint64_t combined =
+                        static_cast<uint64_t>(radius) << 48 | static_cast<uint64_t>(density) << 40 | static_cast<uint64_t>(angle) << 32 | creatureId;
+                    lookupResult = std::min(lookupResult, combined);
+                });
+        }
+    }
+
+    if (lookupResult != NothingFound) {
+        activity.channels[0] = 1;                                                     //something found
+        activity.channels[1] = static_cast<float>((lookupResult >> 40) & 0xff) / 256;  //density
+        activity.channels[2] = static_cast<float>(lookupResult >> 48) / 256;           //distance
+        activity.channels[3] = convertDataToAngle(static_cast<uint8_t>((lookupResult >> 32) & 0xff)) / 360.0f;  //angle: between -0.5 and 0.5
+        auto targetCreatureId = lookupResult & 0xffffffff;
+        if (targetCreatureId != NoCreatureId) {
+            sensor.targetedCreatureId = toInt(targetCreatureId);
+        }
+        statistics.incNumSensorMatches(cell.color);
+    } else {
+        activity.channels[0] = 0;  //nothing found
+    }
+}
+
+void CpuCellFunctionProcessor::searchByAngle(CpuSimulationData& data, CpuSimulationStatistics& statistics, CellTO& cell, ActivityTO& activity)
+{
+    auto& sensor = cell.cellFunctionData.sensor;
+    auto minDensity = toInt(sensor.minDensity * 255);
+    auto color = sensor.color;
+    auto searchDelta = CpuMath::rotateClockwise(calcSignalDirection(data, cell), sensor.angle);
+
+    uint64_t lookupResult = NothingFound;
+    auto const& distances = data.sensorRayTables.getFixedAngleDistances(cell.color);
+    if (!distances.empty() && !isOutOfRange(data, cell, color, minDensity, distances.back())) {
+        scanRay(
+            data,
+            cell,
+            searchDelta,
+            distances,
+            [&](int i) { return searchDelta * distances[i]; },
+            color,
+            minDensity,
+            lookupResult,
+            [&](float distance, float2 const& scanPos, unsigned char density) {
+                auto creatureId = findCreatureId(data, cell, scanPos, color);
+                uint64_t combined = static_cast<uint64_t>(distance) << 48 | static_cast<uint64_t>(density) << 40 | creatureId;
+                lookupResult = std::min(lookupResult, combined);
+            });
+    }
+
+    if (lookupResult != NothingFound) {
+        activity.channels[0] = 1;                                                     //something found
+        activity.channels[1] = static_cast<float>((lookupResult >> 40) & 0xff) / 256;  //density
+        activity.channels[2] = static_cast<float>(lookupResult >> 48) / 256;           //distance
+        auto targetCreatureId = lookupResult & 0xffffffff;
+        if (targetCreatureId != NoCreatureId) {
+            sensor.targetedCreatureId = toInt(targetCreatureId);
+        }
+        statistics.incNumSensorMatches(cell.color);
+    } else {
+        activity.channels[0] = 0;  //nothing found
+    }
+}
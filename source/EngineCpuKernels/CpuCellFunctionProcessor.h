@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CpuSimulationData.h"
+#include "CpuSimulationStatistics.h"
+
+//host counterparts of CellFunctionProcessor, NerveProcessor, NeuronProcessor and SensorProcessor
+//cell functions of the current execution order number only read the activities of cells with other execution order numbers,
+//hence all operations of a time step can be processed in parallel
+class CpuCellFunctionProcessor
+{
+public:
+    static void collectCellFunctionOperations(CpuSimulationData& data);
+    static void resetFetchedActivities(CpuSimulationData& data);
+
+    static void processNerves(CpuSimulationData& data, CpuSimulationStatistics& statistics);
+    static void processNeurons(CpuSimulationData& data, CpuSimulationStatistics& statistics);
+    static void processSensors(CpuSimulationData& data, CpuSimulationStatistics& statistics);
+
+    static ActivityTO calcInputActivity(CpuSimulationData const& data, CellTO const& cell);
+    static float2 calcSignalDirection(CpuSimulationData const& data, CellTO const& cell);
+
+private:
+    //the scan points are taken from the ray tables and regions without cells of the searched color are rejected by the density pyramid
+    //since the lookup result is ordered by the distance first, each ray is only scanned up to its first match
+    static void searchNeighborhood(CpuSimulationData& data, CpuSimulationStatistics& statistics, CellTO& cell, ActivityTO& activity);
+    static void searchByAngle(CpuSimulationData& data, CpuSimulationStatistics& statistics, CellTO& cell, ActivityTO& activity);
+
+    template <typename Func>
+    static void forEachOperation(CpuSimulationData& data, CellFunction cellFunction, Func const& func);
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+template <typename Func>
+void CpuCellFunctionProcessor::forEachOperation(CpuSimulationData& data, CellFunction cellFunction, Func const& func)
+{
+    auto const& operations = data.cellFunctionOperations[cellFunction];
+    data.threadPool.forEachRange(
+        toInt(operations.size()),
+        [&](int, int startIndex, int endIndex) {
+            for (int i = startIndex; i < endIndex; ++i) {
+                func(i, operations[i]);
+            }
+        },
+        64);
+}
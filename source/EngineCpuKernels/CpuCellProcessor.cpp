@@ -0,0 +1,602 @@
+#include "CpuCellProcessor.h"
+
+#include "CpuCellConnectionProcessor.h"
+#include "CpuGenomeDecoder.h"
+#include "CpuParticleProcessor.h"
+#include "CpuRandom.h"
+
+namespace
+{
+    //the fluid motion parameters share their memory with the collision motion parameters
+    CollisionMotion getCollisionMotion(SimulationParameters const& parameters)
+    {
+        return parameters.motionType == MotionType_Collision ? parameters.motionData.collisionMotion : CollisionMotion();
+    }
+
+    bool isConnectedTo(CellTO const& cell, int otherCellIndex)
+    {
+        for (int i = 0; i < cell.numConnections; ++i) {
+            if (cell.connections[i].cellIndex == otherCellIndex) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //candidates for the fluid interactions of a cell in structure of arrays layout, padded to a multiple of Lanes
+    struct FluidNeighbors
+    {
+        static auto constexpr Lanes = 16;
+
+        void clear()
+        {
+            indices.clear();
+            posDeltaX.clear();
+            posDeltaY.clear();
+            distances.clear();
+            velDeltaX.clear();
+            velDeltaY.clear();
+            densities.clear();
+            isOther.clear();
+            isUnconnected.clear();
+            isBarrier.clear();
+        }
+
+        void add(int index, float2 const& posDelta, float2 const& velDelta, float density, bool other, bool unconnected, bool barrier)
+        {
+            indices.emplace_back(index);
+            posDeltaX.emplace_back(posDelta.x);
+            posDeltaY.emplace_back(posDelta.y);
+            distances.emplace_back(CpuMath::length(posDelta));
+            velDeltaX.emplace_back(velDelta.x);
+            velDeltaY.emplace_back(velDelta.y);
+            densities.emplace_back(density);
+            isOther.emplace_back(other ? 1.0f : 0.0f);
+            isUnconnected.emplace_back(unconnected ? 1.0f : 0.0f);
+            isBarrier.emplace_back(barrier ? 1.0f : 0.0f);
+        }
+
+        //padding entries are out of range and hence do not contribute
+        void pad()
+        {
+            while (indices.size() % Lanes != 0) {
+                add(-1, {1.0e6f, 1.0e6f}, {0, 0}, 1.0f, false, false, false);
+            }
+        }
+
+        int size() const { return toInt(indices.size()); }
+
+        std::vector<int> indices;
+        std::vector<float> posDeltaX;
+        std::vector<float> posDeltaY;
+        std::vector<float> distances;  //calculated while gathering since std::sqrt prevents vectorization due to errno
+        std::vector<float> velDeltaX;
+        std::vector<float> velDeltaY;
+        std::vector<float> densities;
+        std::vector<float> isOther;
+        std::vector<float> isUnconnected;
+        std::vector<float> isBarrier;
+    };
+
+    struct FluidInteraction
+    {
+        float density;
+        float2 posCorrection;
+        float2 force;  //pressure and viscosity forces already weighted by their strengths plus the boundary force
+    };
+
+    //branch-free counterpart of the per-neighbor part of CellProcessor::calcFluidForces_reconnectCells_correctOverlap
+    //the sums are accumulated per lane and reduced afterwards such that the loop over the lanes is vectorized without reassociation
+    VECTORIZED_FUNCTION FluidInteraction calcFluidInteraction(
+        FluidNeighbors const& neighbors,
+        float cellDensity,
+        bool cellBarrier,
+        FluidMotion const& fluidMotion,
+        float cellMinDistance)
+    {
+        auto constexpr Lanes = FluidNeighbors::Lanes;
+        auto constexpr KernelNormalization = 3.0f / (2.0f * Const::Pi);
+
+        auto h = fluidMotion.smoothingLength;
+        auto densityFactor = 1.0f / (h * h);
+        auto kernelDerivativeFactor = 1.0f / (h * h * h);
+        auto cellTerm = cellDensity / (cellDensity * cellDensity);
+        auto overlapFactor = cellBarrier ? 0.0f : cellMinDistance / 5;
+
+        float density[Lanes] = {};
+        float posCorrectionX[Lanes] = {};
+        float posCorrectionY[Lanes] = {};
+        float pressureX[Lanes] = {};
+        float pressureY[Lanes] = {};
+        float viscosityX[Lanes] = {};
+        float viscosityY[Lanes] = {};
+        float boundaryX[Lanes] = {};
+        float boundaryY[Lanes] = {};
+
+        auto const posDeltaX = neighbors.posDeltaX.data();
+        auto const posDeltaY = neighbors.posDeltaY.data();
+        auto const distances = neighbors.distances.data();
+        auto const velDeltaX = neighbors.velDeltaX.data();
+        auto const velDeltaY = neighbors.velDeltaY.data();
+        auto const densities = neighbors.densities.data();
+        auto const isOther = neighbors.isOther.data();
+        auto const isUnconnected = neighbors.isUnconnected.data();
+        auto const isBarrier = neighbors.isBarrier.data();
+
+        for (int start = 0; start < neighbors.size(); start += Lanes) {
+            for (int lane = 0; lane < Lanes; ++lane) {
+                auto i = start + lane;
+                auto dx = posDeltaX[i];
+                auto dy = posDeltaY[i];
+                auto distanceSquared = dx * dx + dy * dy;
+                auto distance = distances[i];
+                auto q = distance / h;
+
+                //both pieces of the spline are evaluated such that the selection compiles to blends
+                auto q1 = std::max(2.0f - q, 0.0f);
+                auto innerKernel = 2.0f / 3.0f - q * q + 0.5f * q * q * q;
+                auto outerKernel = q1 * q1 * q1 / 6;
+                auto innerKernel_d = -2.0f * q + 1.5f * q * q;
+                auto outerKernel_d = -0.5f * q1 * q1;
+                auto kernel = q < 1.0f ? innerKernel : outerKernel;
+                auto kernel_d = q < 1.0f ? innerKernel_d : outerKernel_d;
+                kernel *= KernelNormalization * densityFactor;
+                kernel_d *= KernelNormalization * kernelDerivativeFactor;
+
+                auto inRange = distance <= 2 * h ? 1.0f : 0.0f;
+                density[lane] += kernel * inRange;
+
+                auto overlap = (distance < cellMinDistance ? 1.0f : 0.0f) * inRange * isOther[i] * overlapFactor;
+                posCorrectionX[lane] += dx * overlap;
+                posCorrectionY[lane] += dy * overlap;
+
+                auto interacting = inRange * isOther[i] * isUnconnected[i];
+                auto fluid = (distance > NEAR_ZERO ? 1.0f : 0.0f) * interacting * (1.0f - isBarrier[i]);
+                auto boundary = interacting * isBarrier[i];
+
+                auto safeDistance = std::max(distance, NEAR_ZERO);
+                auto otherDensity = densities[i];
+                auto factor = cellTerm + otherDensity / (otherDensity * otherDensity);
+                auto pressure = -factor * kernel_d / safeDistance * fluid;
+                pressureX[lane] += dx * pressure;
+                pressureY[lane] += dy * pressure;
+
+                auto viscosity = safeDistance * kernel_d / (otherDensity * (distanceSquared + 0.25f)) * fluid;
+                viscosityX[lane] += velDeltaX[i] * viscosity;
+                viscosityY[lane] += velDeltaY[i] * viscosity;
+
+                auto boundaryFactor = (velDeltaX[i] * dx + velDeltaY[i] * dy) / (-distanceSquared - 0.5f) * 2 * boundary;
+                boundaryX[lane] += dx * boundaryFactor;
+                boundaryY[lane] += dy * boundaryFactor;
+            }
+        }
+
+        FluidInteraction result{0, {0, 0}, {0, 0}};
+        for (int lane = 0; lane < Lanes; ++lane) {
+            result.density += density[lane];
+            result.posCorrection += float2{posCorrectionX[lane], posCorrectionY[lane]};
+            result.force += float2{pressureX[lane], pressureY[lane]} * fluidMotion.pressureStrength
+                + float2{viscosityX[lane], viscosityY[lane]} * fluidMotion.viscosityStrength + float2{boundaryX[lane], boundaryY[lane]};
+        }
+        return result;
+    }
+}
+
+void CpuCellProcessor::updateMap(CpuSimulationData& data)
+{
+    data.cellMap.update(data.cells, data.cellDetached, data.cellRemoved);
+}
+
+void CpuCellProcessor::fillDensityMap(CpuSimulationData& data)
+{
+    data.densityMap.update(data.cells, data.cellRemoved, data.threadPool);
+}
+
+void CpuCellProcessor::radiation(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+        CpuRandom random(data.randomSeed, data.timestep, index, RandomPurpose_Radiation);
+        if (random.random() >= parameters.radiationProb) {
+            return;
+        }
+        auto radiationFactor = 0.0f;
+        if (cell.energy > parameters.highRadiationMinCellEnergy[cell.color]) {
+            radiationFactor += parameters.highRadiationFactor[cell.color];
+        }
+        if (cell.age > parameters.radiationMinCellAge[cell.color]) {
+            radiationFactor += parameters.baseValues.radiationCellAgeStrength[cell.color];
+        }
+        if (radiationFactor <= 0) {
+            return;
+        }
+
+        auto const& cellEnergy = cell.energy;
+        auto energyLoss = cellEnergy * radiationFactor;
+        energyLoss = energyLoss / parameters.radiationProb;
+        energyLoss = 2 * energyLoss * CpuRandom(data.randomSeed, data.timestep, index, RandomPurpose_RadiationAmount).random();
+        if (cellEnergy > 1) {
+            auto angle = CpuRandom(data.randomSeed, data.timestep, index, RandomPurpose_RadiationAngle).random() * 360;
+            float2 particleVel =
+                cell.vel * parameters.radiationVelocityMultiplier + CpuMath::unitVectorOfAngle(angle) * parameters.radiationVelocityPerturbation;
+            float2 particlePos = cell.pos + CpuMath::normalized(particleVel) * 1.5f - particleVel;  //"- particleVel" because particle will still be moved in current time step
+            data.cellMap.correctPosition(particlePos);
+            if (energyLoss > cellEnergy - 1) {
+                energyLoss = cellEnergy - 1;
+            }
+            CpuParticleProcessor::radiate(data, index, particlePos, particleVel, cell.color, energyLoss);
+            cell.energy -= energyLoss;
+        }
+    });
+    data.addScheduledParticles();
+}
+
+void CpuCellProcessor::collisions(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    auto collisionMotion = getCollisionMotion(parameters);
+    auto radius = collisionMotion.cellMaxCollisionDistance;
+    data.cellNeighbors.update(data.cells, data.cellDetached, data.cellRemoved, data.cellMap, radius, data.threadPool);
+
+    data.threadPool.forEachRange(data.getNumCells(), [&](int threadIndex, int startIndex, int endIndex) {
+        for (int index = startIndex; index < endIndex; ++index) {
+            if (data.cellRemoved[index]) {
+                continue;
+            }
+            auto const& cell = data.cells[index];
+            float2 force{0, 0};
+            float2 posCorrection{0, 0};
+            data.cellNeighbors.executeForEach(index, [&](int otherIndex) {
+                if (data.cellRemoved[otherIndex]) {
+                    return;
+                }
+                auto const& otherCell = data.cells[otherIndex];
+                auto posDelta = data.cellMap.getCorrectedDirection(cell.pos - otherCell.pos);
+                auto distance = CpuMath::length(posDelta);
+                if (distance > radius) {
+                    return;
+                }
+
+                //overlap correction
+                if (!cell.barrier && distance < parameters.cellMinDistance) {
+                    posCorrection += posDelta * parameters.cellMinDistance / 5;
+                }
+
+                if (isConnectedTo(cell, otherIndex)) {
+                    return;
+                }
+
+                //collision algorithm: the force from the cell's own view minus the force the other cell applies in its view
+                auto velDelta = cell.vel - otherCell.vel;
+                force += calcCollisionForce(collisionMotion, posDelta, velDelta, CpuMath::length(cell.vel), cell.barrier);
+                force -= calcCollisionForce(collisionMotion, posDelta * (-1), velDelta * (-1), CpuMath::length(otherCell.vel), otherCell.barrier);
+
+                //fusion is scheduled once per pair
+                auto isApproaching = CpuMath::dot(posDelta, velDelta) < 0;
+                auto const& cellMaxBindingEnergy = parameters.baseValues.cellMaxBindingEnergy;
+                if (index < otherIndex && cell.numConnections < cell.maxConnections && otherCell.numConnections < otherCell.maxConnections
+                    && CpuMath::length(velDelta) >= parameters.baseValues.cellFusionVelocity && isApproaching && cell.energy <= cellMaxBindingEnergy
+                    && otherCell.energy <= cellMaxBindingEnergy && !cell.barrier && !otherCell.barrier) {
+                    CpuCellConnectionProcessor::scheduleAddConnectionPair(data, threadIndex, index, otherIndex);
+                }
+            });
+            data.cellForces[index] += force;
+            data.cellPosCorrections[index] = posCorrection;
+        }
+    });
+
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        cell.pos += data.cellPosCorrections[index];
+        data.cellMap.correctPosition(cell.pos);
+    });
+}
+
+void CpuCellProcessor::fluidForces(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    auto const& fluidMotion = parameters.motionData.fluidMotion;
+    auto radius = fluidMotion.smoothingLength * 2;
+
+    std::vector<FluidNeighbors> neighborsPerThread(data.threadPool.getNumThreads());
+    data.threadPool.forEachRange(data.getNumCells(), [&](int threadIndex, int startIndex, int endIndex) {
+        auto& neighbors = neighborsPerThread[threadIndex];
+        for (int index = startIndex; index < endIndex; ++index) {
+            if (data.cellRemoved[index]) {
+                continue;
+            }
+            auto const& cell = data.cells[index];
+            auto detached = data.cellDetached[index];
+
+            //gather the candidates, the interactions are then evaluated in a vectorized manner
+            neighbors.clear();
+            data.cellMap.executeForEachCandidate(cell.pos, radius, [&](int otherIndex, float2 const& otherPos) {
+                if (detached + data.cellDetached[otherIndex] == 1) {
+                    return;
+                }
+                auto const& otherCell = data.cells[otherIndex];
+                auto posDelta = data.cellMap.getCorrectedDirection(cell.pos - otherPos);
+                neighbors.add(
+                    otherIndex,
+                    posDelta,
+                    cell.vel - otherCell.vel,
+                    data.cellDensities[otherIndex],
+                    otherIndex != index,
+                    !isConnectedTo(cell, otherIndex),
+                    otherCell.barrier);
+            });
+            auto numCandidates = neighbors.size();
+            neighbors.pad();
+
+            auto interaction = calcFluidInteraction(neighbors, data.cellDensities[index], cell.barrier, fluidMotion, parameters.cellMinDistance);
+            data.cellPosCorrections[index] = interaction.posCorrection;
+            data.cellForces[index] += interaction.force;
+            data.cellNewDensities[index] = interaction.density;
+
+            //fusion is scheduled once per pair
+            auto const& cellMaxBindingEnergy = parameters.baseValues.cellMaxBindingEnergy;
+            if (cell.barrier || cell.numConnections >= cell.maxConnections || cell.energy > cellMaxBindingEnergy) {
+                continue;
+            }
+            for (int i = 0; i < numCandidates; ++i) {
+                auto otherIndex = neighbors.indices[i];
+                auto const& otherCell = data.cells[otherIndex];
+                if (index < otherIndex && neighbors.isUnconnected[i] != 0 && !otherCell.barrier
+                    && otherCell.numConnections < otherCell.maxConnections && otherCell.energy <= cellMaxBindingEnergy
+                    && neighbors.distances[i] <= radius
+                    && CpuMath::length({neighbors.velDeltaX[i], neighbors.velDeltaY[i]}) >= parameters.baseValues.cellFusionVelocity) {
+                    CpuCellConnectionProcessor::scheduleAddConnectionPair(data, threadIndex, index, otherIndex);
+                }
+            }
+        }
+    });
+
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        cell.pos += data.cellPosCorrections[index];
+        data.cellMap.correctPosition(cell.pos);
+    });
+    std::swap(data.cellDensities, data.cellNewDensities);
+}
+
+void CpuCellProcessor::checkForces(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    data.forEachCell([&](int threadIndex, int index) {
+        if (data.cells[index].barrier) {
+            return;
+        }
+        if (CpuMath::length(data.cellForces[index]) > parameters.baseValues.cellMaxForce) {
+            if (CpuRandom(data.randomSeed, data.timestep, index, RandomPurpose_ForceDecay).random() < parameters.cellMaxForceDecayProb) {
+                CpuCellConnectionProcessor::scheduleDeleteAllConnections(data, threadIndex, index);
+            }
+        }
+    });
+}
+
+void CpuCellProcessor::applyForces(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+        cell.vel += data.cellForces[index];
+        if (CpuMath::length(cell.vel) > parameters.cellMaxVelocity) {
+            cell.vel = CpuMath::normalized(cell.vel) * parameters.cellMaxVelocity;
+        }
+        data.cellForces[index] = {0, 0};
+    });
+}
+
+void CpuCellProcessor::calcConnectionForces(CpuSimulationData& data, bool considerAngles)
+{
+    packConnectionsIfNecessary(data);
+    data.connectionSolver.calcForces(data.cellForces, data.cellMap, considerAngles, data.parameters.cellMinDistance, data.threadPool);
+}
+
+void CpuCellProcessor::checkConnections(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+
+    //the gpu version also marks the connected cell as dying, here each cell marks itself since the distances are symmetric
+    data.forEachCell([&](int threadIndex, int index) {
+        auto& cell = data.cells[index];
+        bool scheduleForDestruction = false;
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+            if (cell.barrier && connectedCell.barrier) {
+                continue;
+            }
+            auto displacement = data.cellMap.getCorrectedDirection(connectedCell.pos - cell.pos);
+            if (CpuMath::length(displacement) > parameters.cellMaxBindingDistance) {
+                scheduleForDestruction = true;
+            }
+        }
+        if (scheduleForDestruction) {
+            if (parameters.clusterDecay) {
+                cell.livingState = LivingState_Dying;
+            }
+            if (!cell.barrier) {
+                CpuCellConnectionProcessor::scheduleDeleteAllConnections(data, threadIndex, index);
+            }
+        }
+    });
+}
+
+void CpuCellProcessor::verletPositionUpdate(CpuSimulationData& data)
+{
+    packConnectionsIfNecessary(data);
+    data.connectionSolver.verletPositionUpdate(
+        data.cells, data.cellForces, data.cellPrevForces, data.cellMap, data.parameters.timestepSize, data.threadPool);
+}
+
+void CpuCellProcessor::verletVelocityUpdate(CpuSimulationData& data)
+{
+    packConnectionsIfNecessary(data);
+    data.connectionSolver.verletVelocityUpdate(data.cells, data.cellForces, data.cellPrevForces, data.parameters.timestepSize, data.threadPool);
+    data.connectionSolver.invalidate();
+}
+
+void CpuCellProcessor::aging(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+        auto color = ((cell.color % MAX_COLORS) + MAX_COLORS) % MAX_COLORS;
+        auto transitionDuration = parameters.baseValues.cellColorTransitionDuration[color];
+        auto targetColor = parameters.baseValues.cellColorTransitionTargetColor[color];
+        ++cell.age;
+        if (transitionDuration > 0 && cell.age > transitionDuration) {
+            cell.color = targetColor;
+            cell.age = 0;
+        }
+        if (cell.livingState == LivingState_Ready && cell.activationTime > 0) {
+            --cell.activationTime;
+        }
+    });
+}
+
+void CpuCellProcessor::livingStateTransition(CpuSimulationData& data)
+{
+    data.forEachCell([&](int index) { data.cellLivingStates[index] = data.cells[index].livingState; });
+
+    //each cell derives its new state from the previous states of itself and its connected cells
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        auto livingState = data.cellLivingStates[index];
+        if (livingState == LivingState_JustReady) {
+            cell.livingState = LivingState_Ready;
+        }
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto connectedLivingState = data.cellLivingStates[cell.connections[i].cellIndex];
+            if (connectedLivingState == LivingState_JustReady && livingState == LivingState_UnderConstruction) {
+                cell.livingState = LivingState_JustReady;
+            }
+        }
+        for (int i = 0; i < cell.numConnections; ++i) {
+            if (data.cellLivingStates[cell.connections[i].cellIndex] != LivingState_Dying) {
+                continue;
+            }
+            if (cell.cellFunction == CellFunction_Constructor) {
+                auto& constructor = cell.cellFunctionData.constructor;
+                auto genome = data.auxiliaryData.data() + constructor.genomeDataIndex;
+                if (CpuGenomeDecoder::containsSelfReplication(genome, constructor.genomeSize) && !CpuGenomeDecoder::isSeparating(genome, constructor.genomeSize)) {
+                    constructor.genomeReadPosition = constructor.genomeSize;
+                    break;
+                }
+            }
+            cell.livingState = LivingState_Dying;
+            break;
+        }
+    });
+}
+
+void CpuCellProcessor::applyInnerFriction(CpuSimulationData& data)
+{
+    auto const innerFriction = data.parameters.innerFriction;
+    data.forEachCell([&](int index) { data.cellVelocities[index] = data.cells[index].vel; });
+
+    //the velocities of the connected cells are taken from the snapshot instead of locking cell pairs as on the gpu
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto connectedCellIndex = cell.connections[i].cellIndex;
+            if (data.cells[connectedCellIndex].barrier) {
+                continue;
+            }
+            auto averageVel = (cell.vel + data.cellVelocities[connectedCellIndex]) / 2;
+            cell.vel = cell.vel * (1.0f - innerFriction) + averageVel * innerFriction;
+        }
+    });
+}
+
+void CpuCellProcessor::applyFriction(CpuSimulationData& data)
+{
+    auto const& friction = data.parameters.baseValues.friction;
+    data.forEachCell([&](int index) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+        cell.vel = cell.vel * (1.0f - friction);
+    });
+}
+
+void CpuCellProcessor::decay(CpuSimulationData& data)
+{
+    auto const& parameters = data.parameters;
+    data.forEachCell([&](int threadIndex, int index) {
+        auto& cell = data.cells[index];
+        if (cell.barrier) {
+            return;
+        }
+
+        if (cell.livingState == LivingState_Dying) {
+            if (CpuRandom(data.randomSeed, data.timestep, index, RandomPurpose_Decay).random() < parameters.clusterDecayProb[cell.color]) {
+                CpuCellConnectionProcessor::scheduleDeleteCell(data, threadIndex, index);
+            }
+        }
+
+        bool cellDestruction = false;
+        if (cell.energy < parameters.baseValues.cellMinEnergy[cell.color]) {
+            cellDestruction = true;
+        } else if (cell.energy > parameters.baseValues.cellMaxBindingEnergy) {
+            CpuCellConnectionProcessor::scheduleDeleteAllConnections(data, threadIndex, index);
+        }
+
+        auto cellMaxAge = parameters.cellMaxAge[cell.color];
+        if (cellMaxAge > 0 && cell.age > cellMaxAge) {
+            if (data.timestep % 20 == index % 20) {  //slow down destruction process to avoid too many deletion jobs
+                cellDestruction = true;
+            }
+        }
+
+        if (cellDestruction) {
+            if (parameters.clusterDecay) {
+                cell.livingState = LivingState_Dying;
+            } else {
+                if (data.timestep % 20 == index % 20) {  //slow down destruction process to avoid too many deletion jobs
+                    CpuCellConnectionProcessor::scheduleDeleteCell(data, threadIndex, index);
+                }
+            }
+        }
+    });
+}
+
+void CpuCellProcessor::packConnectionsIfNecessary(CpuSimulationData& data)
+{
+    if (!data.connectionSolver.isPacked()) {
+        data.connectionSolver.pack(data.cells, data.threadPool);
+    }
+}
+
+float2 CpuCellProcessor::calcCollisionForce(CollisionMotion const& collisionMotion, float2 const& posDelta, float2 const& velDelta, float velLength, bool barrier)
+{
+    auto isApproaching = CpuMath::dot(posDelta, velDelta) < 0;
+    auto barrierFactor = barrier ? 2.0f : 1.0f;
+
+    if (velLength > 0.5f && isApproaching) {
+        auto distanceSquared = CpuMath::lengthSquared(posDelta) + 0.25f;
+        return posDelta * CpuMath::dot(velDelta, posDelta) / (-2 * distanceSquared) * barrierFactor;
+    } else {
+        return CpuMath::normalized(posDelta) * (collisionMotion.cellMaxCollisionDistance - CpuMath::length(posDelta))
+            * collisionMotion.cellRepulsionStrength * barrierFactor;
+    }
+}
+
+void CpuCellProcessor::resetDensity(CpuSimulationData& data)
+{
+    std::fill(data.cellDensities.begin(), data.cellDensities.end(), 1.0f);
+}
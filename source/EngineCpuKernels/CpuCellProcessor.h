@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CpuSimulationData.h"
+
+//host counterpart of CellProcessor
+//kernels which add forces to connected or colliding cells on the gpu are written in a gather form here:
+//each cell only writes its own entries such that no atomics are needed and the results are independent of the thread scheduling
+class CpuCellProcessor
+{
+public:
+    static void updateMap(CpuSimulationData& data);
+    static void fillDensityMap(CpuSimulationData& data);
+    static void radiation(CpuSimulationData& data);
+
+    static void collisions(CpuSimulationData& data);
+    static void fluidForces(CpuSimulationData& data);  //replaces collisions for MotionType_Fluid
+    static void checkForces(CpuSimulationData& data);
+    static void applyForces(CpuSimulationData& data);  //prerequisite: data from collisions
+
+    static void calcConnectionForces(CpuSimulationData& data, bool considerAngles);
+    static void checkConnections(CpuSimulationData& data);
+    static void verletPositionUpdate(CpuSimulationData& data);
+    static void verletVelocityUpdate(CpuSimulationData& data);
+
+    static void aging(CpuSimulationData& data);
+    static void livingStateTransition(CpuSimulationData& data);
+
+    static void applyInnerFriction(CpuSimulationData& data);
+    static void applyFriction(CpuSimulationData& data);
+
+    static void decay(CpuSimulationData& data);
+
+    static void resetDensity(CpuSimulationData& data);
+
+private:
+    //the connections are packed at the first call of a time step and stay valid until the velocity update
+    static void packConnectionsIfNecessary(CpuSimulationData& data);
+
+    static float2 calcCollisionForce(CollisionMotion const& collisionMotion, float2 const& posDelta, float2 const& velDelta, float velLength, bool barrier);
+};
@@ -0,0 +1,408 @@
+#include "CpuConnectionSolver.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    auto constexpr CellGrainSize = 1024;
+    auto constexpr BondGrainSize = 4096;
+
+    //the functions below are called for index ranges and only contain loops without branches or library calls such that they are vectorized
+
+    VECTORIZED_FUNCTION void calcDisplacements(
+        int startBond,
+        int endBond,
+        int const* cellIndices,
+        int const* otherIndices,
+        float const* posX,
+        float const* posY,
+        float sizeX,
+        float sizeY,
+        float* RESTRICT displacementX,
+        float* RESTRICT displacementY,
+        float* RESTRICT distances)
+    {
+        for (int b = startBond; b < endBond; ++b) {
+            auto dx = posX[otherIndices[b]] - posX[cellIndices[b]];
+            auto dy = posY[otherIndices[b]] - posY[cellIndices[b]];
+            dx -= sizeX * std::floor(dx / sizeX + 0.5f);
+            dy -= sizeY * std::floor(dy / sizeY + 0.5f);
+            displacementX[b] = dx;
+            displacementY[b] = dy;
+            distances[b] = std::sqrt(dx * dx + dy * dy);
+        }
+    }
+
+    VECTORIZED_FUNCTION void calcSpringForces(
+        int startBond,
+        int endBond,
+        float const* displacementX,
+        float const* displacementY,
+        float const* distances,
+        float const* restDistances,
+        float const* springFactors,
+        float* RESTRICT cellForceX,
+        float* RESTRICT cellForceY)
+    {
+        for (int b = startBond; b < endBond; ++b) {
+            auto dx = displacementX[b];
+            auto dy = displacementY[b];
+            auto distance = distances[b];
+            auto safeDistance = std::max(distance, NEAR_ZERO);
+            auto isNormalizable = distance > NEAR_ZERO;
+            auto normalizedX = isNormalizable ? dx / safeDistance : 1.0f;
+            auto normalizedY = isNormalizable ? dy / safeDistance : 0.0f;
+            auto spring = (distance - restDistances[b]) * springFactors[b];
+            cellForceX[b] = normalizedX * spring;
+            cellForceY[b] = normalizedY * spring;
+        }
+    }
+
+    //prerequisite: cell forces from calcSpringForces
+    VECTORIZED_FUNCTION void calcAngleForces(
+        int startBond,
+        int endBond,
+        int const* prevBonds,
+        float const* displacementX,
+        float const* displacementY,
+        float const* distances,
+        float const* angles,
+        float const* referenceAngles,
+        float const* angleFactors,
+        float cellMinDistance,
+        float* RESTRICT cellForceX,
+        float* RESTRICT cellForceY,
+        float* RESTRICT angleForceX,
+        float* RESTRICT angleForceY,
+        float* RESTRICT prevAngleForceX,
+        float* RESTRICT prevAngleForceY)
+    {
+        for (int b = startBond; b < endBond; ++b) {
+            auto p = prevBonds[b];
+
+            auto actualAngleFromPrevious = angles[b] - angles[p];
+            actualAngleFromPrevious -= actualAngleFromPrevious > 360.0f ? 360.0f : 0.0f;
+            actualAngleFromPrevious += actualAngleFromPrevious < 0.0f ? 360.0f : 0.0f;
+            auto referenceAngleFromPrevious = referenceAngles[b];
+            auto strength = std::abs(referenceAngleFromPrevious - actualAngleFromPrevious) * angleFactors[b];
+            strength *= referenceAngleFromPrevious < actualAngleFromPrevious ? -1.0f : 1.0f;
+
+            auto dx = displacementX[b];
+            auto dy = displacementY[b];
+            auto distance = distances[b];
+            auto safeDistance = std::max(distance, NEAR_ZERO);
+            auto isNormalizable = distance > NEAR_ZERO;
+            auto factor = strength / std::max(distance, cellMinDistance);
+            auto normalizedX = isNormalizable ? dx / safeDistance : 1.0f;
+            auto normalizedY = isNormalizable ? dy / safeDistance : 0.0f;
+
+            auto prevDx = displacementX[p];
+            auto prevDy = displacementY[p];
+            auto prevDistance = distances[p];
+            auto safePrevDistance = std::max(prevDistance, NEAR_ZERO);
+            auto isPrevNormalizable = prevDistance > NEAR_ZERO;
+            auto prevFactor = strength / std::max(prevDistance, cellMinDistance);
+            auto prevNormalizedX = isPrevNormalizable ? prevDx / safePrevDistance : 1.0f;
+            auto prevNormalizedY = isPrevNormalizable ? prevDy / safePrevDistance : 0.0f;
+
+            //force1 is rotated a quarter clockwise, force2 a quarter counterclockwise
+            auto force1X = -normalizedY * factor;
+            auto force1Y = normalizedX * factor;
+            auto force2X = prevNormalizedY * prevFactor;
+            auto force2Y = -prevNormalizedX * prevFactor;
+
+            angleForceX[b] = force1X;
+            angleForceY[b] = force1Y;
+            prevAngleForceX[b] = force2X;
+            prevAngleForceY[b] = force2Y;
+            cellForceX[b] -= force1X + force2X;
+            cellForceY[b] -= force1Y + force2Y;
+        }
+    }
+
+    VECTORIZED_FUNCTION void integratePositions(
+        int startIndex,
+        int endIndex,
+        float const* movable,
+        float const* velX,
+        float const* velY,
+        float timestepSize,
+        float* RESTRICT posX,
+        float* RESTRICT posY,
+        float2* RESTRICT forces,
+        float2* RESTRICT prevForces)
+    {
+        for (int index = startIndex; index < endIndex; ++index) {
+            //movable is 0 or 1 and used as a factor, selects would be compiled to masked loads of the interleaved forces
+            auto isMovable = movable[index];
+            auto forceX = forces[index].x;
+            auto forceY = forces[index].y;
+            auto prevForceX = prevForces[index].x;
+            auto prevForceY = prevForces[index].y;
+            posX[index] += velX[index] * timestepSize + isMovable * forceX * timestepSize * timestepSize / 2;
+            posY[index] += velY[index] * timestepSize + isMovable * forceY * timestepSize * timestepSize / 2;
+            prevForces[index].x = isMovable * forceX + (1.0f - isMovable) * prevForceX;
+            prevForces[index].y = isMovable * forceY + (1.0f - isMovable) * prevForceY;
+            forces[index].x = (1.0f - isMovable) * forceX;
+            forces[index].y = (1.0f - isMovable) * forceY;
+        }
+    }
+
+    VECTORIZED_FUNCTION void integrateVelocities(
+        int startIndex,
+        int endIndex,
+        float const* movable,
+        float2 const* forces,
+        float2 const* prevForces,
+        float timestepSize,
+        float* RESTRICT velX,
+        float* RESTRICT velY)
+    {
+        for (int index = startIndex; index < endIndex; ++index) {
+            auto isMovable = movable[index];
+            velX[index] += isMovable * (forces[index].x + prevForces[index].x) / 2 * timestepSize;
+            velY[index] += isMovable * (forces[index].y + prevForces[index].y) / 2 * timestepSize;
+        }
+    }
+
+    bool isConnectedTo(CellTO const& cell, int otherIndex)
+    {
+        for (int i = 0; i < cell.numConnections; ++i) {
+            if (cell.connections[i].cellIndex == otherIndex) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+void CpuConnectionSolver::pack(std::vector<CellTO> const& cells, ThreadPool& threadPool)
+{
+    auto numCells = toInt(cells.size());
+    _posX.resize(numCells);
+    _posY.resize(numCells);
+    _velX.resize(numCells);
+    _velY.resize(numCells);
+    _movable.resize(numCells);
+    _bondOffsets.resize(numCells + 1);
+    _bondOffsets[0] = 0;
+    for (int index = 0; index < numCells; ++index) {
+        _bondOffsets[index + 1] = _bondOffsets[index] + cells[index].numConnections;
+    }
+
+    auto numBonds = _bondOffsets[numCells];
+    for (auto bondArray : {&_bondCellIndices, &_bondOtherIndices, &_prevBonds, &_nextBonds, &_reverseBonds}) {
+        bondArray->resize(numBonds);
+    }
+    for (auto bondArray :
+         {&_restDistances,
+          &_referenceAngles,
+          &_springFactors,
+          &_angleFactors,
+          &_displacementX,
+          &_displacementY,
+          &_distances,
+          &_angles,
+          &_cellForceX,
+          &_cellForceY,
+          &_angleForceX,
+          &_angleForceY,
+          &_prevAngleForceX,
+          &_prevAngleForceY}) {
+        bondArray->resize(numBonds);
+    }
+
+    threadPool.forEachRange(
+        numCells,
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                auto const& cell = cells[index];
+                _posX[index] = cell.pos.x;
+                _posY[index] = cell.pos.y;
+                _velX[index] = cell.vel.x;
+                _velY[index] = cell.vel.y;
+                _movable[index] = cell.barrier ? 0.0f : 1.0f;
+
+                auto numConnections = cell.numConnections;
+                auto cellStiffnessSquared = cell.stiffness * cell.stiffness;
+                auto offset = _bondOffsets[index];
+                for (int i = 0; i < numConnections; ++i) {
+                    auto b = offset + i;
+                    auto const& connection = cell.connections[i];
+                    auto const& connectedCell = cells[connection.cellIndex];
+                    auto lastIndex = (i + numConnections - 1) % numConnections;
+
+                    _bondCellIndices[b] = index;
+                    _bondOtherIndices[b] = connection.cellIndex;
+                    _prevBonds[b] = offset + lastIndex;
+                    _nextBonds[b] = offset + (i + 1) % numConnections;
+                    _reverseBonds[b] = -1;
+                    for (int j = 0; j < connectedCell.numConnections; ++j) {
+                        if (connectedCell.connections[j].cellIndex == index) {
+                            _reverseBonds[b] = _bondOffsets[connection.cellIndex] + j;
+                            break;
+                        }
+                    }
+                    _restDistances[b] = connection.distance;
+                    _referenceAngles[b] = connection.angleFromPrevious;
+
+                    //no forces on barriers and no angle forces in case of triangular connections
+                    auto connectedCellStiffnessSquared = connectedCell.stiffness * connectedCell.stiffness;
+                    _springFactors[b] = cell.barrier ? 0.0f : (cellStiffnessSquared + connectedCellStiffnessSquared) / 6;
+                    auto hasAngleForces = !cell.barrier && (numConnections > 2 || (numConnections == 2 && i == 0))
+                        && !isConnectedTo(connectedCell, cell.connections[lastIndex].cellIndex);
+                    _angleFactors[b] = hasAngleForces ? cellStiffnessSquared / 2000 : 0.0f;
+                }
+            }
+        },
+        CellGrainSize);
+
+    _packed = true;
+}
+
+void CpuConnectionSolver::calcForces(std::vector<float2>& cellForces, CpuBaseMap const& map, bool considerAngles, float cellMinDistance, ThreadPool& threadPool)
+{
+    auto worldSize = map.getSize();
+    threadPool.forEachRange(
+        getNumBonds(),
+        [&](int, int startBond, int endBond) {
+            calcDisplacements(
+                startBond,
+                endBond,
+                _bondCellIndices.data(),
+                _bondOtherIndices.data(),
+                _posX.data(),
+                _posY.data(),
+                toFloat(worldSize.x),
+                toFloat(worldSize.y),
+                _displacementX.data(),
+                _displacementY.data(),
+                _distances.data());
+            calcSpringForces(
+                startBond,
+                endBond,
+                _displacementX.data(),
+                _displacementY.data(),
+                _distances.data(),
+                _restDistances.data(),
+                _springFactors.data(),
+                _cellForceX.data(),
+                _cellForceY.data());
+        },
+        BondGrainSize);
+
+    if (considerAngles) {
+
+        //the angles are calculated beforehand as asin is not vectorized
+        threadPool.forEachRange(
+            getNumBonds(),
+            [&](int, int startBond, int endBond) {
+                for (int b = startBond; b < endBond; ++b) {
+                    _angles[b] = CpuMath::angleOfVector({_displacementX[b], _displacementY[b]});
+                }
+            },
+            BondGrainSize);
+        threadPool.forEachRange(
+            getNumBonds(),
+            [&](int, int startBond, int endBond) {
+                calcAngleForces(
+                    startBond,
+                    endBond,
+                    _prevBonds.data(),
+                    _displacementX.data(),
+                    _displacementY.data(),
+                    _distances.data(),
+                    _angles.data(),
+                    _referenceAngles.data(),
+                    _angleFactors.data(),
+                    cellMinDistance,
+                    _cellForceX.data(),
+                    _cellForceY.data(),
+                    _angleForceX.data(),
+                    _angleForceY.data(),
+                    _prevAngleForceX.data(),
+                    _prevAngleForceY.data());
+            },
+            BondGrainSize);
+    }
+
+    //each cell collects the forces of its own bonds and the angle forces of the bonds pointing to it
+    threadPool.forEachRange(
+        toInt(_movable.size()),
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                if (_movable[index] == 0.0f) {
+                    continue;
+                }
+                float2 force{0, 0};
+                for (int b = _bondOffsets[index], end = _bondOffsets[index + 1]; b < end; ++b) {
+                    force += float2{_cellForceX[b], _cellForceY[b]};
+                }
+                if (considerAngles) {
+                    for (int b = _bondOffsets[index], end = _bondOffsets[index + 1]; b < end; ++b) {
+                        auto reverseBond = _reverseBonds[b];
+                        if (reverseBond == -1) {
+                            continue;
+                        }
+                        auto nextBond = _nextBonds[reverseBond];
+                        force += float2{_angleForceX[reverseBond] + _prevAngleForceX[nextBond], _angleForceY[reverseBond] + _prevAngleForceY[nextBond]};
+                    }
+                }
+                cellForces[index] += force;
+            }
+        },
+        CellGrainSize);
+}
+
+void CpuConnectionSolver::verletPositionUpdate(
+    std::vector<CellTO>& cells,
+    std::vector<float2>& cellForces,
+    std::vector<float2>& cellPrevForces,
+    CpuBaseMap const& map,
+    float timestepSize,
+    ThreadPool& threadPool)
+{
+    threadPool.forEachRange(
+        toInt(cells.size()),
+        [&](int, int startIndex, int endIndex) {
+            integratePositions(
+                startIndex,
+                endIndex,
+                _movable.data(),
+                _velX.data(),
+                _velY.data(),
+                timestepSize,
+                _posX.data(),
+                _posY.data(),
+                cellForces.data(),
+                cellPrevForces.data());
+            for (int index = startIndex; index < endIndex; ++index) {
+                float2 pos{_posX[index], _posY[index]};
+                map.correctPosition(pos);
+                _posX[index] = pos.x;
+                _posY[index] = pos.y;
+                cells[index].pos = pos;
+            }
+        },
+        CellGrainSize);
+}
+
+void CpuConnectionSolver::verletVelocityUpdate(
+    std::vector<CellTO>& cells,
+    std::vector<float2> const& cellForces,
+    std::vector<float2> const& cellPrevForces,
+    float timestepSize,
+    ThreadPool& threadPool)
+{
+    threadPool.forEachRange(
+        toInt(cells.size()),
+        [&](int, int startIndex, int endIndex) {
+            integrateVelocities(
+                startIndex, endIndex, _movable.data(), cellForces.data(), cellPrevForces.data(), timestepSize, _velX.data(), _velY.data());
+            for (int index = startIndex; index < endIndex; ++index) {
+                cells[index].vel = {_velX[index], _velY[index]};
+            }
+        },
+        CellGrainSize);
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+
+#include "Base/ThreadPool.h"
+#include "EngineInterface/TOs.h"
+
+#include "CpuMap.h"
+
+//connection forces and verlet integration on packed data:
+//the positions and velocities of the cells and the bonds with their endpoints, rest distances and reference angles are held in structure of arrays buffers
+//such that the per-bond terms and the integration are evaluated in vectorized loops instead of visiting the MAX_CELL_BONDS slots of each CellTO
+//the cells are only read when packing, positions and velocities are written back after each integration step
+class CpuConnectionSolver
+{
+public:
+    //captures the cells and their bonds, the connections and stiffnesses must not change until the next call
+    void pack(std::vector<CellTO> const& cells, ThreadPool& threadPool);
+    void invalidate() { _packed = false; }
+    bool isPacked() const { return _packed; }
+
+    int getNumBonds() const { return toInt(_bondCellIndices.size()); }
+
+    //adds the spring forces and, if considerAngles is set, the angle forces to cellForces in the same manner as CellProcessor::calcConnectionForces
+    void calcForces(std::vector<float2>& cellForces, CpuBaseMap const& map, bool considerAngles, float cellMinDistance, ThreadPool& threadPool);
+
+    void verletPositionUpdate(
+        std::vector<CellTO>& cells,
+        std::vector<float2>& cellForces,
+        std::vector<float2>& cellPrevForces,
+        CpuBaseMap const& map,
+        float timestepSize,
+        ThreadPool& threadPool);
+    void verletVelocityUpdate(
+        std::vector<CellTO>& cells,
+        std::vector<float2> const& cellForces,
+        std::vector<float2> const& cellPrevForces,
+        float timestepSize,
+        ThreadPool& threadPool);
+
+private:
+    bool _packed = false;
+
+    //per cell
+    std::vector<float> _posX;
+    std::vector<float> _posY;
+    std::vector<float> _velX;
+    std::vector<float> _velY;
+    std::vector<float> _movable;     //0 for barriers, 1 otherwise
+    std::vector<int> _bondOffsets;  //offsets into the bond arrays, one more entry than cells
+
+    //per bond, the bonds of a cell are stored in the order of its connections
+    std::vector<int> _bondCellIndices;
+    std::vector<int> _bondOtherIndices;
+    std::vector<int> _prevBonds;     //bond to the previous connection of the same cell
+    std::vector<int> _nextBonds;     //bond to the next connection of the same cell
+    std::vector<int> _reverseBonds;  //bond from the connected cell back to the cell or -1
+    std::vector<float> _restDistances;
+    std::vector<float> _referenceAngles;
+    std::vector<float> _springFactors;  //includes the stiffnesses of both cells, 0 for bonds of barriers
+    std::vector<float> _angleFactors;   //0 for bonds without angle forces (barriers, triangles, one of two connections)
+
+    //per bond results of a calcForces call
+    std::vector<float> _displacementX;
+    std::vector<float> _displacementY;
+    std::vector<float> _distances;
+    std::vector<float> _angles;
+    std::vector<float> _cellForceX;  //spring force minus the reactions of the angle forces, acts on the cell of the bond
+    std::vector<float> _cellForceY;
+    std::vector<float> _angleForceX;  //angle force acting on the connected cell
+    std::vector<float> _angleForceY;
+    std::vector<float> _prevAngleForceX;  //angle force acting on the cell connected by the previous bond
+    std::vector<float> _prevAngleForceY;
+};
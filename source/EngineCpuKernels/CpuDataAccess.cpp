@@ -0,0 +1,210 @@
+#include "CpuDataAccess.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "CpuEditOperations.h"
+
+namespace
+{
+    bool isContainedInRect(int2 const& rectUpperLeft, int2 const& rectLowerRight, float2 const& pos)
+    {
+        return CpuMath::isContainedInRect({toFloat(rectUpperLeft.x), toFloat(rectUpperLeft.y)}, {toFloat(rectLowerRight.x), toFloat(rectLowerRight.y)}, pos);
+    }
+}
+
+void CpuDataAccess::getData(CpuSimulationData& data, int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
+{
+    getData(
+        data,
+        dataTO,
+        [&](CellTO const& cell) { return isContainedInRect(rectUpperLeft, rectLowerRight, cell.pos); },
+        [&](ParticleTO const& particle) { return isContainedInRect(rectUpperLeft, rectLowerRight, particle.pos); });
+}
+
+void CpuDataAccess::getSelectedData(CpuSimulationData& data, bool includeClusters, DataTO const& dataTO)
+{
+    getData(
+        data,
+        dataTO,
+        [&](CellTO const& cell) { return (includeClusters && cell.selected != 0) || (!includeClusters && cell.selected == 1); },
+        [](ParticleTO const& particle) { return particle.selected != 0; });
+}
+
+void CpuDataAccess::getInspectedData(CpuSimulationData& data, std::vector<uint64_t> const& entityIds, DataTO const& dataTO)
+{
+    auto isInspected = [&](uint64_t id) { return std::find(entityIds.begin(), entityIds.end(), id) != entityIds.end(); };
+    getData(
+        data, dataTO, [&](CellTO const& cell) { return isInspected(cell.id); }, [&](ParticleTO const& particle) { return isInspected(particle.id); });
+}
+
+void CpuDataAccess::getOverlayData(CpuSimulationData const& data, int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
+{
+    clearDataTO(dataTO);
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        auto const& cell = data.cells[index];
+        if (data.cellRemoved[index] || !isContainedInRect(rectUpperLeft, rectLowerRight, cell.pos)) {
+            continue;
+        }
+        auto& cellTO = dataTO.cells[(*dataTO.numCells)++];
+        cellTO.id = cell.id;
+        cellTO.pos = cell.pos;
+        cellTO.cellFunction = cell.cellFunction;
+        cellTO.selected = cell.selected;
+        cellTO.executionOrderNumber = cell.executionOrderNumber;
+    }
+    for (int index = 0; index < data.getNumParticles(); ++index) {
+        auto const& particle = data.particles[index];
+        if (data.particleRemoved[index] || !isContainedInRect(rectUpperLeft, rectLowerRight, particle.pos)) {
+            continue;
+        }
+        auto& particleTO = dataTO.particles[(*dataTO.numParticles)++];
+        particleTO.id = particle.id;
+        particleTO.pos = particle.pos;
+        particleTO.selected = particle.selected;
+    }
+}
+
+void CpuDataAccess::addData(CpuSimulationData& data, DataTO const& dataTO, bool selectData, bool createIds)
+{
+    auto numCellsTO = toInt(*dataTO.numCells);
+    auto numParticlesTO = toInt(*dataTO.numParticles);
+    for (int i = 0; i < numCellsTO; ++i) {
+        data.adaptMaxId(dataTO.cells[i].id);
+        data.adaptMaxSmallId(dataTO.cells[i].mutationId);
+    }
+    for (int i = 0; i < numParticlesTO; ++i) {
+        data.adaptMaxId(dataTO.particles[i].id);
+    }
+
+    for (int i = 0; i < numParticlesTO; ++i) {
+        auto particle = dataTO.particles[i];
+        if (createIds) {
+            particle.id = data.createNewId();
+        }
+        particle.selected = selectData ? 1 : 0;
+        data.addParticle(particle);
+    }
+
+    //the auxiliary data is copied as a whole and the references are shifted accordingly
+    auto auxiliaryDataOffset = data.addAuxiliaryData(dataTO.auxiliaryData, *dataTO.numAuxiliaryData);
+    auto cellIndexOffset = data.getNumCells();
+    for (int i = 0; i < numCellsTO; ++i) {
+        auto cell = dataTO.cells[i];
+        if (cell.cellFunction == CellFunction_Constructor) {
+            cell.cellFunctionData.constructor.genomeSize %= MAX_GENOME_BYTES;
+        }
+        CpuSimulationData::forEachAuxiliaryDataReference(cell, [&](uint64_t& dataIndex, uint64_t) { dataIndex += auxiliaryDataOffset; });
+        for (int j = 0; j < cell.numConnections; ++j) {
+            cell.connections[j].cellIndex += cellIndexOffset;
+        }
+        if (createIds) {
+            cell.id = data.createNewId();
+        }
+        cell.selected = selectData ? 1 : 0;
+        data.addCell(cell);
+    }
+
+    if (selectData) {
+        CpuEditOperations::rolloutSelection(data);
+    }
+}
+
+void CpuDataAccess::changeData(CpuSimulationData& data, DataTO const& changeDataTO)
+{
+    if (*changeDataTO.numCells == 1) {
+        auto const& cellTO = changeDataTO.cells[0];
+        for (auto& cell : data.cells) {
+            if (cell.id == cellTO.id) {
+                changeCellFromTO(data, changeDataTO, cellTO, cell);
+            }
+        }
+    }
+    if (*changeDataTO.numParticles == 1) {
+        auto const& particleTO = changeDataTO.particles[0];
+        for (auto& particle : data.particles) {
+            if (particle.id == particleTO.id) {
+                particle.energy = particleTO.energy;
+                particle.pos = particleTO.pos;
+                particle.color = particleTO.color;
+                data.particleMap.correctPosition(particle.pos);
+            }
+        }
+    }
+}
+
+template <typename CellPredicate, typename ParticlePredicate>
+void CpuDataAccess::getData(CpuSimulationData& data, DataTO const& dataTO, CellPredicate const& cellPredicate, ParticlePredicate const& particlePredicate)
+{
+    clearDataTO(dataTO);
+
+    //cellTOIndices[index] is the index of the exported cell or -1 such that connections to cells which are not exported are marked with -1
+    std::vector<int> cellTOIndices(data.cells.size(), -1);
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        auto const& cell = data.cells[index];
+        if (data.cellRemoved[index] || !cellPredicate(cell)) {
+            continue;
+        }
+        cellTOIndices[index] = toInt(*dataTO.numCells);
+        createCellTO(data, cell, dataTO);
+    }
+    for (uint64_t i = 0; i < *dataTO.numCells; ++i) {
+        auto& cellTO = dataTO.cells[i];
+        for (int j = 0; j < cellTO.numConnections; ++j) {
+            cellTO.connections[j].cellIndex = cellTOIndices[cellTO.connections[j].cellIndex];
+        }
+    }
+
+    for (int index = 0; index < data.getNumParticles(); ++index) {
+        auto const& particle = data.particles[index];
+        if (!data.particleRemoved[index] && particlePredicate(particle)) {
+            createParticleTO(particle, dataTO);
+        }
+    }
+}
+
+void CpuDataAccess::clearDataTO(DataTO const& dataTO)
+{
+    *dataTO.numCells = 0;
+    *dataTO.numParticles = 0;
+    *dataTO.numAuxiliaryData = 0;
+}
+
+void CpuDataAccess::createCellTO(CpuSimulationData const& data, CellTO const& cell, DataTO const& dataTO)
+{
+    auto& cellTO = dataTO.cells[(*dataTO.numCells)++];
+    cellTO = cell;
+    CpuSimulationData::forEachAuxiliaryDataReference(cellTO, [&](uint64_t& dataIndex, uint64_t size) {
+        auto targetIndex = *dataTO.numAuxiliaryData;
+        std::memcpy(dataTO.auxiliaryData + targetIndex, data.auxiliaryData.data() + dataIndex, size);
+        *dataTO.numAuxiliaryData += size;
+        dataIndex = targetIndex;
+    });
+}
+
+void CpuDataAccess::createParticleTO(ParticleTO const& particle, DataTO const& dataTO)
+{
+    auto& particleTO = dataTO.particles[(*dataTO.numParticles)++];
+    particleTO.id = particle.id;
+    particleTO.pos = particle.pos;
+    particleTO.vel = particle.vel;
+    particleTO.energy = particle.energy;
+    particleTO.color = particle.color;
+}
+
+void CpuDataAccess::changeCellFromTO(CpuSimulationData& data, DataTO const& dataTO, CellTO const& cellTO, CellTO& cell)
+{
+    //connections and selection are not part of the change
+    auto origCell = cell;
+    cell = cellTO;
+    cell.numConnections = origCell.numConnections;
+    std::copy(origCell.connections, origCell.connections + MAX_CELL_BONDS, cell.connections);
+    cell.selected = origCell.selected;
+
+    if (cell.cellFunction == CellFunction_Constructor) {
+        cell.cellFunctionData.constructor.genomeSize %= MAX_GENOME_BYTES;
+    }
+    CpuSimulationData::forEachAuxiliaryDataReference(
+        cell, [&](uint64_t& dataIndex, uint64_t size) { dataIndex = data.addAuxiliaryData(dataTO.auxiliaryData + dataIndex, size); });
+    data.cellMap.correctPosition(cell.pos);
+}
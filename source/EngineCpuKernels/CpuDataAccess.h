@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector>
+
+#include "CpuSimulationData.h"
+
+//host counterpart of DataAccessKernels: exports objects into and imports them from transfer objects
+//the arrays in the transfer objects are expected to be large enough for the requested data as with the gpu backend
+class CpuDataAccess
+{
+public:
+    static void getData(CpuSimulationData& data, int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
+    static void getSelectedData(CpuSimulationData& data, bool includeClusters, DataTO const& dataTO);
+    static void getInspectedData(CpuSimulationData& data, std::vector<uint64_t> const& entityIds, DataTO const& dataTO);
+    static void getOverlayData(CpuSimulationData const& data, int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
+
+    static void addData(CpuSimulationData& data, DataTO const& dataTO, bool selectData, bool createIds);
+
+    //changes the cell or particle with the same id as the single entry in changeDataTO
+    static void changeData(CpuSimulationData& data, DataTO const& changeDataTO);
+
+private:
+    template <typename CellPredicate, typename ParticlePredicate>
+    static void getData(CpuSimulationData& data, DataTO const& dataTO, CellPredicate const& cellPredicate, ParticlePredicate const& particlePredicate);
+
+    static void clearDataTO(DataTO const& dataTO);
+    static void createCellTO(CpuSimulationData const& data, CellTO const& cell, DataTO const& dataTO);
+    static void createParticleTO(ParticleTO const& particle, DataTO const& dataTO);
+    static void changeCellFromTO(CpuSimulationData& data, DataTO const& dataTO, CellTO const& cellTO, CellTO& cell);
+};
@@ -0,0 +1,228 @@
+#include "CpuDensityMap.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+
+#include "EngineInterface/Colors.h"
+
+namespace
+{
+    //adds the 8 byte counters of a and b in parallel, counters which overflow are set to 255
+    uint64_t addSaturated(uint64_t a, uint64_t b)
+    {
+        auto constexpr HighBits = 0x8080808080808080ull;
+        auto sum = ((a & ~HighBits) + (b & ~HighBits)) ^ ((a ^ b) & HighBits);
+        auto overflows = ((a & b) | ((a | b) & ~sum)) & HighBits;
+        return sum | ((overflows >> 7) * 0xff);
+    }
+
+    float calcPeriodicDistance(float value, float start, float end, float period)
+    {
+        value -= std::floor(value / period) * period;
+        auto result = std::numeric_limits<float>::max();
+        for (auto shift : {-period, 0.0f, period}) {
+            result = std::min(result, std::max({start + shift - value, value - end - shift, 0.0f}));
+        }
+        return result;
+    }
+}
+
+void CpuDensityMap::init(int2 const& worldSize, int slotSize)
+{
+    _slotSizeBits = std::countr_zero(static_cast<uint32_t>(slotSize));
+    _size = {worldSize.x / slotSize, worldSize.y / slotSize};
+    _worldSize = {toFloat(worldSize.x), toFloat(worldSize.y)};
+
+    auto levelSize = _size;
+    for (auto& level : _levels) {
+        level.size = levelSize;
+        level.densities.assign(levelSize.x * levelSize.y, 0);
+        levelSize = {(levelSize.x + 1) / 2, (levelSize.y + 1) / 2};
+    }
+}
+
+void CpuDensityMap::update(std::vector<CellTO> const& cells, std::vector<uint8_t> const& cellRemoved, ThreadPool& threadPool)
+{
+    auto& slots = _levels[0].densities;
+    auto numSlots = toInt(slots.size());
+    std::fill(slots.begin(), slots.end(), 0);
+
+    //the saturated additions of 1 commute, hence the counts do not depend on the thread scheduling
+    threadPool.forEachRange(
+        toInt(cells.size()),
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                if (cellRemoved[index]) {
+                    continue;
+                }
+                auto const& cell = cells[index];
+                auto slotIndex = getSlotIndex(cell.pos);
+                if (slotIndex >= 0 && slotIndex < numSlots) {
+                    auto color = ((cell.color % MAX_COLORS) + MAX_COLORS) % MAX_COLORS;
+                    auto increment = uint64_t(1) << (color * 8);
+                    std::atomic_ref<uint64_t> slot(slots[slotIndex]);
+                    auto origDensities = slot.load(std::memory_order_relaxed);
+                    while (!slot.compare_exchange_weak(origDensities, addSaturated(origDensities, increment), std::memory_order_relaxed)) {
+                    }
+                }
+            }
+        },
+        4096);
+
+    for (int levelIndex = 1; levelIndex < NumLevels; ++levelIndex) {
+        auto const& finerLevel = _levels[levelIndex - 1];
+        auto& level = _levels[levelIndex];
+        threadPool.forEachRange(
+            level.size.y,
+            [&](int, int startY, int endY) {
+                for (int y = startY; y < endY; ++y) {
+                    for (int x = 0; x < level.size.x; ++x) {
+                        uint64_t densities = 0;
+                        for (int finerY = y * 2; finerY < std::min(y * 2 + 2, finerLevel.size.y); ++finerY) {
+                            for (int finerX = x * 2; finerX < std::min(x * 2 + 2, finerLevel.size.x); ++finerX) {
+                                densities = addSaturated(densities, finerLevel.densities[finerX + finerY * finerLevel.size.x]);
+                            }
+                        }
+                        level.densities[x + y * level.size.x] = densities;
+                    }
+                }
+            },
+            16);
+    }
+}
+
+uint32_t CpuDensityMap::getBlockDensity(float2 const& pos, int color, int levelIndex) const
+{
+    auto slotX = toInt(pos.x) >> _slotSizeBits;
+    auto slotY = toInt(pos.y) >> _slotSizeBits;
+    if (slotX < 0 || slotX >= _size.x || slotY < 0 || slotY >= _size.y) {
+        return 0;
+    }
+    auto const& level = _levels[levelIndex];
+    return (level.densities[(slotX >> levelIndex) + (slotY >> levelIndex) * level.size.x] >> (color * 8)) & 0xff;
+}
+
+bool CpuDensityMap::isEmpty(float2 const& pos, int color, float2& blockStart, float2& blockEnd) const
+{
+    blockStart = pos;
+    blockEnd = pos;
+    auto slotX = toInt(pos.x) >> _slotSizeBits;
+    auto slotY = toInt(pos.y) >> _slotSizeBits;
+    if (slotX < 0 || slotX >= _size.x || slotY < 0 || slotY >= _size.y) {
+        //remaining units of a world size which is not a multiple of the slot size are addressed as in getDensity
+        return getDensity(pos, color) == 0;
+    }
+
+    //saturated counts are only 0 if all summands are 0
+    for (int levelIndex = NumLevels - 1; levelIndex >= 0; --levelIndex) {
+        if (getBlockDensity(pos, color, levelIndex) == 0) {
+            getBlock(levelIndex, slotX >> levelIndex, slotY >> levelIndex, blockStart, blockEnd);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CpuDensityMap::findNearestNonEmptyRegion(float2 const& pos, int color, float maxDistance, float2& regionStart, float2& regionEnd) const
+{
+    //best-first search through the pyramid: a block is never nearer than the block containing it,
+    //hence the first slot taken from the queue is a nearest one
+    struct Candidate
+    {
+        float distance;
+        int levelIndex;
+        int x;
+        int y;
+
+        bool operator>(Candidate const& other) const
+        {
+            return std::tie(distance, levelIndex, y, x) > std::tie(other.distance, other.levelIndex, other.y, other.x);
+        }
+    };
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> candidates;
+
+    auto addCandidateIfNonEmpty = [&](int levelIndex, int x, int y) {
+        auto const& level = _levels[levelIndex];
+        if (((level.densities[x + y * level.size.x] >> (color * 8)) & 0xff) == 0) {
+            return;
+        }
+        float2 blockStart;
+        float2 blockEnd;
+        getBlock(levelIndex, x, y, blockStart, blockEnd);
+        auto distanceX = calcPeriodicDistance(pos.x, blockStart.x, blockEnd.x, _worldSize.x);
+        auto distanceY = calcPeriodicDistance(pos.y, blockStart.y, blockEnd.y, _worldSize.y);
+        auto distance = std::sqrt(distanceX * distanceX + distanceY * distanceY);
+        if (distance <= maxDistance) {
+            candidates.push({distance, levelIndex, x, y});
+        }
+    };
+
+    auto topLevelIndicesX = getTopLevelIndices(pos.x, maxDistance, _worldSize.x, _size.x);
+    auto topLevelIndicesY = getTopLevelIndices(pos.y, maxDistance, _worldSize.y, _size.y);
+    for (auto y : topLevelIndicesY) {
+        for (auto x : topLevelIndicesX) {
+            addCandidateIfNonEmpty(NumLevels - 1, x, y);
+        }
+    }
+    while (!candidates.empty()) {
+        auto candidate = candidates.top();
+        candidates.pop();
+        if (candidate.levelIndex == 0) {
+            getBlock(0, candidate.x, candidate.y, regionStart, regionEnd);
+            return true;
+        }
+        auto const& finerLevel = _levels[candidate.levelIndex - 1];
+        for (int finerY = candidate.y * 2; finerY < std::min(candidate.y * 2 + 2, finerLevel.size.y); ++finerY) {
+            for (int finerX = candidate.x * 2; finerX < std::min(candidate.x * 2 + 2, finerLevel.size.x); ++finerX) {
+                addCandidateIfNonEmpty(candidate.levelIndex - 1, finerX, finerY);
+            }
+        }
+    }
+    return false;
+}
+
+std::vector<int> CpuDensityMap::getTopLevelIndices(float value, float maxDistance, float worldSize, int numSlots) const
+{
+    auto numBlocks = (numSlots + (1 << (NumLevels - 1)) - 1) >> (NumLevels - 1);
+    std::vector<int> result;
+    if (maxDistance * 2 >= worldSize) {
+        for (int index = 0; index < numBlocks; ++index) {
+            result.emplace_back(index);
+        }
+        return result;
+    }
+
+    //each slot overlapping the interval contains one of the sample points which lie a slot size apart
+    auto slotSize = toFloat(1 << _slotSizeBits);
+    auto end = value + maxDistance;
+    for (auto sample = value - maxDistance;; sample = std::min(sample + slotSize, end)) {
+        auto correctedSample = sample - std::floor(sample / worldSize) * worldSize;
+        auto slot = correctedSample < worldSize ? toInt(correctedSample) >> _slotSizeBits : 0;
+        if (slot < numSlots) {
+            auto index = slot >> (NumLevels - 1);
+            if (std::find(result.begin(), result.end(), index) == result.end()) {
+                result.emplace_back(index);
+            }
+        }
+        if (sample >= end) {
+            break;
+        }
+    }
+    return result;
+}
+
+void CpuDensityMap::getBlock(int levelIndex, int x, int y, float2& blockStart, float2& blockEnd) const
+{
+    auto startX = x << levelIndex;
+    auto startY = y << levelIndex;
+    auto endX = std::min(startX + (1 << levelIndex), _size.x);
+    auto endY = std::min(startY + (1 << levelIndex), _size.y);
+    blockStart = {toFloat(startX << _slotSizeBits), toFloat(startY << _slotSizeBits)};
+    blockEnd = {toFloat(endX << _slotSizeBits), toFloat(endY << _slotSizeBits)};
+}
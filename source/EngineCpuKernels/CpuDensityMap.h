@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/ThreadPool.h"
+#include "EngineInterface/TOs.h"
+
+//host counterpart of DensityMap: the cells of each color are counted in slots of slotSize x slotSize units with 8 bits per color
+//on top of the slots a pyramid of coarser levels stores the counts of blocks of 2^level x 2^level slots in the same layout
+//all counts saturate at 255 instead of overflowing into the next color
+class CpuDensityMap
+{
+public:
+    static auto constexpr DefaultSlotSize = 8;
+    static auto constexpr NumLevels = 6;  //including the slots as level 0, the top blocks of 256 units cover the default sensor range
+    static auto constexpr MaxDensity = 255;
+
+    //slotSize has to be a power of two
+    void init(int2 const& worldSize, int slotSize = DefaultSlotSize);
+
+    //cells with a non-zero entry in cellRemoved are skipped
+    void update(std::vector<CellTO> const& cells, std::vector<uint8_t> const& cellRemoved, ThreadPool& threadPool);
+
+    //same slot addressing as on the gpu, positions outside of the slots yield 0
+    uint32_t getDensity(float2 const& pos, int color) const
+    {
+        auto index = getSlotIndex(pos);
+        if (index >= 0 && index < _size.x * _size.y) {
+            return (_levels[0].densities[index] >> (color * 8)) & 0xff;
+        }
+        return 0;
+    }
+
+    //saturated count of the cells of the color in the block of the level containing pos, positions outside of the slots yield 0
+    uint32_t getBlockDensity(float2 const& pos, int color, int levelIndex) const;
+
+    //true if getDensity(pos, color) is 0, in this case [blockStart, blockEnd) receives the largest block of the pyramid
+    //around pos without cells of the color (it can be degenerated to pos itself outside of the slots)
+    bool isEmpty(float2 const& pos, int color, float2& blockStart, float2& blockEnd) const;
+
+    //searches the slot with cells of the color nearest to pos, measured to the slot boundary with periodic world boundaries
+    //returns false if there is none within maxDistance, otherwise [regionStart, regionEnd) receives the slot
+    bool findNearestNonEmptyRegion(float2 const& pos, int color, float maxDistance, float2& regionStart, float2& regionEnd) const;
+
+private:
+    struct Level
+    {
+        int2 size;
+        std::vector<uint64_t> densities;
+    };
+
+    //shifts instead of the divisions on the gpu, both agree for the non-negative coordinates of corrected positions
+    int getSlotIndex(float2 const& pos) const { return (toInt(pos.x) >> _slotSizeBits) + (toInt(pos.y) >> _slotSizeBits) * _size.x; }
+
+    //indices of the top level blocks along an axis which overlap [value - maxDistance, value + maxDistance] with periodic boundaries
+    std::vector<int> getTopLevelIndices(float value, float maxDistance, float worldSize, int numSlots) const;
+    void getBlock(int levelIndex, int x, int y, float2& blockStart, float2& blockEnd) const;
+
+    int _slotSizeBits = 3;
+    int2 _size{0, 0};
+    float2 _worldSize{0, 0};
+    Level _levels[NumLevels];  //_levels[0] contains the slots
+};
@@ -0,0 +1,512 @@
+#include "CpuEditOperations.h"
+
+#include "EngineInterface/GenomeMutationProcessor.h"
+
+#include "CpuCellConnectionProcessor.h"
+#include "CpuCellProcessor.h"
+#include "CpuGarbageCollector.h"
+#include "CpuRandom.h"
+
+void CpuEditOperations::removeSelection(CpuSimulationData& data)
+{
+    for (auto& cell : data.cells) {
+        cell.selected = 0;
+    }
+    for (auto& particle : data.particles) {
+        particle.selected = 0;
+    }
+}
+
+void CpuEditOperations::swapSelection(CpuSimulationData& data, PointSelectionData const& selectionData)
+{
+    updateSelection(data);
+    for (auto& cell : data.cells) {
+        if (data.cellMap.getDistance(selectionData.pos, cell.pos) < selectionData.radius) {
+            if (cell.selected == 0) {
+                cell.selected = 1;
+            } else if (cell.selected == 1) {
+                cell.selected = 0;
+            }
+        }
+    }
+    for (auto& particle : data.particles) {
+        if (data.particleMap.getDistance(selectionData.pos, particle.pos) < selectionData.radius) {
+            particle.selected = 1 - particle.selected;
+        }
+    }
+    rolloutSelection(data);
+}
+
+void CpuEditOperations::switchSelection(CpuSimulationData& data, PointSelectionData const& selectionData)
+{
+    for (auto const& cell : data.cells) {
+        if (1 == cell.selected && data.cellMap.getDistance(selectionData.pos, cell.pos) < selectionData.radius) {
+            return;
+        }
+    }
+    for (auto const& particle : data.particles) {
+        if (1 == particle.selected && data.cellMap.getDistance(selectionData.pos, particle.pos) < selectionData.radius) {
+            return;
+        }
+    }
+
+    for (auto& cell : data.cells) {
+        cell.selected = data.cellMap.getDistance(selectionData.pos, cell.pos) < selectionData.radius ? 1 : 0;
+    }
+    for (auto& particle : data.particles) {
+        particle.selected = data.particleMap.getDistance(selectionData.pos, particle.pos) < selectionData.radius ? 1 : 0;
+    }
+    rolloutSelection(data);
+}
+
+void CpuEditOperations::setSelection(CpuSimulationData& data, AreaSelectionData const& selectionData)
+{
+    for (auto& cell : data.cells) {
+        cell.selected = CpuMath::isContainedInRect(selectionData.startPos, selectionData.endPos, cell.pos) ? 1 : 0;
+    }
+    for (auto& particle : data.particles) {
+        particle.selected = CpuMath::isContainedInRect(selectionData.startPos, selectionData.endPos, particle.pos) ? 1 : 0;
+    }
+    rolloutSelection(data);
+}
+
+void CpuEditOperations::updateSelection(CpuSimulationData& data)
+{
+    for (auto& cell : data.cells) {
+        if (cell.selected == 2) {
+            cell.selected = 0;
+        }
+    }
+    for (auto& particle : data.particles) {
+        if (particle.selected == 2) {
+            particle.selected = 0;
+        }
+    }
+    rolloutSelection(data);
+}
+
+void CpuEditOperations::rolloutSelection(CpuSimulationData& data)
+{
+    //breadth-first search instead of the repeated heuristic steps on the gpu
+    std::vector<int> cellIndices;
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        if (data.cells[index].selected != 0) {
+            cellIndices.emplace_back(index);
+        }
+    }
+    while (!cellIndices.empty()) {
+        auto const& cell = data.cells[cellIndices.back()];
+        cellIndices.pop_back();
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto connectedCellIndex = cell.connections[i].cellIndex;
+            auto& connectedCell = data.cells[connectedCellIndex];
+            if (connectedCell.selected == 0) {
+                connectedCell.selected = 2;
+                cellIndices.emplace_back(connectedCellIndex);
+            }
+        }
+    }
+}
+
+SelectionShallowData CpuEditOperations::getSelectionShallowData(CpuSimulationData const& data)
+{
+    SelectionShallowData result;
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        auto const& cell = data.cells[index];
+        if (0 == cell.selected || data.cellRemoved[index]) {
+            continue;
+        }
+        if (1 == cell.selected) {
+            ++result.numCells;
+            result.centerPosX += cell.pos.x;
+            result.centerPosY += cell.pos.y;
+            result.centerVelX += cell.vel.x;
+            result.centerVelY += cell.vel.y;
+        }
+        ++result.numClusterCells;
+        result.clusterCenterPosX += cell.pos.x;
+        result.clusterCenterPosY += cell.pos.y;
+        result.clusterCenterVelX += cell.vel.x;
+        result.clusterCenterVelY += cell.vel.y;
+    }
+    for (int index = 0; index < data.getNumParticles(); ++index) {
+        auto const& particle = data.particles[index];
+        if (0 == particle.selected || data.particleRemoved[index]) {
+            continue;
+        }
+        ++result.numParticles;
+        result.centerPosX += particle.pos.x;
+        result.centerPosY += particle.pos.y;
+        result.centerVelX += particle.vel.x;
+        result.centerVelY += particle.vel.y;
+        result.clusterCenterPosX += particle.pos.x;
+        result.clusterCenterPosY += particle.pos.y;
+        result.clusterCenterVelX += particle.vel.x;
+        result.clusterCenterVelY += particle.vel.y;
+    }
+
+    auto numEntities = result.numCells + result.numParticles;
+    if (numEntities > 0) {
+        result.centerPosX /= toFloat(numEntities);
+        result.centerPosY /= toFloat(numEntities);
+        result.centerVelX /= toFloat(numEntities);
+        result.centerVelY /= toFloat(numEntities);
+    }
+    auto numExtEntities = result.numClusterCells + result.numParticles;
+    if (numExtEntities > 0) {
+        result.clusterCenterPosX /= toFloat(numExtEntities);
+        result.clusterCenterPosY /= toFloat(numExtEntities);
+        result.clusterCenterVelX /= toFloat(numExtEntities);
+        result.clusterCenterVelY /= toFloat(numExtEntities);
+    }
+    return result;
+}
+
+void CpuEditOperations::shallowUpdateSelectedObjects(CpuSimulationData& data, ShallowUpdateSelectionData const& updateData)
+{
+    bool reconnectionRequired = !updateData.considerClusters && (updateData.posDeltaX != 0 || updateData.posDeltaY != 0 || updateData.angleDelta != 0);
+
+    if (reconnectionRequired) {
+        disconnectSelectionFromRemainings(data);
+    }
+
+    if (updateData.posDeltaX != 0 || updateData.posDeltaY != 0 || updateData.velDeltaX != 0 || updateData.velDeltaY != 0) {
+        float2 posDelta{updateData.posDeltaX, updateData.posDeltaY};
+        float2 velDelta{updateData.velDeltaX, updateData.velDeltaY};
+        for (auto& cell : data.cells) {
+            if (isSelected(cell, updateData.considerClusters)) {
+                cell.pos += posDelta;
+                data.cellMap.correctPosition(cell.pos);
+                cell.vel += velDelta;
+            }
+        }
+        for (auto& particle : data.particles) {
+            if (0 != particle.selected) {
+                particle.pos += posDelta;
+                data.particleMap.correctPosition(particle.pos);
+                particle.vel += velDelta;
+            }
+        }
+    }
+
+    if (updateData.angleDelta != 0 || updateData.angularVelDelta != 0) {
+        float2 center{0, 0};
+        int numEntities = 0;
+        for (auto const& cell : data.cells) {
+            if (isSelected(cell, updateData.considerClusters)) {
+                center += cell.pos;
+                ++numEntities;
+            }
+        }
+        for (auto const& particle : data.particles) {
+            if (0 != particle.selected) {
+                center += particle.pos;
+                ++numEntities;
+            }
+        }
+        if (numEntities != 0) {
+            center = center / toFloat(numEntities);
+        }
+
+        for (auto& cell : data.cells) {
+            if (isSelected(cell, updateData.considerClusters)) {
+                auto relPos = data.cellMap.getCorrectedDirection(cell.pos - center);
+                if (updateData.angleDelta != 0) {
+                    cell.pos = CpuMath::rotateClockwise(relPos, updateData.angleDelta) + center;
+                    data.cellMap.correctPosition(cell.pos);
+                }
+                if (updateData.angularVelDelta != 0) {
+                    cell.vel += CpuMath::rotateQuarterClockwise(relPos) * updateData.angularVelDelta * Const::DegToRad;
+                }
+            }
+        }
+        for (auto& particle : data.particles) {
+            if (0 != particle.selected) {
+                auto relPos = data.cellMap.getCorrectedDirection(particle.pos - center);
+                particle.pos = CpuMath::rotateClockwise(relPos, updateData.angleDelta) + center;
+                data.cellMap.correctPosition(particle.pos);
+            }
+        }
+    }
+
+    if (reconnectionRequired) {
+        connectSelection(data);
+        updateSelection(data);
+    }
+}
+
+void CpuEditOperations::removeSelectedObjects(CpuSimulationData& data, bool includeClusters)
+{
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        auto& cell = data.cells[index];
+        for (int i = 0; i < cell.numConnections;) {
+            auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+            if ((includeClusters && cell.selected != 0) || (!includeClusters && (cell.selected == 1 || connectedCell.selected == 1))) {
+                CpuCellConnectionProcessor::deleteConnections(data, index, cell.connections[i].cellIndex);
+            } else {
+                ++i;
+            }
+        }
+    }
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        if (isSelected(data.cells[index], includeClusters)) {
+            data.cellRemoved[index] = 1;
+        }
+    }
+    for (int index = 0; index < data.getNumParticles(); ++index) {
+        if (data.particles[index].selected == 1) {
+            data.particleRemoved[index] = 1;
+        }
+    }
+    CpuGarbageCollector::cleanupAfterDataManipulation(data);
+}
+
+void CpuEditOperations::relaxSelectedObjects(CpuSimulationData& data, bool includeClusters)
+{
+    for (auto& cell : data.cells) {
+        if (!isSelected(cell, includeClusters)) {
+            continue;
+        }
+        auto const numConnections = cell.numConnections;
+        for (int i = 0; i < numConnections; ++i) {
+            auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+            if (isSelected(connectedCell, includeClusters)) {
+                cell.connections[i].distance = data.cellMap.getDistance(connectedCell.pos, cell.pos);
+            }
+        }
+
+        if (numConnections > 1) {
+            for (int i = 0; i < numConnections; ++i) {
+                auto const& prevConnectedCell = data.cells[cell.connections[(i + numConnections - 1) % numConnections].cellIndex];
+                auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+                if (isSelected(connectedCell, includeClusters) && isSelected(prevConnectedCell, includeClusters)) {
+                    auto prevAngle = CpuMath::angleOfVector(data.cellMap.getCorrectedDirection(prevConnectedCell.pos - cell.pos));
+                    auto angle = CpuMath::angleOfVector(data.cellMap.getCorrectedDirection(connectedCell.pos - cell.pos));
+
+                    auto actualAngleFromPrevious = CpuMath::subtractAngle(angle, prevAngle);
+                    auto angleDiff = actualAngleFromPrevious - cell.connections[i].angleFromPrevious;
+
+                    auto nextAngleFromPrevious = cell.connections[(i + 1) % numConnections].angleFromPrevious;
+                    if (nextAngleFromPrevious - angleDiff >= 0) {
+                        cell.connections[i].angleFromPrevious = actualAngleFromPrevious;
+                        cell.connections[(i + 1) % numConnections].angleFromPrevious = nextAngleFromPrevious - angleDiff;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void CpuEditOperations::uniformVelocities(CpuSimulationData& data, bool includeClusters)
+{
+    float2 velocity{0, 0};
+    int numEntities = 0;
+    for (auto const& cell : data.cells) {
+        if (isSelected(cell, includeClusters)) {
+            velocity += cell.vel;
+            ++numEntities;
+        }
+    }
+    for (auto const& particle : data.particles) {
+        if (0 != particle.selected) {
+            velocity += particle.vel;
+            ++numEntities;
+        }
+    }
+    if (numEntities == 0) {
+        return;
+    }
+    velocity = velocity / toFloat(numEntities);
+    for (auto& cell : data.cells) {
+        if (isSelected(cell, includeClusters)) {
+            cell.vel = velocity;
+        }
+    }
+    for (auto& particle : data.particles) {
+        if (0 != particle.selected) {
+            particle.vel = velocity;
+        }
+    }
+}
+
+void CpuEditOperations::makeSticky(CpuSimulationData& data, bool includeClusters)
+{
+    for (auto& cell : data.cells) {
+        if (isSelected(cell, includeClusters)) {
+            cell.maxConnections = MAX_CELL_BONDS;
+        }
+    }
+}
+
+void CpuEditOperations::removeStickiness(CpuSimulationData& data, bool includeClusters)
+{
+    for (auto& cell : data.cells) {
+        if (isSelected(cell, includeClusters)) {
+            cell.maxConnections = cell.numConnections;
+        }
+    }
+}
+
+void CpuEditOperations::setBarrier(CpuSimulationData& data, bool value, bool includeClusters)
+{
+    for (auto& cell : data.cells) {
+        if (isSelected(cell, includeClusters)) {
+            cell.barrier = value;
+        }
+    }
+}
+
+void CpuEditOperations::reconnect(CpuSimulationData& data)
+{
+    disconnectSelectionFromRemainings(data);
+    connectSelection(data);
+    updateSelection(data);
+}
+
+void CpuEditOperations::colorSelectedCells(CpuSimulationData& data, unsigned char color, bool includeClusters)
+{
+    for (auto& cell : data.cells) {
+        if (isSelected(cell, includeClusters)) {
+            cell.color = color;
+        }
+    }
+    for (auto& particle : data.particles) {
+        if (0 != particle.selected) {
+            particle.color = color;
+        }
+    }
+}
+
+void CpuEditOperations::setDetached(CpuSimulationData& data, bool value)
+{
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        if (0 != data.cells[index].selected) {
+            data.cellDetached[index] = value ? 1 : 0;
+        }
+    }
+    data.cellNeighbors.invalidate();  //the neighbor lists only contain cells with the same detached flag
+}
+
+void CpuEditOperations::applyForce(CpuSimulationData& data, ApplyForceData const& applyData)
+{
+    for (auto& cell : data.cells) {
+        auto distanceToSegment = CpuMath::calcDistanceToLineSegment(applyData.startPos, applyData.endPos, cell.pos, applyData.radius);
+        if (distanceToSegment < applyData.radius && !cell.barrier) {
+            cell.vel += applyData.force;
+        }
+    }
+    for (auto& particle : data.particles) {
+        auto distanceToSegment = CpuMath::calcDistanceToLineSegment(applyData.startPos, applyData.endPos, particle.pos, applyData.radius);
+        if (distanceToSegment < applyData.radius) {
+            particle.vel += applyData.force;
+        }
+    }
+}
+
+void CpuEditOperations::applyCataclysm(CpuSimulationData& data, int power)
+{
+    for (int iteration = 0; iteration < power; ++iteration) {
+        for (int index = 0; index < data.getNumCells(); ++index) {
+            if (data.cells[index].cellFunction != CellFunction_Constructor) {
+                continue;
+            }
+            CpuRandom random(data.randomSeed, data.timestep, (static_cast<uint64_t>(iteration) << 32) + index, RandomPurpose_Edit);
+            if (random.random() >= 0.3f) {
+                continue;
+            }
+            std::vector<MutationType> mutationTypes;
+            mutationTypes.insert(mutationTypes.end(), 100, MutationType::NeuronData);
+            mutationTypes.insert(mutationTypes.end(), 50, MutationType::Properties);
+            mutationTypes.insert(mutationTypes.end(), {MutationType::Geometry, MutationType::CustomGeometry, MutationType::CellFunction});
+            mutationTypes.insert(mutationTypes.end(), random.random(5), MutationType::Insertion);
+            mutationTypes.insert(mutationTypes.end(), 2, MutationType::Duplication);
+            applyMutation(data, index, iteration, mutationTypes);
+        }
+    }
+}
+
+void CpuEditOperations::mutate(CpuSimulationData& data, uint64_t cellId, MutationType mutationType)
+{
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        if (data.cells[index].id == cellId) {
+            applyMutation(data, index, 0, {mutationType});
+        }
+    }
+}
+
+bool CpuEditOperations::isSelected(CellTO const& cell, bool includeClusters)
+{
+    return (includeClusters && cell.selected != 0) || (!includeClusters && cell.selected == 1);
+}
+
+void CpuEditOperations::disconnectSelectionFromRemainings(CpuSimulationData& data)
+{
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        auto const& cell = data.cells[index];
+        if (1 != cell.selected) {
+            continue;
+        }
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto connectedCellIndex = cell.connections[i].cellIndex;
+            auto const& connectedCell = data.cells[connectedCellIndex];
+            if (1 != connectedCell.selected && data.cellMap.getDistance(cell.pos, connectedCell.pos) > data.parameters.cellMaxBindingDistance) {
+                CpuCellConnectionProcessor::scheduleDeleteConnectionPair(data, 0, index, connectedCellIndex);
+            }
+        }
+    }
+    CpuCellConnectionProcessor::processOperations(data);
+}
+
+void CpuEditOperations::connectSelection(CpuSimulationData& data)
+{
+    CpuCellProcessor::updateMap(data);
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        auto const& cell = data.cells[index];
+        if (1 != cell.selected || data.cellRemoved[index]) {
+            continue;
+        }
+        data.cellMap.executeForEach(cell.pos, 1.3f, data.cellDetached[index], [&](int otherIndex) {
+            auto const& otherCell = data.cells[otherIndex];
+            if (otherIndex == index || 1 == otherCell.selected) {
+                return;
+            }
+            if (CpuCellConnectionProcessor::isConnected(data, index, otherIndex)) {
+                return;
+            }
+            if (cell.numConnections < cell.maxConnections && otherCell.numConnections < otherCell.maxConnections) {
+                CpuCellConnectionProcessor::scheduleAddConnectionPair(data, 0, index, otherIndex);
+            }
+        });
+    }
+    CpuCellConnectionProcessor::processOperations(data);
+}
+
+void CpuEditOperations::applyMutation(CpuSimulationData& data, int cellIndex, uint64_t iteration, std::vector<MutationType> const& mutationTypes)
+{
+    auto& cell = data.cells[cellIndex];
+    if (cell.cellFunction != CellFunction_Constructor) {
+        return;
+    }
+    auto& constructor = cell.cellFunctionData.constructor;
+    auto genome = data.auxiliaryData.data() + constructor.genomeDataIndex;
+
+    MutatedGenome target;
+    target.genome.assign(genome, genome + constructor.genomeSize);
+    target.genomeReadPosition = toInt(constructor.genomeReadPosition);
+    target.offspringMutationId = constructor.offspringMutationId;
+    target.color = cell.color;
+
+    CpuRandom random(data.randomSeed, data.timestep, (iteration << 32) + cellIndex, RandomPurpose_Mutation);
+    GenomeMutationRandomGenerator randomGenerator(random.randomUInt64());
+    for (auto const& mutationType : mutationTypes) {
+        GenomeMutationProcessor::applyMutation(mutationType, randomGenerator, data.parameters, target);
+    }
+
+    //the genome is appended since its size may have changed, the old one stays in the auxiliary data until the next clear
+    constructor.genomeDataIndex = data.addAuxiliaryData(target.genome.data(), target.genome.size());
+    constructor.genomeSize = target.genome.size();
+    constructor.genomeReadPosition = target.genomeReadPosition;
+    if (target.offspringMutationId != constructor.offspringMutationId) {
+        constructor.offspringMutationId = data.currentSmallId++;
+    }
+}
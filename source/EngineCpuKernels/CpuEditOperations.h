@@ -0,0 +1,43 @@
+#pragma once
+
+#include "EngineInterface/InteractionData.h"
+#include "EngineInterface/MutationType.h"
+#include "EngineInterface/SelectionShallowData.h"
+#include "EngineInterface/ShallowUpdateSelectionData.h"
+
+#include "CpuSimulationData.h"
+
+//host counterpart of EditKernels
+//selected == 1: directly selected, selected == 2: selected as part of a selected cell network
+class CpuEditOperations
+{
+public:
+    static void removeSelection(CpuSimulationData& data);
+    static void swapSelection(CpuSimulationData& data, PointSelectionData const& selectionData);
+    static void switchSelection(CpuSimulationData& data, PointSelectionData const& selectionData);
+    static void setSelection(CpuSimulationData& data, AreaSelectionData const& selectionData);
+    static void updateSelection(CpuSimulationData& data);
+    static void rolloutSelection(CpuSimulationData& data);
+    static SelectionShallowData getSelectionShallowData(CpuSimulationData const& data);
+
+    static void shallowUpdateSelectedObjects(CpuSimulationData& data, ShallowUpdateSelectionData const& updateData);
+    static void removeSelectedObjects(CpuSimulationData& data, bool includeClusters);
+    static void relaxSelectedObjects(CpuSimulationData& data, bool includeClusters);
+    static void uniformVelocities(CpuSimulationData& data, bool includeClusters);
+    static void makeSticky(CpuSimulationData& data, bool includeClusters);
+    static void removeStickiness(CpuSimulationData& data, bool includeClusters);
+    static void setBarrier(CpuSimulationData& data, bool value, bool includeClusters);
+    static void reconnect(CpuSimulationData& data);
+    static void colorSelectedCells(CpuSimulationData& data, unsigned char color, bool includeClusters);
+    static void setDetached(CpuSimulationData& data, bool value);
+    static void applyForce(CpuSimulationData& data, ApplyForceData const& applyData);
+
+    static void applyCataclysm(CpuSimulationData& data, int power);
+    static void mutate(CpuSimulationData& data, uint64_t cellId, MutationType mutationType);
+
+private:
+    static bool isSelected(CellTO const& cell, bool includeClusters);
+    static void disconnectSelectionFromRemainings(CpuSimulationData& data);
+    static void connectSelection(CpuSimulationData& data);
+    static void applyMutation(CpuSimulationData& data, int cellIndex, uint64_t iteration, std::vector<MutationType> const& mutationTypes);
+};
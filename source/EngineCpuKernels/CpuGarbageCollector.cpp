@@ -0,0 +1,261 @@
+#include "CpuGarbageCollector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    auto constexpr GrainSize = 4096;
+
+    //stream compaction: the kept elements of each index range are counted in parallel and the prefix sums over the ranges yield their new start indices
+    //returns the number of kept elements, newIndices is -1 for the other ones
+    template <typename Func>
+    int calcNewIndices(ThreadPool& threadPool, int numElements, Func const& isKept, std::vector<int>& newIndices)
+    {
+        auto numRanges = (numElements + GrainSize - 1) / GrainSize;
+        std::vector<int> rangeOffsets(numRanges + 1, 0);
+        threadPool.forEachRange(
+            numElements,
+            [&](int, int startIndex, int endIndex) {
+                int numKept = 0;
+                for (int index = startIndex; index < endIndex; ++index) {
+                    numKept += isKept(index) ? 1 : 0;
+                }
+                rangeOffsets[startIndex / GrainSize + 1] = numKept;
+            },
+            GrainSize);
+        for (int range = 0; range < numRanges; ++range) {
+            rangeOffsets[range + 1] += rangeOffsets[range];
+        }
+
+        newIndices.resize(numElements);
+        threadPool.forEachRange(
+            numElements,
+            [&](int, int startIndex, int endIndex) {
+                auto newIndex = rangeOffsets[startIndex / GrainSize];
+                for (int index = startIndex; index < endIndex; ++index) {
+                    newIndices[index] = isKept(index) ? newIndex++ : -1;
+                }
+            },
+            GrainSize);
+        return rangeOffsets[numRanges];
+    }
+
+    uint64_t getNumAuxiliaryDataBytes(CellTO const& cell)
+    {
+        uint64_t result = 0;
+        CpuSimulationData::forEachAuxiliaryDataReference(cell, [&](uint64_t, uint64_t size) { result += size; });
+        return result;
+    }
+
+    //inserts a zero bit in front of each bit
+    uint64_t spreadBits(uint32_t value)
+    {
+        uint64_t result = value;
+        result = (result | (result << 16)) & 0x0000ffff0000ffffull;
+        result = (result | (result << 8)) & 0x00ff00ff00ff00ffull;
+        result = (result | (result << 4)) & 0x0f0f0f0f0f0f0f0full;
+        result = (result | (result << 2)) & 0x3333333333333333ull;
+        result = (result | (result << 1)) & 0x5555555555555555ull;
+        return result;
+    }
+
+    //compaction followed by a sort of the remaining objects by the Morton codes of their positions
+    //the original index resolves ties such that the order is unique
+    template <typename Object>
+    int calcSpatialOrder(ThreadPool& threadPool, std::vector<Object> const& objects, std::vector<uint8_t> const& removed, std::vector<int>& newIndices)
+    {
+        auto numObjects = toInt(objects.size());
+        auto numKept = calcNewIndices(threadPool, numObjects, [&](int index) { return !removed[index]; }, newIndices);
+
+        std::vector<std::pair<uint64_t, int>> keys(numKept);
+        threadPool.forEachRange(
+            numObjects,
+            [&](int, int startIndex, int endIndex) {
+                for (int index = startIndex; index < endIndex; ++index) {
+                    if (newIndices[index] != -1) {
+                        keys[newIndices[index]] = {CpuGarbageCollector::getMortonCode(objects[index].pos), index};
+                    }
+                }
+            },
+            GrainSize);
+        std::sort(keys.begin(), keys.end());
+
+        threadPool.forEachRange(
+            numKept,
+            [&](int, int startIndex, int endIndex) {
+                for (int newIndex = startIndex; newIndex < endIndex; ++newIndex) {
+                    newIndices[keys[newIndex].second] = newIndex;
+                }
+            },
+            GrainSize);
+        return numKept;
+    }
+}
+
+void CpuGarbageCollector::cleanupAfterTimestep(CpuSimulationData& data)
+{
+    auto fullCleanup = isFullCleanupNecessary(data);
+    auto spatialOrder = fullCleanup || isSpatialOrderScheduled(data);
+    cleanupCells(data, spatialOrder);
+    cleanupParticles(data, spatialOrder);
+    if (fullCleanup) {
+        cleanupAuxiliaryData(data);
+    }
+}
+
+void CpuGarbageCollector::cleanupAfterDataManipulation(CpuSimulationData& data)
+{
+    cleanupCells(data, true);
+    cleanupParticles(data, true);
+    cleanupAuxiliaryData(data);
+}
+
+bool CpuGarbageCollector::isFullCleanupNecessary(CpuSimulationData& data)
+{
+    auto const& cells = data.cells;
+    auto numRanges = (data.getNumCells() + GrainSize - 1) / GrainSize;
+    std::vector<uint64_t> rangeNumBytes(numRanges, 0);
+    data.threadPool.forEachRange(
+        data.getNumCells(),
+        [&](int, int startIndex, int endIndex) {
+            uint64_t numBytes = 0;
+            for (int index = startIndex; index < endIndex; ++index) {
+                if (!data.cellRemoved[index]) {
+                    numBytes += getNumAuxiliaryDataBytes(cells[index]);
+                }
+            }
+            rangeNumBytes[startIndex / GrainSize] = numBytes;
+        },
+        GrainSize);
+
+    uint64_t numUsedBytes = 0;
+    for (auto const& numBytes : rangeNumBytes) {
+        numUsedBytes += numBytes;
+    }
+    auto numGarbageBytes = data.auxiliaryData.size() - numUsedBytes;
+    return static_cast<double>(numGarbageBytes) > static_cast<double>(data.auxiliaryData.size()) * MaxAuxiliaryDataGarbageFraction;
+}
+
+bool CpuGarbageCollector::isSpatialOrderScheduled(CpuSimulationData const& data)
+{
+    return data.spatialOrderInterval > 0 && data.timestep % data.spatialOrderInterval == 0;
+}
+
+uint64_t CpuGarbageCollector::getMortonCode(float2 const& pos)
+{
+    auto x = static_cast<uint32_t>(std::max(0.0f, std::floor(pos.x)));
+    auto y = static_cast<uint32_t>(std::max(0.0f, std::floor(pos.y)));
+    return spreadBits(x) | (spreadBits(y) << 1);
+}
+
+void CpuGarbageCollector::cleanupCells(CpuSimulationData& data, bool spatialOrder)
+{
+    auto hasRemovedCells = std::find(data.cellRemoved.begin(), data.cellRemoved.end(), 1) != data.cellRemoved.end();
+    if (!hasRemovedCells && !spatialOrder) {
+        return;
+    }
+
+    std::vector<int> newIndices;
+    auto numCells = spatialOrder ? calcSpatialOrder(data.threadPool, data.cells, data.cellRemoved, newIndices)
+                                 : calcNewIndices(data.threadPool, data.getNumCells(), [&](int index) { return !data.cellRemoved[index]; }, newIndices);
+
+    auto& newCells = data.tempCells;
+    newCells.resize(numCells);
+    std::vector<uint8_t> newCellDetached(numCells);
+    std::vector<float> newCellDensities(numCells);
+    data.threadPool.forEachRange(
+        data.getNumCells(),
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                auto newIndex = newIndices[index];
+                if (newIndex == -1) {
+                    continue;
+                }
+                auto& newCell = newCells[newIndex];
+                newCell = data.cells[index];
+                for (int i = 0; i < newCell.numConnections; ++i) {
+                    newCell.connections[i].cellIndex = newIndices[newCell.connections[i].cellIndex];
+                }
+                newCellDetached[newIndex] = data.cellDetached[index];
+                newCellDensities[newIndex] = data.cellDensities[index];
+            }
+        },
+        GrainSize);
+
+    std::swap(data.cells, newCells);
+    data.cellDetached = std::move(newCellDetached);
+    data.cellDensities = std::move(newCellDensities);
+    data.cellRemoved.assign(numCells, 0);
+    data.cellNeighbors.invalidate();
+    data.connectionSolver.invalidate();
+}
+
+void CpuGarbageCollector::cleanupParticles(CpuSimulationData& data, bool spatialOrder)
+{
+    auto hasRemovedParticles = std::find(data.particleRemoved.begin(), data.particleRemoved.end(), 1) != data.particleRemoved.end();
+    if (!hasRemovedParticles && !spatialOrder) {
+        return;
+    }
+
+    std::vector<int> newIndices;
+    auto numParticles = spatialOrder
+        ? calcSpatialOrder(data.threadPool, data.particles, data.particleRemoved, newIndices)
+        : calcNewIndices(data.threadPool, data.getNumParticles(), [&](int index) { return !data.particleRemoved[index]; }, newIndices);
+
+    auto& newParticles = data.tempParticles;
+    newParticles.resize(numParticles);
+    std::vector<uint64_t> newLastAbsorbedCellIds(numParticles);
+    data.threadPool.forEachRange(
+        data.getNumParticles(),
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                auto newIndex = newIndices[index];
+                if (newIndex != -1) {
+                    newParticles[newIndex] = data.particles[index];
+                    newLastAbsorbedCellIds[newIndex] = data.particleLastAbsorbedCellIds[index];
+                }
+            }
+        },
+        GrainSize);
+
+    std::swap(data.particles, newParticles);
+    data.particleLastAbsorbedCellIds = std::move(newLastAbsorbedCellIds);
+    data.particleRemoved.assign(numParticles, 0);
+}
+
+void CpuGarbageCollector::cleanupAuxiliaryData(CpuSimulationData& data)
+{
+    auto numCells = data.getNumCells();
+    std::vector<uint64_t> offsets(numCells + 1, 0);
+    data.threadPool.forEachRange(
+        numCells,
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                offsets[index + 1] = getNumAuxiliaryDataBytes(data.cells[index]);
+            }
+        },
+        GrainSize);
+    for (int index = 0; index < numCells; ++index) {
+        offsets[index + 1] += offsets[index];
+    }
+
+    //the blobs of each cell are copied in one piece each and placed in the order of the cells
+    auto& newAuxiliaryData = data.tempAuxiliaryData;
+    newAuxiliaryData.resize(offsets[numCells]);
+    data.threadPool.forEachRange(
+        numCells,
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                auto offset = offsets[index];
+                CpuSimulationData::forEachAuxiliaryDataReference(data.cells[index], [&](uint64_t& dataIndex, uint64_t size) {
+                    std::memcpy(newAuxiliaryData.data() + offset, data.auxiliaryData.data() + dataIndex, size);
+                    dataIndex = offset;
+                    offset += size;
+                });
+            }
+        },
+        GrainSize);
+    std::swap(data.auxiliaryData, newAuxiliaryData);
+}
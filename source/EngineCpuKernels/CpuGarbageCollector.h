@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CpuSimulationData.h"
+
+//host counterpart of GarbageCollectorKernels:
+//after each time step the cells and particles marked as removed are compacted in parallel while preserving the order of the remaining ones
+//if the auxiliary data is fragmented (as in cudaCheckIfCleanupIsNecessary) or after data manipulations a full cleanup is performed
+//which additionally relocates the auxiliary data of the remaining cells
+//the cells and particles are reordered along a Morton curve for memory locality on each full cleanup and every spatialOrderInterval time steps
+class CpuGarbageCollector
+{
+public:
+    static auto constexpr MaxAuxiliaryDataGarbageFraction = 0.5f;
+
+    static void cleanupAfterTimestep(CpuSimulationData& data);
+    static void cleanupAfterDataManipulation(CpuSimulationData& data);
+
+    static bool isFullCleanupNecessary(CpuSimulationData& data);
+    static bool isSpatialOrderScheduled(CpuSimulationData const& data);
+    static uint64_t getMortonCode(float2 const& pos);
+
+private:
+    static void cleanupCells(CpuSimulationData& data, bool spatialOrder);
+    static void cleanupParticles(CpuSimulationData& data, bool spatialOrder);
+    static void cleanupAuxiliaryData(CpuSimulationData& data);
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "EngineInterface/GenomeDecoderBase.h"
+#include "EngineInterface/GenomeConstants.h"
+
+//host counterpart of the functions in EngineGpuKernels/GenomeDecoder.cuh which operate on whole genomes including the header
+class CpuGenomeDecoder : public GenomeDecoderBase
+{
+public:
+    static bool containsSelfReplication(uint8_t const* genome, uint64_t genomeSize)
+    {
+        if (genomeSize <= Const::GenomeHeaderSize) {
+            return false;
+        }
+        return hasSelfCopy(genome + Const::GenomeHeaderSize, static_cast<int>(genomeSize) - Const::GenomeHeaderSize);
+    }
+
+    static bool isSeparating(uint8_t const* genome, uint64_t genomeSize)
+    {
+        if (genomeSize < Const::GenomeHeaderSize) {
+            return false;
+        }
+        return convertByteToBool(genome[Const::GenomeHeaderSeparationPos]);
+    }
+};
@@ -0,0 +1,53 @@
+#include "CpuMap.h"
+
+#include <bit>
+
+void CpuSpatialMap::init(int2 const& size, int bucketSize)
+{
+    CpuBaseMap::init(size);
+    _bucketSize = bucketSize;
+    _numBuckets = {(size.x + bucketSize - 1) / bucketSize, (size.y + bucketSize - 1) / bucketSize};
+
+    auto bitsX = toInt(std::bit_width(static_cast<uint32_t>(_numBuckets.x - 1)));
+    auto bitsY = toInt(std::bit_width(static_cast<uint32_t>(_numBuckets.y - 1)));
+    _mortonBits = std::min(bitsX, bitsY);
+    _moreBucketsInX = bitsX > bitsY;
+
+    _bucketStarts.assign((size_t(1) << (bitsX + bitsY)) + 1, 0);
+    _sortedIndices.clear();
+    _sortedPositions.clear();
+    _entityBucketKeys.clear();
+}
+
+int CpuSpatialMap::getInUnitSquare(float2 const& pos, bool first) const
+{
+    if (_sortedIndices.empty()) {
+        return -1;
+    }
+    auto unitSquare = getUnitSquare(pos);
+    auto key = getBucketKey(unitSquare.x / _bucketSize, unitSquare.y / _bucketSize);
+    int result = -1;
+    for (int i = _bucketStarts[key], end = _bucketStarts[key + 1]; i < end; ++i) {
+        auto entityUnitSquare = getUnitSquare(_sortedPositions[i]);
+        if (entityUnitSquare.x == unitSquare.x && entityUnitSquare.y == unitSquare.y) {
+            result = _sortedIndices[i];
+            if (first) {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+void CpuCellMap::update(std::vector<CellTO> const& cells, std::vector<uint8_t> const& cellDetached, std::vector<uint8_t> const& cellRemoved)
+{
+    _cellDetached = &cellDetached;
+    CpuSpatialMap::update(
+        toInt(cells.size()), [&](int index) { return cells[index].pos; }, [&](int index) { return cellRemoved[index] == 0; });
+}
+
+void CpuParticleMap::update(std::vector<ParticleTO> const& particles, std::vector<uint8_t> const& particleRemoved)
+{
+    CpuSpatialMap::update(
+        toInt(particles.size()), [&](int index) { return particles[index].pos; }, [&](int index) { return particleRemoved[index] == 0; });
+}
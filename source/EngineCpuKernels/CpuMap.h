@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "EngineInterface/TOs.h"
+
+#include "CpuMath.h"
+
+//host counterparts of the maps in EngineGpuKernels/Map.cuh for a torus shaped world
+class CpuBaseMap
+{
+public:
+    void init(int2 const& size) { _size = size; }
+
+    int2 getSize() const { return _size; }
+
+    void correctPosition(int2& pos) const { pos = {((pos.x % _size.x) + _size.x) % _size.x, ((pos.y % _size.y) + _size.y) % _size.y}; }
+
+    void correctPosition(float2& pos) const
+    {
+        int2 intPart{toIntFloor(pos.x), toIntFloor(pos.y)};
+        float2 fracPart{pos.x - toFloat(intPart.x), pos.y - toFloat(intPart.y)};
+        correctPosition(intPart);
+        pos = {toFloat(intPart.x) + fracPart.x, toFloat(intPart.y) + fracPart.y};
+    }
+
+    void correctDirection(float2& disp) const { disp = getCorrectedDirection(disp); }
+
+    //same as std::remainder for displacements between corrected positions but without the library call which dominated the neighborhood loops
+    float2 getCorrectedDirection(float2 const& disp) const
+    {
+        auto sizeX = toFloat(_size.x);
+        auto sizeY = toFloat(_size.y);
+        return {disp.x - sizeX * std::floor(disp.x / sizeX + 0.5f), disp.y - sizeY * std::floor(disp.y / sizeY + 0.5f)};
+    }
+
+    float getDistance(float2 const& p, float2 const& q) const { return CpuMath::length(getCorrectedDirection(p - q)); }
+
+protected:
+    static int toIntFloor(float value) { return static_cast<int>(std::floor(value)); }
+
+    //corrected integer part of the position, also robust against rounding of corrected positions to the world size
+    int2 getUnitSquare(float2 const& pos) const
+    {
+        int2 result{toIntFloor(pos.x), toIntFloor(pos.y)};
+        correctPosition(result);
+        return result;
+    }
+
+    int2 _size{0, 0};
+};
+
+//cell list: the entities are sorted by bucket (square of bucketSize units) into contiguous arrays by a counting sort
+//such that the memory scales with the number of entities and buckets instead of one slot per unit square of the world
+//buckets are enumerated in Morton order, hence neighboring buckets are also close in memory
+class CpuSpatialMap : public CpuBaseMap
+{
+public:
+    static auto constexpr DefaultBucketSize = 2;
+
+    void init(int2 const& size, int bucketSize = DefaultBucketSize);
+
+    int getBucketSize() const { return _bucketSize; }
+    int getNumEntities() const { return toInt(_sortedIndices.size()); }
+
+    //entities with isIncluded(index) == false are skipped
+    template <typename GetPosFunc, typename IsIncludedFunc>
+    void update(int numEntities, GetPosFunc const& getPos, IsIncludedFunc const& isIncluded);
+
+    //calls func(index, pos) with the positions of the last update for all entities in the buckets overlapping the square [pos - radius, pos + radius]
+    //entities of the same bucket are visited in ascending index order
+    template <typename Func>
+    void executeForEachCandidate(float2 const& pos, float radius, Func const& func) const;
+
+protected:
+    //returns the smallest (first = true) or largest index of the entities whose last update position lies in the same unit square as pos or -1
+    int getInUnitSquare(float2 const& pos, bool first) const;
+
+private:
+    static uint32_t spreadBits(uint32_t value);
+
+    uint32_t getBucketKey(int bucketX, int bucketY) const;
+
+    //calls func(bucketCoordinate) once for each bucket overlapping the interval [start, end] on a torus of the given size
+    template <typename Func>
+    void forEachBucketCoordinate(int start, int end, int size, int numBuckets, Func const& func) const;
+
+    int _bucketSize = DefaultBucketSize;
+    int2 _numBuckets{0, 0};
+    int _mortonBits = 0;
+    bool _moreBucketsInX = false;
+
+    std::vector<int> _bucketStarts;  //offsets into the sorted arrays, one more entry than bucket keys
+    std::vector<int> _sortedIndices;
+    std::vector<float2> _sortedPositions;
+    std::vector<uint32_t> _entityBucketKeys;
+};
+
+class CpuCellMap : public CpuSpatialMap
+{
+public:
+    //cells with a non-zero entry in cellRemoved are skipped
+    void update(std::vector<CellTO> const& cells, std::vector<uint8_t> const& cellDetached, std::vector<uint8_t> const& cellRemoved);
+
+    //returns the smallest index of the cells in the unit square containing pos or -1
+    int getFirst(float2 const& pos) const { return getInUnitSquare(pos, true); }
+
+    //calls func(cellIndex) for all cells (including the cell at pos itself) within the radius of pos
+    //which are either both attached or both detached in respect to the detached argument
+    template <typename Func>
+    void executeForEach(float2 const& pos, float radius, int detached, Func const& func) const;
+
+private:
+    std::vector<uint8_t> const* _cellDetached = nullptr;
+};
+
+//at most one particle per unit square is found as on the gpu (the one with the largest index here)
+class CpuParticleMap : public CpuSpatialMap
+{
+public:
+    void update(std::vector<ParticleTO> const& particles, std::vector<uint8_t> const& particleRemoved);
+
+    //returns the index of the particle in the unit square containing pos or -1
+    int get(float2 const& pos) const { return getInUnitSquare(pos, false); }
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+template <typename GetPosFunc, typename IsIncludedFunc>
+void CpuSpatialMap::update(int numEntities, GetPosFunc const& getPos, IsIncludedFunc const& isIncluded)
+{
+    auto numKeys = toInt(_bucketStarts.size()) - 1;
+    std::fill(_bucketStarts.begin(), _bucketStarts.end(), 0);
+
+    //pass 1: count entities per bucket
+    _entityBucketKeys.resize(numEntities);
+    int numIncluded = 0;
+    for (int index = 0; index < numEntities; ++index) {
+        if (!isIncluded(index)) {
+            _entityBucketKeys[index] = numKeys;
+            continue;
+        }
+        auto unitSquare = getUnitSquare(getPos(index));
+        auto key = getBucketKey(unitSquare.x / _bucketSize, unitSquare.y / _bucketSize);
+        _entityBucketKeys[index] = key;
+        ++_bucketStarts[key + 1];
+        ++numIncluded;
+    }
+
+    //pass 2: prefix sums
+    for (int key = 0; key < numKeys; ++key) {
+        _bucketStarts[key + 1] += _bucketStarts[key];
+    }
+
+    //pass 3: stable scatter, _bucketStarts[key] is used as insertion cursor and restored afterwards
+    _sortedIndices.resize(numIncluded);
+    _sortedPositions.resize(numIncluded);
+    for (int index = 0; index < numEntities; ++index) {
+        auto key = _entityBucketKeys[index];
+        if (toInt(key) == numKeys) {
+            continue;
+        }
+        auto target = _bucketStarts[key]++;
+        _sortedIndices[target] = index;
+        _sortedPositions[target] = getPos(index);
+    }
+    for (int key = numKeys; key > 0; --key) {
+        _bucketStarts[key] = _bucketStarts[key - 1];
+    }
+    _bucketStarts[0] = 0;
+}
+
+template <typename Func>
+void CpuSpatialMap::executeForEachCandidate(float2 const& pos, float radius, Func const& func) const
+{
+    if (_sortedIndices.empty()) {
+        return;
+    }
+    auto startX = toIntFloor(pos.x - radius);
+    auto endX = toIntFloor(pos.x + radius);
+    auto startY = toIntFloor(pos.y - radius);
+    auto endY = toIntFloor(pos.y + radius);
+    forEachBucketCoordinate(startY, endY, _size.y, _numBuckets.y, [&](int bucketY) {
+        forEachBucketCoordinate(startX, endX, _size.x, _numBuckets.x, [&](int bucketX) {
+            auto key = getBucketKey(bucketX, bucketY);
+            for (int i = _bucketStarts[key], end = _bucketStarts[key + 1]; i < end; ++i) {
+                func(_sortedIndices[i], _sortedPositions[i]);
+            }
+        });
+    });
+}
+
+template <typename Func>
+void CpuSpatialMap::forEachBucketCoordinate(int start, int end, int size, int numBuckets, Func const& func) const
+{
+    if (end - start + 1 >= size) {
+        for (int bucket = 0; bucket < numBuckets; ++bucket) {
+            func(bucket);
+        }
+        return;
+    }
+    start = ((start % size) + size) % size;
+    end = ((end % size) + size) % size;
+    if (start <= end) {
+        for (int bucket = start / _bucketSize; bucket <= end / _bucketSize; ++bucket) {
+            func(bucket);
+        }
+        return;
+    }
+
+    //interval wraps around: [start, size - 1] and [0, end] where a shared bucket is only visited once
+    auto firstBucket = start / _bucketSize;
+    auto lastBucket = std::min(end / _bucketSize, firstBucket - 1);
+    for (int bucket = firstBucket; bucket < numBuckets; ++bucket) {
+        func(bucket);
+    }
+    for (int bucket = 0; bucket <= lastBucket; ++bucket) {
+        func(bucket);
+    }
+}
+
+inline uint32_t CpuSpatialMap::getBucketKey(int bucketX, int bucketY) const
+{
+    //the lower bits of both coordinates are interleaved, the remaining bits of the coordinate with more buckets are put on top
+    auto lowerMask = (1u << _mortonBits) - 1;
+    auto result = spreadBits(static_cast<uint32_t>(bucketX) & lowerMask) | (spreadBits(static_cast<uint32_t>(bucketY) & lowerMask) << 1);
+    auto upperBits = static_cast<uint32_t>(_moreBucketsInX ? bucketX : bucketY) >> _mortonBits;
+    return result | (upperBits << (2 * _mortonBits));
+}
+
+inline uint32_t CpuSpatialMap::spreadBits(uint32_t value)
+{
+    value = (value | (value << 8)) & 0x00ff00ff;
+    value = (value | (value << 4)) & 0x0f0f0f0f;
+    value = (value | (value << 2)) & 0x33333333;
+    value = (value | (value << 1)) & 0x55555555;
+    return value;
+}
+
+template <typename Func>
+void CpuCellMap::executeForEach(float2 const& pos, float radius, int detached, Func const& func) const
+{
+    auto const& cellDetached = *_cellDetached;
+    executeForEachCandidate(pos, radius, [&](int cellIndex, float2 const& cellPos) {
+        if (getDistance(cellPos, pos) <= radius && detached + cellDetached[cellIndex] != 1) {
+            func(cellIndex);
+        }
+    });
+}
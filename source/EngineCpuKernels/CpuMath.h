@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+
+#include "Base/Definitions.h"
+#include "Base/Math.h"
+#include "EngineInterface/VectorTypes.h"
+
+//host counterparts of the float2 functions in EngineGpuKernels/Math.cuh (which cannot be included in host-only code)
+//NOTE: the operators have internal linkage to avoid clashes with the __host__ __device__ versions in the gpu library
+
+static inline float2 operator+(float2 const& p, float2 const& q)
+{
+    return {p.x + q.x, p.y + q.y};
+}
+
+static inline float2 operator-(float2 const& p, float2 const& q)
+{
+    return {p.x - q.x, p.y - q.y};
+}
+
+static inline float2 operator*(float2 const& p, float m)
+{
+    return {p.x * m, p.y * m};
+}
+
+static inline float2 operator/(float2 const& p, float d)
+{
+    return {p.x / d, p.y / d};
+}
+
+static inline void operator+=(float2& p, float2 const& q)
+{
+    p.x += q.x;
+    p.y += q.y;
+}
+
+static inline void operator-=(float2& p, float2 const& q)
+{
+    p.x -= q.x;
+    p.y -= q.y;
+}
+
+class CpuMath
+{
+public:
+    static float length(float2 const& v) { return std::sqrt(v.x * v.x + v.y * v.y); }
+    static float lengthSquared(float2 const& v) { return v.x * v.x + v.y * v.y; }
+    static float lengthMax(float2 const& v) { return std::max(std::abs(v.x), std::abs(v.y)); }
+    static float dot(float2 const& p, float2 const& q) { return p.x * q.x + p.y * q.y; }
+
+    static float2 normalized(float2 const& v)
+    {
+        auto l = length(v);
+        if (l > NEAR_ZERO) {
+            return {v.x / l, v.y / l};
+        }
+        return {1.0f, 0.0f};
+    }
+
+    //0 DEG corresponds to (0,-1)
+    static float angleOfVector(float2 const& v)
+    {
+        auto l = length(v);
+        if (l < NEAR_ZERO) {
+            return 0;
+        }
+        auto normalizedVy = std::max(-1.0f, std::min(1.0f, -v.y / l));
+        auto angleSin = std::asin(normalizedVy) * Const::RadToDeg;
+        return v.x >= 0.0f ? 90.0f - angleSin : angleSin + 270.0f;
+    }
+
+    static float2 unitVectorOfAngle(float angle)
+    {
+        angle *= Const::DegToRad;
+        return {std::sin(angle), -std::cos(angle)};
+    }
+
+    static float2 rotateQuarterClockwise(float2 const& v) { return {-v.y, v.x}; }
+    static float2 rotateQuarterCounterClockwise(float2 const& v) { return {v.y, -v.x}; }
+
+    static float2 rotateClockwise(float2 const& v, float angle)
+    {
+        auto sinAngle = std::sin(angle * Const::DegToRad);
+        auto cosAngle = std::cos(angle * Const::DegToRad);
+        return {v.x * cosAngle - v.y * sinAngle, v.x * sinAngle + v.y * cosAngle};
+    }
+
+    static float subtractAngle(float angleMinuend, float angleSubtrahend)
+    {
+        auto angleDiff = angleMinuend - angleSubtrahend;
+        if (angleDiff > 360.0f) {
+            angleDiff -= 360.0f;
+        }
+        if (angleDiff < 0.0f) {
+            angleDiff += 360.0f;
+        }
+        return angleDiff;
+    }
+
+    static bool isAngleInBetween(float angle1, float angle2, float angleBetweenCandidate)
+    {
+        if (angle1 == angle2 && angle1 != angleBetweenCandidate) {
+            return false;
+        }
+        if (angleBetweenCandidate < angle1) {
+            angleBetweenCandidate += 360.0f;
+            angle2 += 360.0f;
+        }
+        if (angle2 < angleBetweenCandidate) {
+            angle2 += 360.0f;
+        }
+        return angle2 - angle1 < 360.0f;
+    }
+
+    static bool crossing(float2 const& segmentStart, float2 const& segmentEnd, float2 const& otherSegmentStart, float2 const& otherSegmentEnd)
+    {
+        auto const& p1 = segmentStart;
+        auto v1 = segmentEnd - segmentStart;
+        auto const& p2 = otherSegmentStart;
+        auto v2 = otherSegmentEnd - otherSegmentStart;
+
+        auto divisor = v2.x * v1.y - v2.y * v1.x;
+        if (std::abs(divisor) < NEAR_ZERO) {
+            return false;
+        }
+        auto mue = (v1.x * (p2.y - p1.y) - v1.y * (p2.x - p1.x)) / divisor;
+        if (mue < -NEAR_ZERO || mue > 1 + NEAR_ZERO) {
+            return false;
+        }
+
+        float lambda;
+        if (std::abs(v1.x) > NEAR_ZERO) {
+            lambda = (p2.x - p1.x + mue * v2.x) / v1.x;
+        } else if (std::abs(v1.y) > NEAR_ZERO) {
+            lambda = (p2.y - p1.y + mue * v2.y) / v1.y;
+        } else {
+            return false;
+        }
+        return lambda >= NEAR_ZERO && lambda <= 1 - NEAR_ZERO;
+    }
+
+    static float calcDistanceToLineSegment(float2 const& startSegment, float2 const& endSegment, float2 const& pos, float boundary = 0)
+    {
+        auto relPos = pos - startSegment;
+        auto segmentDirection = endSegment - startSegment;
+        auto segmentLength = length(segmentDirection);
+        if (segmentLength < NEAR_ZERO) {
+            return boundary + 1.0f;
+        }
+        segmentDirection = segmentDirection / segmentLength;
+        auto normal = rotateQuarterCounterClockwise(segmentDirection);
+        auto signedDistanceFromLine = dot(relPos, normal);
+        if (std::abs(signedDistanceFromLine) > boundary) {
+            return boundary + 1.0f;
+        }
+        auto signedDistanceFromStart = dot(relPos, segmentDirection);
+        if (signedDistanceFromStart < 0 || signedDistanceFromStart > segmentLength) {
+            return boundary + 1.0f;
+        }
+        return std::abs(signedDistanceFromLine);
+    }
+
+    static bool isContainedInRect(float2 const& rectUpperLeft, float2 const& rectLowerRight, float2 const& pos)
+    {
+        return pos.x >= rectUpperLeft.x && pos.x <= rectLowerRight.x && pos.y >= rectUpperLeft.y && pos.y <= rectLowerRight.y;
+    }
+};
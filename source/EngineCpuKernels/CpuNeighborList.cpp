@@ -0,0 +1,104 @@
+#include "CpuNeighborList.h"
+
+#include <algorithm>
+
+void CpuNeighborList::init(float skin)
+{
+    _skin = skin;
+    invalidate();
+}
+
+bool CpuNeighborList::update(
+    std::vector<CellTO> const& cells,
+    std::vector<uint8_t> const& cellDetached,
+    std::vector<uint8_t> const& cellRemoved,
+    CpuCellMap const& cellMap,
+    float radius,
+    ThreadPool& threadPool)
+{
+    if (isValid(cells, cellMap, radius, threadPool)) {
+        return false;
+    }
+    rebuild(cells, cellDetached, cellRemoved, cellMap, radius, threadPool);
+    return true;
+}
+
+bool CpuNeighborList::isValid(std::vector<CellTO> const& cells, CpuCellMap const& cellMap, float radius, ThreadPool& threadPool) const
+{
+    if (_radius != radius || _rebuildCellIds.size() != cells.size()) {
+        return false;
+    }
+
+    //the cell ids detect changed indices, e.g. after a garbage collection with the same number of removed and added cells
+    auto maxDisplacementSquared = _skin * _skin / 4;
+    std::vector<uint8_t> invalidPerThread(threadPool.getNumThreads(), 0);
+    threadPool.forEachRange(
+        toInt(cells.size()),
+        [&](int threadIndex, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                auto const& cell = cells[index];
+                if (cell.id != _rebuildCellIds[index]
+                    || CpuMath::lengthSquared(cellMap.getCorrectedDirection(cell.pos - _rebuildPositions[index])) > maxDisplacementSquared) {
+                    invalidPerThread[threadIndex] = 1;
+                    return;
+                }
+            }
+        },
+        4096);
+    return std::find(invalidPerThread.begin(), invalidPerThread.end(), 1) == invalidPerThread.end();
+}
+
+void CpuNeighborList::rebuild(
+    std::vector<CellTO> const& cells,
+    std::vector<uint8_t> const& cellDetached,
+    std::vector<uint8_t> const& cellRemoved,
+    CpuCellMap const& cellMap,
+    float radius,
+    ThreadPool& threadPool)
+{
+    auto numCells = toInt(cells.size());
+    _radius = radius;
+    ++_numRebuilds;
+    _offsets.assign(numCells + 1, 0);
+    _rebuildPositions.resize(numCells);
+    _rebuildCellIds.resize(numCells);
+    _rangeNeighbors.resize((numCells + GrainSize - 1) / GrainSize);
+
+    //the lists of each index range are collected separately and then concatenated in the order of the ranges
+    threadPool.forEachRange(
+        numCells,
+        [&](int, int startIndex, int endIndex) {
+            auto& rangeNeighbors = _rangeNeighbors[startIndex / GrainSize];
+            rangeNeighbors.clear();
+            for (int index = startIndex; index < endIndex; ++index) {
+                auto const& cell = cells[index];
+                _rebuildPositions[index] = cell.pos;
+                _rebuildCellIds[index] = cell.id;
+                if (cellRemoved[index]) {
+                    continue;
+                }
+                auto numNeighbors = rangeNeighbors.size();
+                cellMap.executeForEach(cell.pos, radius + _skin, cellDetached[index], [&](int otherIndex) {
+                    if (otherIndex != index) {
+                        rangeNeighbors.emplace_back(otherIndex);
+                    }
+                });
+                _offsets[index + 1] = toInt(rangeNeighbors.size() - numNeighbors);
+            }
+        },
+        GrainSize);
+
+    for (int index = 0; index < numCells; ++index) {
+        _offsets[index + 1] += _offsets[index];
+    }
+    _neighbors.resize(_offsets[numCells]);
+    threadPool.forEachRange(
+        toInt(_rangeNeighbors.size()),
+        [&](int, int startRange, int endRange) {
+            for (int range = startRange; range < endRange; ++range) {
+                auto const& rangeNeighbors = _rangeNeighbors[range];
+                std::copy(rangeNeighbors.begin(), rangeNeighbors.end(), _neighbors.begin() + _offsets[range * GrainSize]);
+            }
+        },
+        1);
+}
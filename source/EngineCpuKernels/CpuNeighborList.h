@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+
+#include "Base/ThreadPool.h"
+#include "EngineInterface/TOs.h"
+
+#include "CpuMap.h"
+
+//verlet list: the cells within radius + skin of each cell are stored in contiguous arrays and reused over several time steps
+//the lists are rebuilt from the cell map as soon as a cell has moved by more than half of the skin or the cells have changed
+//such that they contain all cells within radius at any time in between
+class CpuNeighborList
+{
+public:
+    static auto constexpr DefaultSkin = 0.5f;
+
+    void init(float skin = DefaultSkin);
+
+    //prerequisite: cellMap is up to date, returns true if the lists have been rebuilt
+    bool update(
+        std::vector<CellTO> const& cells,
+        std::vector<uint8_t> const& cellDetached,
+        std::vector<uint8_t> const& cellRemoved,
+        CpuCellMap const& cellMap,
+        float radius,
+        ThreadPool& threadPool);
+    void invalidate() { _radius = -1.0f; }
+
+    int getNumRebuilds() const { return _numRebuilds; }
+
+    //calls func(otherCellIndex) for all cells which were within radius + skin of the cell at the last rebuild (excluding the cell itself)
+    //the distance has to be checked by the caller
+    template <typename Func>
+    void executeForEach(int cellIndex, Func const& func) const;
+
+private:
+    static auto constexpr GrainSize = 256;
+
+    bool isValid(std::vector<CellTO> const& cells, CpuCellMap const& cellMap, float radius, ThreadPool& threadPool) const;
+    void rebuild(
+        std::vector<CellTO> const& cells,
+        std::vector<uint8_t> const& cellDetached,
+        std::vector<uint8_t> const& cellRemoved,
+        CpuCellMap const& cellMap,
+        float radius,
+        ThreadPool& threadPool);
+
+    float _skin = DefaultSkin;
+    float _radius = -1.0f;  //negative if invalid
+    int _numRebuilds = 0;
+
+    std::vector<int> _offsets;  //offsets into _neighbors, one more entry than cells
+    std::vector<int> _neighbors;
+    std::vector<std::vector<int>> _rangeNeighbors;  //temporary lists of the index ranges processed in parallel
+    std::vector<float2> _rebuildPositions;
+    std::vector<uint64_t> _rebuildCellIds;
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+template <typename Func>
+void CpuNeighborList::executeForEach(int cellIndex, Func const& func) const
+{
+    for (int i = _offsets[cellIndex], end = _offsets[cellIndex + 1]; i < end; ++i) {
+        func(_neighbors[i]);
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "EngineInterface/TOs.h"
+
+//host counterparts of the scheduled operations in EngineGpuKernels/Operations.cuh, cells are referenced by index
+struct CpuStructuralOperation
+{
+    enum class Type : int
+    {
+        AddConnectionPair,
+        DelCell,
+        DelAllConnections,
+        DelConnectionPair,
+    };
+    Type type;
+    int cellIndex;
+    int otherCellIndex;  //for AddConnectionPair and DelConnectionPair
+
+    bool operator<(CpuStructuralOperation const& other) const
+    {
+        if (type != other.type) {
+            return type < other.type;
+        }
+        if (cellIndex != other.cellIndex) {
+            return cellIndex < other.cellIndex;
+        }
+        return otherCellIndex < other.otherCellIndex;
+    }
+};
+
+struct CpuNewParticle
+{
+    uint64_t orderKey;  //new particles are added in the order of their keys
+    ParticleTO particle;
+};
@@ -0,0 +1,154 @@
+#include "CpuParticleProcessor.h"
+
+#include "CpuRandom.h"
+
+void CpuParticleProcessor::updateMap(CpuSimulationData& data)
+{
+    data.particleMap.update(data.particles, data.particleRemoved);
+}
+
+void CpuParticleProcessor::movement(CpuSimulationData& data)
+{
+    data.forEachParticle([&](int index) {
+        auto& particle = data.particles[index];
+        particle.pos = particle.pos + particle.vel;
+        data.particleMap.correctPosition(particle.pos);
+    });
+}
+
+void CpuParticleProcessor::collision(CpuSimulationData& data)
+{
+    //serial because particles fuse with each other and several particles may be absorbed by the same cell
+    auto const& parameters = data.parameters;
+    for (int index = 0; index < data.getNumParticles(); ++index) {
+        if (data.particleRemoved[index]) {
+            continue;
+        }
+        auto& particle = data.particles[index];
+        auto otherIndex = data.particleMap.get(particle.pos);
+        if (otherIndex != -1 && otherIndex != index && !data.particleRemoved[otherIndex]
+            && CpuMath::lengthSquared(particle.pos - data.particles[otherIndex].pos) < 0.5f) {
+
+            auto& otherParticle = data.particles[otherIndex];
+            if (particle.energy > NEAR_ZERO && otherParticle.energy > NEAR_ZERO) {
+                auto factor1 = particle.energy / (particle.energy + otherParticle.energy);
+                otherParticle.vel = particle.vel * factor1 + otherParticle.vel * (1.0f - factor1);
+                otherParticle.energy += particle.energy;
+                data.particleLastAbsorbedCellIds[otherIndex] = 0;
+                particle.energy = 0;
+                data.particleRemoved[index] = 1;
+            }
+        } else {
+            auto cellIndex = data.cellMap.getFirst(particle.pos + particle.vel);
+            if (cellIndex == -1) {
+                continue;
+            }
+            auto& cell = data.cells[cellIndex];
+            if (cell.barrier) {
+                auto vr = particle.vel;
+                auto r = data.cellMap.getCorrectedDirection(particle.pos - cell.pos);
+                auto dot_vr_r = CpuMath::dot(vr, r);
+                if (dot_vr_r < 0) {
+                    particle.vel = vr - r * 2 * dot_vr_r / CpuMath::lengthSquared(r);
+                }
+            } else {
+                if (data.particleLastAbsorbedCellIds[index] == cell.id) {
+                    continue;
+                }
+                auto radiationAbsorption = parameters.baseValues.radiationAbsorption[cell.color];
+                if (radiationAbsorption < NEAR_ZERO) {
+                    continue;
+                }
+                auto energyToTransfer = particle.energy * radiationAbsorption;
+                energyToTransfer *= std::max(0.0f, 1.0f - CpuMath::length(cell.vel) * parameters.radiationAbsorptionVelocityPenalty[cell.color]);
+                if (particle.energy < 1) {
+                    energyToTransfer = particle.energy;
+                }
+                cell.energy += energyToTransfer;
+                particle.energy -= energyToTransfer;
+                if (particle.energy < NEAR_ZERO) {
+                    data.particleRemoved[index] = 1;
+                } else {
+                    data.particleLastAbsorbedCellIds[index] = cell.id;
+                }
+            }
+        }
+    }
+}
+
+void CpuParticleProcessor::radiate(CpuSimulationData& data, uint64_t orderKey, float2 pos, float2 vel, int color, float energy)
+{
+    auto const& parameters = data.parameters;
+    if (parameters.numParticleSources > 0) {
+        CpuRandom random(data.randomSeed, data.timestep, orderKey, RandomPurpose_RadiationSource);
+        auto const& source = parameters.particleSources[random.random(parameters.numParticleSources - 1)];
+        pos = {source.posX, source.posY};
+
+        if (source.shapeType == RadiationSourceShapeType_Circular) {
+            auto radius = std::max(1.0f, source.shapeData.circularRadiationSource.radius);
+            float2 delta{0, 0};
+            for (int i = 0; i < 10; ++i) {
+                delta.x = random.random() * radius * 2 - radius;
+                delta.y = random.random() * radius * 2 - radius;
+                if (CpuMath::length(delta) <= radius) {
+                    break;
+                }
+            }
+            pos += delta;
+            if (source.useAngle) {
+                vel = CpuMath::unitVectorOfAngle(source.angle) * random.random(0.5f, 1.0f);
+            } else {
+                vel = CpuMath::normalized(delta) * random.random(0.5f, 1.0f);
+            }
+        }
+        if (source.shapeType == RadiationSourceShapeType_Rectangular) {
+            auto const& rectangle = source.shapeData.rectangularRadiationSource;
+            float2 delta;
+            delta.x = random.random() * rectangle.width - rectangle.width / 2;
+            delta.y = random.random() * rectangle.height - rectangle.height / 2;
+            pos += delta;
+            if (source.useAngle) {
+                vel = CpuMath::unitVectorOfAngle(source.angle) * random.random(0.5f, 1.0f);
+            } else {
+                auto roundSize = std::min(rectangle.width, rectangle.height) / 2;
+                float2 corner1{-rectangle.width / 2, -rectangle.height / 2};
+                float2 corner2{rectangle.width / 2, -rectangle.height / 2};
+                float2 corner3{-rectangle.width / 2, rectangle.height / 2};
+                float2 corner4{rectangle.width / 2, rectangle.height / 2};
+                if (CpuMath::lengthMax(corner1 - delta) <= roundSize) {
+                    vel = CpuMath::normalized(delta - (corner1 + float2{roundSize, roundSize}));
+                } else if (CpuMath::lengthMax(corner2 - delta) <= roundSize) {
+                    vel = CpuMath::normalized(delta - (corner2 + float2{-roundSize, roundSize}));
+                } else if (CpuMath::lengthMax(corner3 - delta) <= roundSize) {
+                    vel = CpuMath::normalized(delta - (corner3 + float2{roundSize, -roundSize}));
+                } else if (CpuMath::lengthMax(corner4 - delta) <= roundSize) {
+                    vel = CpuMath::normalized(delta - (corner4 + float2{-roundSize, -roundSize}));
+                } else {
+                    vel = {0, 0};
+                    auto dx1 = rectangle.width / 2 + delta.x;
+                    auto dx2 = rectangle.width / 2 - delta.x;
+                    auto dy1 = rectangle.height / 2 + delta.y;
+                    auto dy2 = rectangle.height / 2 - delta.y;
+                    if (dx1 <= dy1 && dx1 <= dy2 && delta.x <= 0) {
+                        vel.x = -1;
+                    }
+                    if (dy1 <= dx1 && dy1 <= dx2 && delta.y <= 0) {
+                        vel.y = -1;
+                    }
+                    if (dx2 <= dy1 && dx2 <= dy2 && delta.x > 0) {
+                        vel.x = 1;
+                    }
+                    if (dy2 <= dx1 && dy2 <= dx2 && delta.y > 0) {
+                        vel.y = 1;
+                    }
+                }
+                vel = vel * random.random(0.5f, 1.0f);
+            }
+        }
+    }
+
+    //NOTE: energy pumping into constructors via residual energy is not supported by the cpu backend
+    if (energy > NEAR_ZERO) {
+        data.scheduleNewParticle(orderKey, pos, vel, color, energy);
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CpuSimulationData.h"
+
+class CpuParticleProcessor
+{
+public:
+    static void updateMap(CpuSimulationData& data);
+    static void movement(CpuSimulationData& data);
+    static void collision(CpuSimulationData& data);
+
+    //schedules a new particle which is relocated to a particle source if there are any, thread-safe
+    //orderKey determines the order of the new particles and the random numbers for the relocation
+    static void radiate(CpuSimulationData& data, uint64_t orderKey, float2 pos, float2 vel, int color, float energy);
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Base/SplitMix64.h"
+
+using RandomPurpose = int;
+enum RandomPurpose_
+{
+    RandomPurpose_ForceDecay,
+    RandomPurpose_Radiation,
+    RandomPurpose_RadiationAmount,
+    RandomPurpose_RadiationAngle,
+    RandomPurpose_RadiationSource,
+    RandomPurpose_Decay,
+    RandomPurpose_Edit,
+    RandomPurpose_Mutation
+};
+
+//stateless random numbers for the parallel cpu kernels: each value is a hash of (seed, timestep, entity index, purpose)
+//such that the results do not depend on the number of threads or the order in which the work is processed
+class CpuRandom
+{
+public:
+    CpuRandom(uint64_t seed, uint64_t timestep, uint64_t index, RandomPurpose purpose)
+        : _state(SplitMix64::hash(seed ^ SplitMix64::hash(timestep ^ SplitMix64::hash(index ^ (static_cast<uint64_t>(purpose) << 48)))))
+    {}
+
+    //uniformly distributed in [0, 1)
+    float random()
+    {
+        _state = SplitMix64::hash(_state);
+        return static_cast<float>(_state >> 40) / static_cast<float>(1ull << 24);
+    }
+
+    uint64_t randomUInt64()
+    {
+        _state = SplitMix64::hash(_state);
+        return _state;
+    }
+
+    float random(float min, float max) { return min + random() * (max - min); }
+
+    //uniformly distributed in [0, maxValue]
+    int random(int maxValue) { return static_cast<int>(random() * static_cast<float>(maxValue + 1)) % (maxValue + 1); }
+
+private:
+    uint64_t _state;
+};
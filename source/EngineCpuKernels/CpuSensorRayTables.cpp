@@ -0,0 +1,44 @@
+#include "CpuSensorRayTables.h"
+
+#include <algorithm>
+
+#include "CpuMath.h"
+
+void CpuSensorRayTables::update(SimulationParameters const& parameters)
+{
+    if (_valid && std::equal(std::begin(_ranges), std::end(_ranges), std::begin(parameters.cellFunctionSensorRange))) {
+        return;
+    }
+    _valid = true;
+
+    for (int angleIndex = 0; angleIndex < NumScanAngles; ++angleIndex) {
+        _neighborhoodDirections[angleIndex] = CpuMath::unitVectorOfAngle(getNeighborhoodAngle(angleIndex));
+    }
+
+    for (int color = 0; color < MAX_COLORS; ++color) {
+        auto range = parameters.cellFunctionSensorRange[color];
+        _ranges[color] = range;
+
+        //same accumulation of the radii as in SensorProcessor::searchNeighborhood
+        for (int ownColor = 0; ownColor < 2; ++ownColor) {
+            auto& radii = _neighborhoodRadii[color][ownColor];
+            radii.clear();
+            for (float radius = ownColor ? MinScanDistance : 0.0f; radius <= range; radius += NeighborhoodRadiusStep) {
+                radii.emplace_back(radius);
+            }
+            for (int angleIndex = 0; angleIndex < NumScanAngles; ++angleIndex) {
+                auto& offsets = _neighborhoodOffsets[color][ownColor][angleIndex];
+                offsets.resize(radii.size());
+                for (size_t i = 0; i < radii.size(); ++i) {
+                    offsets[i] = _neighborhoodDirections[angleIndex] * radii[i];
+                }
+            }
+        }
+
+        auto& distances = _fixedAngleDistances[color];
+        distances.resize(NumScanPoints);
+        for (int distanceIndex = 0; distanceIndex < NumScanPoints; ++distanceIndex) {
+            distances[distanceIndex] = MinScanDistance + range / NumScanPoints * toFloat(distanceIndex);
+        }
+    }
+}
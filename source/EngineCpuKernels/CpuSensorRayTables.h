@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include "EngineInterface/Colors.h"
+#include "EngineInterface/SimulationParameters.h"
+#include "EngineInterface/TOs.h"
+
+//scan points of SensorProcessor relative to the sensor cell, precomputed for the sensor ranges of all colors
+//they are rebuilt only when the ranges change such that the scans need neither trigonometric functions nor accumulated radii
+class CpuSensorRayTables
+{
+public:
+    static int constexpr NumScanAngles = 32;
+    static int constexpr NumScanPoints = 64;
+    static auto constexpr NeighborhoodRadiusStep = 8.0f;
+    static auto constexpr MinScanDistance = 14.0f;  //used for the own color in the neighborhood mode and for the fixed angle mode
+
+    void update(SimulationParameters const& parameters);
+
+    //radii of the neighborhood scan in increasing order, beginning at 0 or at MinScanDistance for the own color
+    std::vector<float> const& getNeighborhoodRadii(int color, bool ownColor) const { return _neighborhoodRadii[color][ownColor ? 1 : 0]; }
+
+    //offsets of the scan points along the ray of the angle index, one per radius
+    std::vector<float2> const& getNeighborhoodOffsets(int color, bool ownColor, int angleIndex) const
+    {
+        return _neighborhoodOffsets[color][ownColor ? 1 : 0][angleIndex];
+    }
+
+    static float getNeighborhoodAngle(int angleIndex) { return 360.0f / NumScanAngles * angleIndex; }
+    float2 const& getNeighborhoodDirection(int angleIndex) const { return _neighborhoodDirections[angleIndex]; }
+
+    //distances of the NumScanPoints scan points of the fixed angle mode
+    std::vector<float> const& getFixedAngleDistances(int color) const { return _fixedAngleDistances[color]; }
+
+private:
+    bool _valid = false;
+    ColorVector<float> _ranges = {};
+
+    float2 _neighborhoodDirections[NumScanAngles];
+    std::vector<float> _neighborhoodRadii[MAX_COLORS][2];
+    std::vector<float2> _neighborhoodOffsets[MAX_COLORS][2][NumScanAngles];
+    std::vector<float> _fixedAngleDistances[MAX_COLORS];
+};
@@ -0,0 +1,112 @@
+#include "CpuSimulationData.h"
+
+#include <algorithm>
+
+CpuSimulationData::CpuSimulationData(int2 const& worldSize_, uint64_t timestep_, int numThreads, uint64_t randomSeed_)
+    : timestep(timestep_)
+    , worldSize(worldSize_)
+    , randomSeed(randomSeed_)
+    , threadPool(numThreads)
+{
+    cellMap.init(worldSize);
+    particleMap.init(worldSize);
+    cellNeighbors.init();
+    densityMap.init(worldSize);
+    structuralOperations.init(threadPool.getNumThreads());
+}
+
+uint64_t CpuSimulationData::addAuxiliaryData(uint8_t const* source, uint64_t size)
+{
+    auto result = auxiliaryData.size();
+    auxiliaryData.insert(auxiliaryData.end(), source, source + size);
+    return result;
+}
+
+void CpuSimulationData::reserveAdditionalObjects(ArraySizes const& additionals)
+{
+    cells.reserve(cells.size() + additionals.cellArraySize);
+    particles.reserve(particles.size() + additionals.particleArraySize);
+    auxiliaryData.reserve(auxiliaryData.size() + additionals.auxiliaryDataSize);
+}
+
+int CpuSimulationData::addCell(CellTO const& cell, bool detached)
+{
+    auto result = getNumCells();
+    cells.emplace_back(cell);
+    cellMap.correctPosition(cells.back().pos);
+    cellDetached.emplace_back(detached ? 1 : 0);
+    cellRemoved.emplace_back(0);
+    cellDensities.emplace_back(1.0f);
+    return result;
+}
+
+int CpuSimulationData::addParticle(ParticleTO const& particle)
+{
+    auto result = getNumParticles();
+    particles.emplace_back(particle);
+    particleMap.correctPosition(particles.back().pos);
+    particleLastAbsorbedCellIds.emplace_back(0);
+    particleRemoved.emplace_back(0);
+    return result;
+}
+
+void CpuSimulationData::scheduleNewParticle(uint64_t orderKey, float2 pos, float2 const& vel, int color, float energy)
+{
+    particleMap.correctPosition(pos);
+
+    ParticleTO particle;
+    particle.id = 0;
+    particle.energy = energy;
+    particle.pos = pos;
+    particle.vel = vel;
+    particle.color = color;
+    particle.selected = 0;
+
+    std::lock_guard lock(newParticleMutex);
+    newParticles.emplace_back(CpuNewParticle{orderKey, particle});
+}
+
+void CpuSimulationData::addScheduledParticles()
+{
+    std::sort(newParticles.begin(), newParticles.end(), [](auto const& p1, auto const& p2) { return p1.orderKey < p2.orderKey; });
+    for (auto& newParticle : newParticles) {
+        newParticle.particle.id = createNewId();
+        addParticle(newParticle.particle);
+    }
+    newParticles.clear();
+}
+
+void CpuSimulationData::prepareForNextTimestep()
+{
+    auto numCells = cells.size();
+    cellForces.assign(numCells, {0, 0});
+    cellPrevForces.assign(numCells, {0, 0});
+    cellPosCorrections.assign(numCells, {0, 0});
+    cellNewDensities.resize(numCells);
+    connectionSolver.invalidate();
+    cellVelocities.resize(numCells);
+    cellLivingStates.resize(numCells);
+    for (auto& operations : cellFunctionOperations) {
+        operations.clear();
+    }
+    structuralOperations.clear();
+    newParticles.clear();
+}
+
+void CpuSimulationData::clear()
+{
+    cells.clear();
+    cellDetached.clear();
+    cellRemoved.clear();
+    cellDensities.clear();
+    particles.clear();
+    particleLastAbsorbedCellIds.clear();
+    particleRemoved.clear();
+    auxiliaryData.clear();
+    structuralOperations.clear();
+    newParticles.clear();
+    cellMap.update(cells, cellDetached, cellRemoved);
+    particleMap.update(particles, particleRemoved);
+    cellNeighbors.invalidate();
+    connectionSolver.invalidate();
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "Base/ThreadPool.h"
+#include "EngineInterface/ArraySizes.h"
+#include "EngineInterface/NeuronNetworkEvaluator.h"
+#include "EngineInterface/SimulationParameters.h"
+#include "EngineInterface/TOs.h"
+
+#include "CpuConnectionSolver.h"
+#include "CpuDensityMap.h"
+#include "CpuMap.h"
+#include "CpuNeighborList.h"
+#include "CpuOperations.h"
+#include "CpuSensorRayTables.h"
+#include "CpuStructuralOperationQueue.h"
+
+//host counterpart of SimulationData: the objects are stored in the transfer object layout,
+//cells refer to connected cells by index and to their metadata, neuron weights and genomes by offsets into auxiliaryData
+struct CpuSimulationData
+{
+    CpuSimulationData(int2 const& worldSize, uint64_t timestep, int numThreads = 0, uint64_t randomSeed = 0);
+
+    //world
+    uint64_t timestep;
+    int2 worldSize;
+    SimulationParameters parameters;
+    uint64_t randomSeed;  //fixed for the lifetime of the simulation, not affected by setting or clearing the objects
+    CpuCellMap cellMap;
+    CpuParticleMap particleMap;
+    CpuNeighborList cellNeighbors;  //for the collisions
+    CpuDensityMap densityMap;       //for the sensors
+    int spatialOrderInterval = 50;  //time steps between the reorderings of cells and particles along a Morton curve, 0 disables them
+
+    //objects
+    std::vector<CellTO> cells;
+    std::vector<uint8_t> cellDetached;
+    std::vector<uint8_t> cellRemoved;  //removed cells are kept until the next garbage collection
+    std::vector<float> cellDensities;  //from the fluid forces of the previous time step
+    std::vector<ParticleTO> particles;
+    std::vector<uint64_t> particleLastAbsorbedCellIds;
+    std::vector<uint8_t> particleRemoved;
+    std::vector<uint8_t> auxiliaryData;
+    uint64_t currentId = 1;
+    int currentSmallId = 1;
+
+    //temporary data of a time step
+    std::vector<float2> cellForces;
+    std::vector<float2> cellPrevForces;
+    std::vector<float2> cellPosCorrections;
+    std::vector<float> cellNewDensities;
+    CpuConnectionSolver connectionSolver;  //packed at the first connection force calculation of a time step
+    std::vector<float2> cellVelocities;    //snapshot for passes which mix the velocities of connected cells
+    std::vector<LivingState> cellLivingStates;
+    std::vector<int> cellFunctionOperations[CellFunction_WithoutNoneCount];
+    NeuronNetworkEvaluator neuronNetworkEvaluator;
+    CpuSensorRayTables sensorRayTables;
+    std::vector<CellTO> tempCells;  //garbage collection buffers which are swapped with the object arrays
+    std::vector<ParticleTO> tempParticles;
+    std::vector<uint8_t> tempAuxiliaryData;
+
+    //operations scheduled during parallel passes, they are sorted before processing to be independent of the thread scheduling
+    CpuStructuralOperationQueue structuralOperations;
+    std::mutex newParticleMutex;
+    std::vector<CpuNewParticle> newParticles;
+
+    ThreadPool threadPool;
+
+    int getNumCells() const { return toInt(cells.size()); }
+    int getNumParticles() const { return toInt(particles.size()); }
+    bool isEmpty() const { return cells.empty() && particles.empty(); }
+    //capacities of the object arrays: as on the gpu, transfer objects of these sizes can hold all objects
+    ArraySizes getArraySizes() const { return {cells.capacity(), particles.capacity(), auxiliaryData.capacity()}; }
+    void reserveAdditionalObjects(ArraySizes const& additionals);
+
+    //calls func(index) in parallel for all cells/particles (including removed ones)
+    //func(threadIndex, index) is called instead if func accepts the thread index, e.g. for scheduling operations
+    template <typename Func>
+    void forEachCell(Func const& func, int grainSize = 256);
+    template <typename Func>
+    void forEachParticle(Func const& func, int grainSize = 1024);
+
+    uint64_t createNewId() { return currentId++; }
+    void adaptMaxId(uint64_t id) { currentId = std::max(currentId, id + 1); }
+    void adaptMaxSmallId(int id) { currentSmallId = std::max(currentSmallId, id + 1); }
+
+    //returns the offset of the copied data in auxiliaryData
+    uint64_t addAuxiliaryData(uint8_t const* source, uint64_t size);
+
+    //calls func(dataIndex, size) for each reference from the cell (CellTO or CellTO const) into the auxiliary data
+    template <typename Cell, typename Func>
+    static void forEachAuxiliaryDataReference(Cell& cell, Func const& func);
+
+    int addCell(CellTO const& cell, bool detached = false);
+    int addParticle(ParticleTO const& particle);
+
+    //thread-safe
+    void scheduleNewParticle(uint64_t orderKey, float2 pos, float2 const& vel, int color, float energy);
+
+    void addScheduledParticles();
+    void prepareForNextTimestep();
+    void clear();
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+template <typename Func>
+void CpuSimulationData::forEachCell(Func const& func, int grainSize)
+{
+    threadPool.forEachRange(
+        getNumCells(),
+        [&func](int threadIndex, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                if constexpr (std::is_invocable_v<Func, int, int>) {
+                    func(threadIndex, index);
+                } else {
+                    func(index);
+                }
+            }
+        },
+        grainSize);
+}
+
+template <typename Func>
+void CpuSimulationData::forEachParticle(Func const& func, int grainSize)
+{
+    threadPool.forEachRange(
+        getNumParticles(),
+        [&func](int threadIndex, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                if constexpr (std::is_invocable_v<Func, int, int>) {
+                    func(threadIndex, index);
+                } else {
+                    func(index);
+                }
+            }
+        },
+        grainSize);
+}
+
+template <typename Cell, typename Func>
+void CpuSimulationData::forEachAuxiliaryDataReference(Cell& cell, Func const& func)
+{
+    if (cell.metadata.nameSize > 0) {
+        func(cell.metadata.nameDataIndex, cell.metadata.nameSize);
+    }
+    if (cell.metadata.descriptionSize > 0) {
+        func(cell.metadata.descriptionDataIndex, cell.metadata.descriptionSize);
+    }
+    switch (cell.cellFunction) {
+    case CellFunction_Neuron: {
+        func(cell.cellFunctionData.neuron.weightsAndBiasesDataIndex, sizeof(float) * MAX_CHANNELS * (MAX_CHANNELS + 1));
+    } break;
+    case CellFunction_Constructor: {
+        if (cell.cellFunctionData.constructor.genomeSize > 0) {
+            func(cell.cellFunctionData.constructor.genomeDataIndex, cell.cellFunctionData.constructor.genomeSize);
+        }
+    } break;
+    case CellFunction_Injector: {
+        if (cell.cellFunctionData.injector.genomeSize > 0) {
+            func(cell.cellFunctionData.injector.genomeDataIndex, cell.cellFunctionData.injector.genomeSize);
+        }
+    } break;
+    }
+}
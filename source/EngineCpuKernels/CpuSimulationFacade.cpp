@@ -0,0 +1,261 @@
+#include "CpuSimulationFacade.h"
+
+#include <random>
+
+#include "Base/LoggingService.h"
+#include "EngineInterface/InspectedEntityIds.h"
+
+#include "CpuDataAccess.h"
+#include "CpuEditOperations.h"
+#include "CpuSimulationKernels.h"
+
+namespace
+{
+    uint64_t createRandomSeed()
+    {
+        std::random_device randomDevice;
+        return (static_cast<uint64_t>(randomDevice()) << 32) | randomDevice();
+    }
+}
+
+_CpuSimulationFacade::_CpuSimulationFacade(uint64_t timestep, Settings const& settings, int numThreads, std::optional<uint64_t> randomSeed)
+    : _data(
+          {settings.generalSettings.worldSizeX, settings.generalSettings.worldSizeY},
+          timestep,
+          numThreads,
+          randomSeed ? *randomSeed : createRandomSeed())
+{
+    _settings.generalSettings = settings.generalSettings;
+    _settings.gpuSettings = settings.gpuSettings;
+    setSimulationParameters(settings.simulationParameters);
+    checkAndProcessSimulationParameterChanges();
+
+    log(Priority::Important, "initialize simulation on " + std::to_string(_data.threadPool.getNumThreads()) + " cpu threads");
+}
+
+void* _CpuSimulationFacade::registerImageResource(unsigned int image)
+{
+    return nullptr;
+}
+
+void _CpuSimulationFacade::calcTimestep()
+{
+    checkAndProcessSimulationParameterChanges();
+
+    CpuSimulationKernels::calcTimestep(_data, _statistics);
+
+    std::lock_guard lock(_mutexForSimulationData);
+    ++_data.timestep;
+}
+
+void _CpuSimulationFacade::applyCataclysm(int power)
+{
+    CpuEditOperations::applyCataclysm(_data, power);
+}
+
+void _CpuSimulationFacade::drawVectorGraphics(
+    float2 const& rectUpperLeft,
+    float2 const& rectLowerRight,
+    void* cudaResource,
+    int2 const& imageSize,
+    double zoom)
+{
+    //rendering requires the gpu backend
+}
+
+void _CpuSimulationFacade::getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
+{
+    CpuDataAccess::getData(_data, rectUpperLeft, rectLowerRight, dataTO);
+}
+
+void _CpuSimulationFacade::getSelectedSimulationData(bool includeClusters, DataTO const& dataTO)
+{
+    CpuDataAccess::getSelectedData(_data, includeClusters, dataTO);
+}
+
+void _CpuSimulationFacade::getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO)
+{
+    if (entityIds.size() > Const::MaxInspectedObjects) {
+        return;
+    }
+    CpuDataAccess::getInspectedData(_data, entityIds, dataTO);
+}
+
+void _CpuSimulationFacade::getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
+{
+    CpuDataAccess::getOverlayData(_data, rectUpperLeft, rectLowerRight, dataTO);
+}
+
+void _CpuSimulationFacade::addAndSelectSimulationData(DataTO const& dataTO)
+{
+    CpuEditOperations::removeSelection(_data);
+    CpuDataAccess::addData(_data, dataTO, true, true);
+}
+
+void _CpuSimulationFacade::setSimulationData(DataTO const& dataTO)
+{
+    _data.clear();
+    CpuDataAccess::addData(_data, dataTO, false, false);
+}
+
+void _CpuSimulationFacade::removeSelectedObjects(bool includeClusters)
+{
+    CpuEditOperations::removeSelectedObjects(_data, includeClusters);
+}
+
+void _CpuSimulationFacade::relaxSelectedObjects(bool includeClusters)
+{
+    CpuEditOperations::relaxSelectedObjects(_data, includeClusters);
+}
+
+void _CpuSimulationFacade::uniformVelocitiesForSelectedObjects(bool includeClusters)
+{
+    CpuEditOperations::uniformVelocities(_data, includeClusters);
+}
+
+void _CpuSimulationFacade::makeSticky(bool includeClusters)
+{
+    CpuEditOperations::makeSticky(_data, includeClusters);
+}
+
+void _CpuSimulationFacade::removeStickiness(bool includeClusters)
+{
+    CpuEditOperations::removeStickiness(_data, includeClusters);
+}
+
+void _CpuSimulationFacade::setBarrier(bool value, bool includeClusters)
+{
+    CpuEditOperations::setBarrier(_data, value, includeClusters);
+}
+
+void _CpuSimulationFacade::changeInspectedSimulationData(DataTO const& changeDataTO)
+{
+    CpuDataAccess::changeData(_data, changeDataTO);
+}
+
+void _CpuSimulationFacade::applyForce(ApplyForceData const& applyData)
+{
+    CpuEditOperations::applyForce(_data, applyData);
+}
+
+void _CpuSimulationFacade::switchSelection(PointSelectionData const& switchData)
+{
+    CpuEditOperations::switchSelection(_data, switchData);
+}
+
+void _CpuSimulationFacade::swapSelection(PointSelectionData const& selectionData)
+{
+    CpuEditOperations::swapSelection(_data, selectionData);
+}
+
+void _CpuSimulationFacade::setSelection(AreaSelectionData const& selectionData)
+{
+    CpuEditOperations::setSelection(_data, selectionData);
+}
+
+SelectionShallowData _CpuSimulationFacade::getSelectionShallowData()
+{
+    return CpuEditOperations::getSelectionShallowData(_data);
+}
+
+void _CpuSimulationFacade::shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& shallowUpdateData)
+{
+    CpuEditOperations::shallowUpdateSelectedObjects(_data, shallowUpdateData);
+}
+
+void _CpuSimulationFacade::removeSelection()
+{
+    CpuEditOperations::removeSelection(_data);
+}
+
+void _CpuSimulationFacade::updateSelection()
+{
+    CpuEditOperations::updateSelection(_data);
+}
+
+void _CpuSimulationFacade::colorSelectedObjects(unsigned char color, bool includeClusters)
+{
+    CpuEditOperations::colorSelectedCells(_data, color, includeClusters);
+}
+
+void _CpuSimulationFacade::reconnectSelectedObjects()
+{
+    CpuEditOperations::reconnect(_data);
+}
+
+void _CpuSimulationFacade::setDetached(bool value)
+{
+    CpuEditOperations::setDetached(_data, value);
+}
+
+void _CpuSimulationFacade::setGpuConstants(GpuSettings const& gpuConstants)
+{
+    _settings.gpuSettings = gpuConstants;
+}
+
+SimulationParameters _CpuSimulationFacade::getSimulationParameters() const
+{
+    std::lock_guard lock(_mutexForSimulationParameters);
+    return _newSimulationParameters ? *_newSimulationParameters : _settings.simulationParameters;
+}
+
+void _CpuSimulationFacade::setSimulationParameters(SimulationParameters const& parameters)
+{
+    std::lock_guard lock(_mutexForSimulationParameters);
+    _newSimulationParameters = parameters;
+}
+
+ArraySizes _CpuSimulationFacade::getArraySizes() const
+{
+    return _data.getArraySizes();
+}
+
+StatisticsData _CpuSimulationFacade::getStatistics()
+{
+    return _statistics.calcStatistics(_data);
+}
+
+void _CpuSimulationFacade::resetTimeIntervalStatistics()
+{
+    _statistics.resetAccumulatedStatistics();
+}
+
+uint64_t _CpuSimulationFacade::getCurrentTimestep() const
+{
+    std::lock_guard lock(_mutexForSimulationData);
+    return _data.timestep;
+}
+
+void _CpuSimulationFacade::setCurrentTimestep(uint64_t timestep)
+{
+    std::lock_guard lock(_mutexForSimulationData);
+    _data.timestep = timestep;
+}
+
+void _CpuSimulationFacade::clear()
+{
+    _data.clear();
+}
+
+void _CpuSimulationFacade::resizeArraysIfNecessary(ArraySizes const& additionals)
+{
+    //the host arrays grow on demand during the simulation, only the transfer objects provided by EngineWorker need the reserved sizes
+    _data.reserveAdditionalObjects(additionals);
+}
+
+void _CpuSimulationFacade::testOnly_mutate(uint64_t cellId, MutationType mutationType)
+{
+    CpuEditOperations::mutate(_data, cellId, mutationType);
+}
+
+void _CpuSimulationFacade::checkAndProcessSimulationParameterChanges()
+{
+    std::lock_guard lock(_mutexForSimulationParameters);
+    if (_newSimulationParameters) {
+        _settings.simulationParameters = *_newSimulationParameters;
+        _data.parameters = *_newSimulationParameters;
+        _newSimulationParameters.reset();
+
+        CpuSimulationKernels::prepareForSimulationParametersChanges(_data);
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+
+#include "EngineInterface/SimulationFacade.h"
+
+#include "CpuSimulationData.h"
+#include "CpuSimulationStatistics.h"
+
+//simulation backend running on the cpu with a thread pool, selectable instead of _CudaSimulationFacade
+//NOTE: rendering is not supported, the cell functions besides neurons, nerves and sensors as well as spots are not simulated yet
+class _CpuSimulationFacade : public _SimulationFacade
+{
+public:
+    //a random seed is drawn if none is given
+    _CpuSimulationFacade(uint64_t timestep, Settings const& settings, int numThreads = 0, std::optional<uint64_t> randomSeed = std::nullopt);
+
+    void* registerImageResource(unsigned int image) override;
+
+    void calcTimestep() override;
+    void applyCataclysm(int power) override;
+
+    void drawVectorGraphics(float2 const& rectUpperLeft, float2 const& rectLowerRight, void* cudaResource, int2 const& imageSize, double zoom) override;
+    void getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO) override;
+    void getSelectedSimulationData(bool includeClusters, DataTO const& dataTO) override;
+    void getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO) override;
+    void getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO) override;
+    void addAndSelectSimulationData(DataTO const& dataTO) override;
+    void setSimulationData(DataTO const& dataTO) override;
+    void removeSelectedObjects(bool includeClusters) override;
+    void relaxSelectedObjects(bool includeClusters) override;
+    void uniformVelocitiesForSelectedObjects(bool includeClusters) override;
+    void makeSticky(bool includeClusters) override;
+    void removeStickiness(bool includeClusters) override;
+    void setBarrier(bool value, bool includeClusters) override;
+    void changeInspectedSimulationData(DataTO const& changeDataTO) override;
+
+    void applyForce(ApplyForceData const& applyData) override;
+    void switchSelection(PointSelectionData const& switchData) override;
+    void swapSelection(PointSelectionData const& selectionData) override;
+    void setSelection(AreaSelectionData const& selectionData) override;
+    SelectionShallowData getSelectionShallowData() override;
+    void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& shallowUpdateData) override;
+    void removeSelection() override;
+    void updateSelection() override;
+    void colorSelectedObjects(unsigned char color, bool includeClusters) override;
+    void reconnectSelectedObjects() override;
+    void setDetached(bool value) override;
+
+    void setGpuConstants(GpuSettings const& cudaConstants) override;
+    SimulationParameters getSimulationParameters() const override;
+    void setSimulationParameters(SimulationParameters const& parameters) override;
+
+    ArraySizes getArraySizes() const override;
+
+    StatisticsData getStatistics() override;
+    void resetTimeIntervalStatistics() override;
+    uint64_t getCurrentTimestep() const override;
+    void setCurrentTimestep(uint64_t timestep) override;
+
+    void clear() override;
+
+    void resizeArraysIfNecessary(ArraySizes const& additionals = ArraySizes()) override;
+
+    //for tests
+    void testOnly_mutate(uint64_t cellId, MutationType mutationType) override;
+
+private:
+    void checkAndProcessSimulationParameterChanges();
+
+    mutable std::mutex _mutexForSimulationParameters;
+    std::optional<SimulationParameters> _newSimulationParameters;
+    Settings _settings;
+
+    mutable std::mutex _mutexForSimulationData;
+    CpuSimulationData _data;
+    CpuSimulationStatistics _statistics;
+};
@@ -0,0 +1,60 @@
+#include "CpuSimulationKernels.h"
+
+#include "CpuCellConnectionProcessor.h"
+#include "CpuCellFunctionProcessor.h"
+#include "CpuCellProcessor.h"
+#include "CpuGarbageCollector.h"
+#include "CpuParticleProcessor.h"
+
+void CpuSimulationKernels::calcTimestep(CpuSimulationData& data, CpuSimulationStatistics& statistics)
+{
+    data.prepareForNextTimestep();
+
+    //not all kernels need to be executed in each time step for performance reasons
+    bool considerForcesFromAngleDifferences = (data.timestep % 3 == 0);
+    bool considerInnerFriction = (data.timestep % 3 == 0);
+
+    CpuCellProcessor::updateMap(data);
+    CpuCellProcessor::radiation(data);
+    if (data.parameters.motionType == MotionType_Fluid) {
+        CpuCellProcessor::fluidForces(data);
+    } else {
+        CpuCellProcessor::collisions(data);
+    }
+    CpuCellProcessor::fillDensityMap(data);
+    CpuParticleProcessor::updateMap(data);
+
+    CpuCellProcessor::checkForces(data);
+    CpuCellProcessor::applyForces(data);
+    CpuParticleProcessor::movement(data);
+    CpuParticleProcessor::collision(data);
+
+    CpuCellProcessor::calcConnectionForces(data, considerForcesFromAngleDifferences);
+    CpuCellProcessor::verletPositionUpdate(data);
+    CpuCellProcessor::checkConnections(data);
+    CpuCellProcessor::calcConnectionForces(data, considerForcesFromAngleDifferences);
+    CpuCellProcessor::verletVelocityUpdate(data);
+
+    //cell functions
+    CpuCellProcessor::aging(data);
+    CpuCellProcessor::livingStateTransition(data);
+    CpuCellFunctionProcessor::collectCellFunctionOperations(data);
+    CpuCellFunctionProcessor::processNerves(data, statistics);
+    CpuCellFunctionProcessor::processNeurons(data, statistics);
+    CpuCellFunctionProcessor::processSensors(data, statistics);
+
+    if (considerInnerFriction) {
+        CpuCellProcessor::applyInnerFriction(data);
+    }
+    CpuCellFunctionProcessor::resetFetchedActivities(data);
+    CpuCellProcessor::applyFriction(data);
+    CpuCellProcessor::decay(data);
+
+    CpuCellConnectionProcessor::processOperations(data);
+    CpuGarbageCollector::cleanupAfterTimestep(data);
+}
+
+void CpuSimulationKernels::prepareForSimulationParametersChanges(CpuSimulationData& data)
+{
+    CpuCellProcessor::resetDensity(data);
+}
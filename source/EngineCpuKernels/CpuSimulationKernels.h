@@ -0,0 +1,12 @@
+#pragma once
+
+#include "CpuSimulationData.h"
+#include "CpuSimulationStatistics.h"
+
+//host counterpart of _SimulationKernelsLauncher::calcTimestep
+class CpuSimulationKernels
+{
+public:
+    static void calcTimestep(CpuSimulationData& data, CpuSimulationStatistics& statistics);
+    static void prepareForSimulationParametersChanges(CpuSimulationData& data);
+};
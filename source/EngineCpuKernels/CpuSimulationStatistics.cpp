@@ -0,0 +1,78 @@
+#include "CpuSimulationStatistics.h"
+
+#include <algorithm>
+
+#include "CpuGenomeDecoder.h"
+
+StatisticsData CpuSimulationStatistics::calcStatistics(CpuSimulationData const& data) const
+{
+    StatisticsData result;
+    result.timeline.timestep = calcTimestepStatistics(data);
+    result.timeline.accumulated = _accumulated;
+    result.histogram = calcHistogramData(data);
+    return result;
+}
+
+TimestepStatistics CpuSimulationStatistics::calcTimestepStatistics(CpuSimulationData const& data)
+{
+    TimestepStatistics result;
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        if (data.cellRemoved[index]) {
+            continue;
+        }
+        auto const& cell = data.cells[index];
+        ++result.numCells[cell.color];
+        result.numConnections[cell.color] += cell.numConnections;
+        result.totalEnergy[cell.color] += cell.energy;
+        if (cell.cellFunction == CellFunction_Constructor) {
+            auto const& constructor = cell.cellFunctionData.constructor;
+            auto genome = data.auxiliaryData.data() + constructor.genomeDataIndex;
+            if (CpuGenomeDecoder::containsSelfReplication(genome, constructor.genomeSize)) {
+                ++result.numSelfReplicators[cell.color];
+                result.numGenomeNodes[cell.color] += CpuGenomeDecoder::getNumNodesRecursively(genome, toInt(constructor.genomeSize));
+            }
+        }
+        if (cell.cellFunction == CellFunction_Injector) {
+            auto const& injector = cell.cellFunctionData.injector;
+            if (CpuGenomeDecoder::containsSelfReplication(data.auxiliaryData.data() + injector.genomeDataIndex, injector.genomeSize)) {
+                ++result.numViruses[cell.color];
+            }
+        }
+    }
+    for (int i = 0; i < MAX_COLORS; ++i) {
+        result.numConnections[i] /= 2;
+    }
+
+    for (int index = 0; index < data.getNumParticles(); ++index) {
+        if (data.particleRemoved[index]) {
+            continue;
+        }
+        auto const& particle = data.particles[index];
+        ++result.numParticles[particle.color];
+        result.totalEnergy[particle.color] += particle.energy;
+    }
+    return result;
+}
+
+HistogramData CpuSimulationStatistics::calcHistogramData(CpuSimulationData const& data)
+{
+    HistogramData result;
+    for (int i = 0; i < MAX_COLORS; ++i) {
+        std::fill(result.numCellsByColorBySlot[i], result.numCellsByColorBySlot[i] + MAX_HISTOGRAM_SLOTS, 0);
+    }
+
+    auto isCounted = [&](int index) { return !data.cellRemoved[index] && !data.cells[index].barrier; };
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        if (isCounted(index)) {
+            result.maxValue = std::max(result.maxValue, data.cells[index].age);
+        }
+    }
+    for (int index = 0; index < data.getNumCells(); ++index) {
+        if (isCounted(index)) {
+            auto const& cell = data.cells[index];
+            auto slot = cell.age * MAX_HISTOGRAM_SLOTS / (result.maxValue + 1);
+            ++result.numCellsByColorBySlot[cell.color][slot];
+        }
+    }
+    return result;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <atomic>
+
+#include "EngineInterface/StatisticsData.h"
+
+#include "CpuSimulationData.h"
+
+//host counterpart of SimulationStatistics: the accumulated counters are incremented from the parallel passes,
+//the time step statistics and the histogram are calculated on request
+class CpuSimulationStatistics
+{
+public:
+    void incNumNervePulses(int color) { inc(_accumulated.numNervePulses[color]); }
+    void incNumNeuronActivities(int color) { inc(_accumulated.numNeuronActivities[color]); }
+    void incNumSensorActivities(int color) { inc(_accumulated.numSensorActivities[color]); }
+    void incNumSensorMatches(int color) { inc(_accumulated.numSensorMatches[color]); }
+
+    StatisticsData calcStatistics(CpuSimulationData const& data) const;
+    void resetAccumulatedStatistics() { _accumulated = AccumulatedStatistics(); }
+
+private:
+    static void inc(uint64_t& counter) { std::atomic_ref<uint64_t>(counter).fetch_add(1, std::memory_order_relaxed); }
+
+    static TimestepStatistics calcTimestepStatistics(CpuSimulationData const& data);
+    static HistogramData calcHistogramData(CpuSimulationData const& data);
+
+    AccumulatedStatistics _accumulated;
+};
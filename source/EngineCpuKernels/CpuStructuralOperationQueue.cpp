@@ -0,0 +1,54 @@
+#include "CpuStructuralOperationQueue.h"
+
+#include <algorithm>
+
+#include "Base/Definitions.h"
+
+void CpuStructuralOperationQueue::init(int numThreads)
+{
+    _buffers.resize(numThreads);
+    clear();
+}
+
+std::vector<CpuStructuralOperation>& CpuStructuralOperationQueue::merge()
+{
+    _operations.clear();
+    _operations.reserve(getNumScheduledOperations());
+    for (auto& buffer : _buffers) {
+        for (auto operation : buffer) {
+            if (operation.type == CpuStructuralOperation::Type::AddConnectionPair || operation.type == CpuStructuralOperation::Type::DelConnectionPair) {
+                if (operation.cellIndex > operation.otherCellIndex) {
+                    std::swap(operation.cellIndex, operation.otherCellIndex);
+                }
+            }
+            _operations.emplace_back(operation);
+        }
+        buffer.clear();
+    }
+
+    std::sort(_operations.begin(), _operations.end());
+    _operations.erase(
+        std::unique(
+            _operations.begin(),
+            _operations.end(),
+            [](auto const& op1, auto const& op2) { return op1.type == op2.type && op1.cellIndex == op2.cellIndex && op1.otherCellIndex == op2.otherCellIndex; }),
+        _operations.end());
+    return _operations;
+}
+
+int CpuStructuralOperationQueue::getNumScheduledOperations() const
+{
+    size_t result = 0;
+    for (auto const& buffer : _buffers) {
+        result += buffer.size();
+    }
+    return toInt(result);
+}
+
+void CpuStructuralOperationQueue::clear()
+{
+    for (auto& buffer : _buffers) {
+        buffer.clear();
+    }
+    _operations.clear();
+}
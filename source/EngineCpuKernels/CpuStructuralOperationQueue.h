@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+
+#include "CpuOperations.h"
+
+//the structural operations scheduled during parallel passes are appended to per-thread buffers without locking
+//merging yields an order which only depends on the scheduled operations and not on the thread scheduling
+class CpuStructuralOperationQueue
+{
+public:
+    void init(int numThreads);
+
+    //threadIndex has to be the one passed by the ThreadPool to the calling pass, serial code uses 0
+    void schedule(int threadIndex, CpuStructuralOperation const& operation) { _buffers[threadIndex].emplace_back(operation); }
+
+    //moves the operations of all buffers into one list and sorts it in the phase order of the gpu (additions, cell deletions, connection deletions)
+    //connection pairs are normalized to cellIndex < otherCellIndex such that operations scheduled from both cells occur only once
+    std::vector<CpuStructuralOperation>& merge();
+
+    int getNumScheduledOperations() const;
+    void clear();
+
+private:
+    std::vector<std::vector<CpuStructuralOperation>> _buffers;
+    std::vector<CpuStructuralOperation> _operations;
+};
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <memory>
+
+class _CpuSimulationFacade;
+using CpuSimulationFacade = std::shared_ptr<_CpuSimulationFacade>;
@@ -5,7 +5,7 @@
 
 #include "SimulationData.cuh"
 #include "Cell.cuh"
-#include "TOs.cuh"
+#include "EngineInterface/TOs.h"
 
 class CellComputationProcessor
 {
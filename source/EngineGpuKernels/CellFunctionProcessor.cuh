@@ -1,6 +1,6 @@
 #pragma once
 
-#include "TOs.cuh"
+#include "EngineInterface/TOs.h"
 #include "Base.cuh"
 #include "Map.cuh"
 #include "ObjectFactory.cuh"
@@ -5,7 +5,7 @@
 
 #include "EngineInterface/CellFunctionConstants.h"
 
-#include "TOs.cuh"
+#include "EngineInterface/TOs.h"
 #include "Base.cuh"
 #include "ObjectFactory.cuh"
 #include "Map.cuh"
@@ -4,7 +4,7 @@
 #include "sm_60_atomic_functions.h"
 
 #include "EngineInterface/InspectedEntityIds.h"
-#include "TOs.cuh"
+#include "EngineInterface/TOs.h"
 #include "Base.cuh"
 #include "Map.cuh"
 #include "ObjectFactory.cuh"
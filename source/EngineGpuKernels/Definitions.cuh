@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "EngineInterface/ArraySizes.h"
+#include "EngineInterface/InteractionData.h"
 
 struct Cell;
 struct Token;
@@ -39,24 +40,3 @@ using StatisticsKernelsLauncher = std::shared_ptr<_StatisticsKernelsLauncher>;
 
 class _TestKernelsLauncher;
 using TestKernelsLauncher = std::shared_ptr<_TestKernelsLauncher>;
-
-struct ApplyForceData
-{
-    float2 startPos;
-    float2 endPos;
-    float2 force;
-    float radius;
-    bool onlyRotation;
-};
-
-struct PointSelectionData
-{
-    float2 pos;
-    float radius;
-};
-
-struct AreaSelectionData
-{
-    float2 startPos;
-    float2 endPos;
-};
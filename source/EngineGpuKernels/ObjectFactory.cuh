@@ -6,7 +6,7 @@
 
 #include "Base.cuh"
 #include "ConstantMemory.cuh"
-#include "TOs.cuh"
+#include "EngineInterface/TOs.h"
 #include "Map.cuh"
 #include "Particle.cuh"
 #include "Physics.cuh"
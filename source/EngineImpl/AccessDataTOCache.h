@@ -4,7 +4,7 @@
 
 #include "EngineInterface/ArraySizes.h"
 #include "EngineInterface/GpuSettings.h"
-#include "EngineGpuKernels/TOs.cuh"
+#include "EngineInterface/TOs.h"
 
 #include "Definitions.h"
 
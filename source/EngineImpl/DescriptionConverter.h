@@ -7,7 +7,7 @@
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/OverlayDescriptions.h"
 #include "EngineInterface/SimulationParameters.h"
-#include "EngineGpuKernels/TOs.cuh"
+#include "EngineInterface/TOs.h"
 #include "Definitions.h"
 
 class DescriptionConverter
@@ -2,8 +2,12 @@
 
 #include <chrono>
 
-#include "EngineGpuKernels/TOs.cuh"
+#include "Base/Exceptions.h"
+#include "EngineInterface/TOs.h"
+#ifdef ALIEN_CUDA
 #include "EngineGpuKernels/CudaSimulationFacade.cuh"
+#endif
+#include "EngineCpuKernels/CpuSimulationFacade.h"
 #include "AccessDataTOCache.h"
 #include "DescriptionConverter.h"
 
@@ -11,11 +15,29 @@ namespace
 {
     std::chrono::milliseconds const FrameTimeout(500);
     std::chrono::milliseconds const StatisticsUpdate(30);
+
+    void checkBackend(SimulationBackend backend)
+    {
+#ifndef ALIEN_CUDA
+        if (backend == SimulationBackend_Cuda) {
+            throw SystemRequirementNotMetException("This build does not contain the CUDA backend.");
+        }
+#endif
+    }
 }
 
+EngineWorker::EngineWorker(SimulationBackend backend)
+    : _backend(backend)
+{}
+
 void EngineWorker::initCuda()
 {
-    _CudaSimulationFacade::initCuda();
+    checkBackend(_backend);
+#ifdef ALIEN_CUDA
+    if (_backend == SimulationBackend_Cuda) {
+        _CudaSimulationFacade::initCuda();
+    }
+#endif
 }
 
 void EngineWorker::newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters)
@@ -24,10 +46,18 @@ void EngineWorker::newSimulation(uint64_t timestep, GeneralSettings const& gener
     _settings.generalSettings = generalSettings;
     _settings.simulationParameters = parameters;
     _dataTOCache = std::make_shared<_AccessDataTOCache>();
-    _cudaSimulation = std::make_shared<_CudaSimulationFacade>(timestep, _settings);
+    checkBackend(_backend);
+    if (_backend == SimulationBackend_Cpu) {
+        _simulationFacade = std::make_shared<_CpuSimulationFacade>(timestep, _settings);
+    }
+#ifdef ALIEN_CUDA
+    else {
+        _simulationFacade = std::make_shared<_CudaSimulationFacade>(timestep, _settings);
+    }
+#endif
 
     if (_imageResourceToRegister) {
-        _cudaResource = _cudaSimulation->registerImageResource(*_imageResourceToRegister);
+        _cudaResource = _simulationFacade->registerImageResource(*_imageResourceToRegister);
         _imageResourceToRegister = std::nullopt;
     }
     updateStatistics();
@@ -36,20 +66,20 @@ void EngineWorker::newSimulation(uint64_t timestep, GeneralSettings const& gener
 void EngineWorker::clear()
 {
     EngineWorkerGuard access(this);
-    return _cudaSimulation->clear();
+    return _simulationFacade->clear();
 }
 
 void EngineWorker::registerImageResource(void* image)
 {
     GLuint imageId = reinterpret_cast<uintptr_t>(image);
-    if (!_cudaSimulation) {
+    if (!_simulationFacade) {
 
         //cuda is not initialized yet => register image resource later
         _imageResourceToRegister = imageId;
     } else {
 
         EngineWorkerGuard access(this);
-        _cudaResource = _cudaSimulation->registerImageResource(imageId);
+        _cudaResource = _simulationFacade->registerImageResource(imageId);
     }
 }
 
@@ -63,7 +93,7 @@ void EngineWorker::tryDrawVectorGraphics(
 
 
     if (!access.isTimeout()) {
-        _cudaSimulation->drawVectorGraphics(
+        _simulationFacade->drawVectorGraphics(
             {rectUpperLeft.x, rectUpperLeft.y},
             {rectLowerRight.x, rectLowerRight.y},
             _cudaResource,
@@ -82,7 +112,7 @@ std::optional<OverlayDescription> EngineWorker::tryDrawVectorGraphicsAndReturnOv
     EngineWorkerGuard access(this, FrameTimeout);
 
     if (!access.isTimeout()) {
-        _cudaSimulation->drawVectorGraphics(
+        _simulationFacade->drawVectorGraphics(
             {rectUpperLeft.x, rectUpperLeft.y},
             {rectLowerRight.x, rectLowerRight.y},
             _cudaResource,
@@ -91,7 +121,7 @@ std::optional<OverlayDescription> EngineWorker::tryDrawVectorGraphicsAndReturnOv
 
         DataTO dataTO = provideTO();
 
-        _cudaSimulation->getOverlayData(
+        _simulationFacade->getOverlayData(
             {toInt(rectUpperLeft.x), toInt(rectUpperLeft.y)},
             int2{toInt(rectLowerRight.x), toInt(rectLowerRight.y)},
             dataTO);
@@ -131,7 +161,7 @@ ClusteredDataDescription EngineWorker::getClusteredSimulationData(IntVector2D co
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getSimulationData(
+    _simulationFacade->getSimulationData(
         {rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
@@ -146,7 +176,7 @@ DataDescription EngineWorker::getSimulationData(IntVector2D const& rectUpperLeft
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
+    _simulationFacade->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
 
@@ -160,7 +190,7 @@ ClusteredDataDescription EngineWorker::getSelectedClusteredSimulationData(bool i
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getSelectedSimulationData(includeClusters, dataTO);
+    _simulationFacade->getSelectedSimulationData(includeClusters, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
 
@@ -174,7 +204,7 @@ DataDescription EngineWorker::getSelectedSimulationData(bool includeClusters)
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getSelectedSimulationData(includeClusters, dataTO);
+    _simulationFacade->getSelectedSimulationData(includeClusters, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
 
@@ -189,7 +219,7 @@ DataDescription EngineWorker::getInspectedSimulationData(std::vector<uint64_t> o
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getInspectedSimulationData(objectsIds, dataTO);
+    _simulationFacade->getInspectedSimulationData(objectsIds, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
 
@@ -212,13 +242,13 @@ void EngineWorker::addAndSelectSimulationData(DataDescription const& dataToUpdat
 
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->resizeArraysIfNecessary(arraySizes);
+    _simulationFacade->resizeArraysIfNecessary(arraySizes);
 
     DataTO dataTO = provideTO();
 
     converter.convertDescriptionToTO(dataTO, dataToUpdate);
 
-    _cudaSimulation->addAndSelectSimulationData(dataTO);
+    _simulationFacade->addAndSelectSimulationData(dataTO);
     updateStatistics();
 }
 
@@ -228,13 +258,13 @@ void EngineWorker::setClusteredSimulationData(ClusteredDataDescription const& da
 
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
+    _simulationFacade->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
 
     DataTO dataTO = provideTO();
 
     converter.convertDescriptionToTO(dataTO, dataToUpdate);
 
-    _cudaSimulation->setSimulationData(dataTO);
+    _simulationFacade->setSimulationData(dataTO);
     updateStatistics();
 }
 
@@ -244,12 +274,12 @@ void EngineWorker::setSimulationData(DataDescription const& dataToUpdate)
 
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
+    _simulationFacade->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
 
     DataTO dataTO = provideTO();
     converter.convertDescriptionToTO(dataTO, dataToUpdate);
 
-    _cudaSimulation->setSimulationData(dataTO);
+    _simulationFacade->setSimulationData(dataTO);
     updateStatistics();
 }
 
@@ -257,7 +287,7 @@ void EngineWorker::removeSelectedObjects(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->removeSelectedObjects(includeClusters);
+    _simulationFacade->removeSelectedObjects(includeClusters);
     updateStatistics();
 }
 
@@ -265,35 +295,35 @@ void EngineWorker::relaxSelectedObjects(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->relaxSelectedObjects(includeClusters);
+    _simulationFacade->relaxSelectedObjects(includeClusters);
 }
 
 void EngineWorker::uniformVelocitiesForSelectedObjects(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->uniformVelocitiesForSelectedObjects(includeClusters);
+    _simulationFacade->uniformVelocitiesForSelectedObjects(includeClusters);
 }
 
 void EngineWorker::makeSticky(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->makeSticky(includeClusters);
+    _simulationFacade->makeSticky(includeClusters);
 }
 
 void EngineWorker::removeStickiness(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->removeStickiness(includeClusters);
+    _simulationFacade->removeStickiness(includeClusters);
 }
 
 void EngineWorker::setBarrier(bool value, bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->setBarrier(value, includeClusters);
+    _simulationFacade->setBarrier(value, includeClusters);
 }
 
 void EngineWorker::changeCell(CellDescription const& changedCell)
@@ -305,7 +335,7 @@ void EngineWorker::changeCell(CellDescription const& changedCell)
     DescriptionConverter converter(_settings.simulationParameters);
     converter.convertDescriptionToTO(dataTO, changedCell);
 
-    _cudaSimulation->changeInspectedSimulationData(dataTO);
+    _simulationFacade->changeInspectedSimulationData(dataTO);
 }
 
 void EngineWorker::changeParticle(ParticleDescription const& changedParticle)
@@ -317,21 +347,21 @@ void EngineWorker::changeParticle(ParticleDescription const& changedParticle)
     DescriptionConverter converter(_settings.simulationParameters);
     converter.convertDescriptionToTO(dataTO, changedParticle);
 
-    _cudaSimulation->changeInspectedSimulationData(dataTO);
+    _simulationFacade->changeInspectedSimulationData(dataTO);
 }
 
 void EngineWorker::calcSingleTimestep()
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->calcTimestep();
+    _simulationFacade->calcTimestep();
     updateStatistics();
 }
 
 void EngineWorker::applyCataclysm(int power)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->applyCataclysm(power);
+    _simulationFacade->applyCataclysm(power);
 }
 
 void EngineWorker::beginShutdown()
@@ -343,7 +373,7 @@ void EngineWorker::endShutdown()
 {
     _isSimulationRunning = false;
     _isShutdown = false;
-    _cudaSimulation.reset();
+    _simulationFacade.reset();
 }
 
 int EngineWorker::getTpsRestriction() const
@@ -364,24 +394,24 @@ float EngineWorker::getTps() const
 
 uint64_t EngineWorker::getCurrentTimestep() const
 {
-    return _cudaSimulation->getCurrentTimestep();
+    return _simulationFacade->getCurrentTimestep();
 }
 
 void EngineWorker::setCurrentTimestep(uint64_t value)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->setCurrentTimestep(value);
+    _simulationFacade->setCurrentTimestep(value);
     resetTimeIntervalStatistics();
 }
 
 SimulationParameters EngineWorker::getSimulationParameters() const
 {
-    return _cudaSimulation->getSimulationParameters();
+    return _simulationFacade->getSimulationParameters();
 }
 
 void EngineWorker::setSimulationParameters(SimulationParameters const& parameters)
 {
-    _cudaSimulation->setSimulationParameters(parameters);
+    _simulationFacade->setSimulationParameters(parameters);
 }
 
 void EngineWorker::setGpuSettings_async(GpuSettings const& gpuSettings)
@@ -403,31 +433,31 @@ void EngineWorker::applyForce_async(
 void EngineWorker::switchSelection(RealVector2D const& pos, float radius)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->switchSelection(PointSelectionData{{pos.x, pos.y}, radius});
+    _simulationFacade->switchSelection(PointSelectionData{{pos.x, pos.y}, radius});
 }
 
 void EngineWorker::swapSelection(RealVector2D const& pos, float radius)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->swapSelection(PointSelectionData{{pos.x, pos.y}, radius});
+    _simulationFacade->swapSelection(PointSelectionData{{pos.x, pos.y}, radius});
 }
 
 SelectionShallowData EngineWorker::getSelectionShallowData()
 {
     EngineWorkerGuard access(this);
-    return _cudaSimulation->getSelectionShallowData();
+    return _simulationFacade->getSelectionShallowData();
 }
 
 void EngineWorker::setSelection(RealVector2D const& startPos, RealVector2D const& endPos)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->setSelection(AreaSelectionData{{startPos.x, startPos.y}, {endPos.x, endPos.y}});
+    _simulationFacade->setSelection(AreaSelectionData{{startPos.x, startPos.y}, {endPos.x, endPos.y}});
 }
 
 void EngineWorker::removeSelection()
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->removeSelection();
+    _simulationFacade->removeSelection();
 
     updateStatistics();
 }
@@ -435,13 +465,13 @@ void EngineWorker::removeSelection()
 void EngineWorker::updateSelection()
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->updateSelection();
+    _simulationFacade->updateSelection();
 }
 
 void EngineWorker::shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& updateData)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->shallowUpdateSelectedObjects(updateData);
+    _simulationFacade->shallowUpdateSelectedObjects(updateData);
 
     updateStatistics();
 }
@@ -449,7 +479,7 @@ void EngineWorker::shallowUpdateSelectedObjects(ShallowUpdateSelectionData const
 void EngineWorker::colorSelectedObjects(unsigned char color, bool includeClusters)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->colorSelectedObjects(color, includeClusters);
+    _simulationFacade->colorSelectedObjects(color, includeClusters);
 
     updateStatistics();
 }
@@ -457,13 +487,13 @@ void EngineWorker::colorSelectedObjects(unsigned char color, bool includeCluster
 void EngineWorker::reconnectSelectedObjects()
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->reconnectSelectedObjects();
+    _simulationFacade->reconnectSelectedObjects();
 }
 
 void EngineWorker::setDetached(bool value)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->setDetached(value);
+    _simulationFacade->setDetached(value);
 }
 
 void EngineWorker::runThreadLoop()
@@ -476,7 +506,7 @@ void EngineWorker::runThreadLoop()
 
             if (!_syncSimulationWithRendering && _accessState == 0) {
                 if (_isSimulationRunning.load()) {
-                    _cudaSimulation->calcTimestep();
+                    _simulationFacade->calcTimestep();
 
                     if (++_statisticsCounter == 3) {  //for performance reasons...
                         updateStatistics(true);
@@ -518,18 +548,18 @@ bool EngineWorker::isSimulationRunning() const
 void EngineWorker::testOnly_mutate(uint64_t cellId, MutationType mutationType)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->testOnly_mutate(cellId, mutationType);
+    _simulationFacade->testOnly_mutate(cellId, mutationType);
 }
 
 DataTO EngineWorker::provideTO()
 {
-    return _dataTOCache->getDataTO(_cudaSimulation->getArraySizes());
+    return _dataTOCache->getDataTO(_simulationFacade->getArraySizes());
 }
 
 void EngineWorker::resetTimeIntervalStatistics()
 {
     std::lock_guard guard(_mutexForStatistics);
-    _cudaSimulation->resetTimeIntervalStatistics();
+    _simulationFacade->resetTimeIntervalStatistics();
 }
 
 void EngineWorker::updateStatistics(bool afterMinDuration)
@@ -538,7 +568,7 @@ void EngineWorker::updateStatistics(bool afterMinDuration)
     if (!afterMinDuration  || !_lastStatisticsUpdateTime || now - *_lastStatisticsUpdateTime > StatisticsUpdate) {
 
         std::lock_guard guard(_mutexForStatistics);
-        _lastStatistics = _cudaSimulation->getStatistics();
+        _lastStatistics = _simulationFacade->getStatistics();
         _lastStatisticsUpdateTime = now;
     }
 }
@@ -547,12 +577,12 @@ void EngineWorker::processJobs()
 {
     std::unique_lock<std::mutex> asyncJobsLock(_mutexForAsyncJobs);
     if (_updateGpuSettingsJob) {
-        _cudaSimulation->setGpuConstants(*_updateGpuSettingsJob);
+        _simulationFacade->setGpuConstants(*_updateGpuSettingsJob);
         _updateGpuSettingsJob = std::nullopt;
     }
     if (!_applyForceJobs.empty()) {
         for (auto const& applyForceJob : _applyForceJobs) {
-            _cudaSimulation->applyForce(
+            _simulationFacade->applyForce(
                 {{applyForceJob.start.x, applyForceJob.start.y},
                  {applyForceJob.end.x, applyForceJob.end.y},
                  {applyForceJob.force.x, applyForceJob.force.y},
@@ -20,7 +20,7 @@
 #include "EngineInterface/SelectionShallowData.h"
 #include "EngineInterface/ShallowUpdateSelectionData.h"
 #include "EngineInterface/MutationType.h"
-#include "EngineGpuKernels/Definitions.h"
+#include "EngineInterface/SimulationBackend.h"
 
 #include "Definitions.h"
 
@@ -36,6 +36,8 @@ class EngineWorker
 {
     friend class EngineWorkerGuard;
 public:
+    EngineWorker(SimulationBackend backend = DefaultSimulationBackend);
+
     void initCuda();
 
     void newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters);
@@ -120,7 +122,8 @@ private:
     void measureTPS();
     void slowdownTPS();
 
-    CudaSimulationFacade _cudaSimulation;
+    SimulationBackend _backend;
+    SimulationFacade _simulationFacade;
 
     //settings
     Settings _settings;
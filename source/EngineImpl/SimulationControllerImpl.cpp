@@ -2,6 +2,10 @@
 
 #include "EngineInterface/Descriptions.h"
 
+_SimulationControllerImpl::_SimulationControllerImpl(SimulationBackend backend)
+    : _worker(backend)
+{}
+
 void _SimulationControllerImpl::initCuda()
 {
     _worker.initCuda();
@@ -315,6 +319,11 @@ StatisticsData _SimulationControllerImpl::getStatistics() const
     return _worker.getStatistics();
 }
 
+GenomeAnalyticsData _SimulationControllerImpl::getGenomeAnalytics()
+{
+    return GenomeAnalytics::analyze(getSimulationData());
+}
+
 std::optional<int> _SimulationControllerImpl::getTpsRestriction() const
 {
     auto result = _worker.getTpsRestriction();
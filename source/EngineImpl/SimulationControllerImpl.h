@@ -15,6 +15,7 @@
 class _SimulationControllerImpl : public _SimulationController
 {
 public:
+    _SimulationControllerImpl(SimulationBackend backend = DefaultSimulationBackend);
 
     void initCuda() override;
 
@@ -99,6 +100,7 @@ public:
     GeneralSettings getGeneralSettings() const override;
     IntVector2D getWorldSize() const override;
     StatisticsData getStatistics() const override;
+    GenomeAnalyticsData getGenomeAnalytics() override;
 
     std::optional<int> getTpsRestriction() const override;
     void setTpsRestriction(std::optional<int> const& value) override;
@@ -11,6 +11,7 @@ struct SimulationParameters;
 
 struct ClusteredDataDescription;
 struct DataDescription;
+class SharedDataDescription;
 struct ClusterDescription;
 struct CellDescription;
 struct ParticleDescription;
@@ -23,6 +24,9 @@ struct Settings;
 class _SimulationController;
 using SimulationController = std::shared_ptr<_SimulationController>;
 
+class _SimulationFacade;
+using SimulationFacade = std::shared_ptr<_SimulationFacade>;
+
 struct TimelineStatistics;
 struct HistogramData;
 struct StatisticsData;
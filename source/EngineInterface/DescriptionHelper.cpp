@@ -1,14 +1,21 @@
 #include "DescriptionHelper.h"
 
 #include <cmath>
+#include <numeric>
+#include <random>
+
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/map.hpp>
 
 #include "Base/NumberGenerator.h"
 #include "Base/Math.h"
+#include "Base/Parallel.h"
+#include "GenomeConstants.h"
 #include "GenomeDescriptions.h"
 #include "SpaceCalculator.h"
 #include "GenomeDescriptionConverter.h"
+#include "GenomeScanner.h"
+#include "SharedDataDescription.h"
 
 DataDescription DescriptionHelper::createRect(CreateRectParameters const& parameters)
 {
@@ -224,20 +231,14 @@ namespace
     }
 }
 
-DataDescription DescriptionHelper::gridMultiply(DataDescription const& input, GridMultiplyParameters const& parameters)
+DataDescription DescriptionHelper::gridMultiply(SharedDataDescription const& input, GridMultiplyParameters const& parameters)
 {
     DataDescription result;
-    auto clone = input;
-    auto cloneWithoutMetadata = input;
-    removeMetadata(cloneWithoutMetadata);
+    auto inputWithoutMetadata = input;
+    removeMetadata(inputWithoutMetadata);
     for (int i = 0; i < parameters._horizontalNumber; ++i) {
         for (int j = 0; j < parameters._verticalNumber; ++j) {
-            auto templateData = [&] {
-                if (i == 0 && j == 0) {
-                    return clone;
-                }
-                return cloneWithoutMetadata;
-            }();
+            auto templateData = i == 0 && j == 0 ? input.toDataDescription() : inputWithoutMetadata.toDataDescription();
             templateData.shift({i * parameters._horizontalDistance, j * parameters._verticalDistance});
             templateData.rotate(i * parameters._horizontalAngleInc + j * parameters._verticalAngleInc);
             templateData.accelerate(
@@ -246,7 +247,7 @@ DataDescription DescriptionHelper::gridMultiply(DataDescription const& input, Gr
 
             generateNewIds(templateData);
             generateNewCreatureIds(templateData);
-            result.add(templateData);
+            result.add(std::move(templateData));
         }
     }
 
@@ -254,7 +255,7 @@ DataDescription DescriptionHelper::gridMultiply(DataDescription const& input, Gr
 }
 
 DataDescription DescriptionHelper::randomMultiply(
-    DataDescription const& input,
+    SharedDataDescription const& input,
     RandomMultiplyParameters const& parameters,
     IntVector2D const& worldSize,
     DataDescription&& existentData,
@@ -275,16 +276,17 @@ DataDescription DescriptionHelper::randomMultiply(
     }
 
     //do multiplication
-    DataDescription result = input;
+    auto result = input.toDataDescription();
     generateNewIds(result);
+    auto inputWithoutMetadata = input;
+    removeMetadata(inputWithoutMetadata);
     auto& numberGen = NumberGenerator::getInstance();
     for (int i = 0; i < parameters._number; ++i) {
         bool overlapping = false;
         DataDescription copy;
         int attempts = 0;
         do {
-            copy = input;
-            removeMetadata(copy);
+            copy = inputWithoutMetadata.toDataDescription();
             copy.shift({toFloat(numberGen.getRandomReal(0, toInt(worldSize.x))), toFloat(numberGen.getRandomReal(0, toInt(worldSize.y)))});
             copy.rotate(toInt(numberGen.getRandomReal(parameters._minAngle, parameters._maxAngle)));
             copy.accelerate(
@@ -310,17 +312,15 @@ DataDescription DescriptionHelper::randomMultiply(
 
         generateNewIds(copy);
         generateNewCreatureIds(copy);
-        result.add(copy);
 
-        //add copy to existentData for overlapping check
+        //add copy to occupancy map for overlapping check
         if (parameters._overlappingCheck) {
             for (auto const& cell : copy.cells) {
-                auto index = toInt(existentData.cells.size());
-                existentData.cells.emplace_back(cell);
                 auto intPos = toIntVector2D(spaceCalculator.getCorrectedPosition(cell.pos));
                 cellPosBySlot[intPos].emplace_back(cell.pos);
             }
         }
+        result.add(std::move(copy));
     }
 
     return result;
@@ -377,143 +377,284 @@ void DescriptionHelper::removeStickiness(DataDescription& data)
     }
 }
 
-void DescriptionHelper::correctConnections(ClusteredDataDescription& data, IntVector2D const& worldSize)
+namespace
 {
-    auto threshold = std::min(worldSize.x, worldSize.y) /3;
-    std::unordered_map<uint64_t, CellDescription&> cellById;
-    for (auto& cluster : data.clusters) {
-        for (auto& cell : cluster.cells) {
-            cellById.emplace(cell.id, cell);
-        }
-    }
-    for (auto& cluster : data.clusters) {
-        for (auto& cell: cluster.cells) {
-            std::vector<ConnectionDescription> newConnections;
-            float angleToAdd = 0;
-            for (auto connection : cell.connections) {
-                auto& connectingCell = cellById.at(connection.cellId);
-                if (/*spaceCalculator.distance*/Math::length(cell.pos - connectingCell.pos) > threshold) {
-                    angleToAdd += connection.angleFromPrevious;
-                } else {
-                    connection.angleFromPrevious += angleToAdd;
-                    angleToAdd = 0;
-                    newConnections.emplace_back(connection);
+    auto constexpr MinClustersPerThread = 64;
+}
+
+void DescriptionHelper::correctConnections(ClusteredDataDescription& data, IntVector2D const& worldSize, float maxConnectionDistance)
+{
+    SpaceCalculator spaceCalculator(worldSize);
+
+    std::vector<std::pair<uint64_t, RealVector2D>> cellPosById;
+    for (auto const& cluster : data.clusters) {
+        for (auto const& cell : cluster.cells) {
+            cellPosById.emplace_back(cell.id, cell.pos);
+        }
+    }
+    std::ranges::sort(cellPosById, {}, [](auto const& element) { return element.first; });
+
+    auto isConnectionValid = [&](CellDescription const& cell, ConnectionDescription const& connection) {
+        auto findResult = std::ranges::lower_bound(cellPosById, connection.cellId, {}, [](auto const& element) { return element.first; });
+        if (findResult == cellPosById.end() || findResult->first != connection.cellId) {
+            return false;
+        }
+        return spaceCalculator.distance(cell.pos, findResult->second) <= maxConnectionDistance;
+    };
+
+    Parallel::forEachChunk(
+        toInt(data.clusters.size()),
+        [&](int, int startIndex, int endIndex) {
+            for (int i = startIndex; i < endIndex; ++i) {
+                for (auto& cell : data.clusters.at(i).cells) {
+                    if (std::ranges::all_of(cell.connections, [&](auto const& connection) { return isConnectionValid(cell, connection); })) {
+                        continue;
+                    }
+                    std::vector<ConnectionDescription> newConnections;
+                    float angleToAdd = 0;
+                    for (auto connection : cell.connections) {
+                        if (!isConnectionValid(cell, connection)) {
+                            angleToAdd += connection.angleFromPrevious;
+                        } else {
+                            connection.angleFromPrevious += angleToAdd;
+                            angleToAdd = 0;
+                            newConnections.emplace_back(connection);
+                        }
+                    }
+                    if (angleToAdd > NEAR_ZERO && !newConnections.empty()) {
+                        newConnections.front().angleFromPrevious += angleToAdd;
+                    }
+                    cell.connections = std::move(newConnections);
                 }
             }
-            if (angleToAdd > NEAR_ZERO && !newConnections.empty()) {
-                newConnections.front().angleFromPrevious += angleToAdd;
-            }
-            cell.connections = newConnections;
-        }
+        },
+        MinClustersPerThread);
+}
+
+namespace
+{
+    //calls func(cluster, randomEngine) in parallel with a separate random number stream per thread
+    template <typename Func>
+    void executeForEachClusterInParallel(ClusteredDataDescription& data, Func const& func)
+    {
+        auto numClusters = toInt(data.clusters.size());
+        auto numChunks = Parallel::getNumChunks(numClusters, MinClustersPerThread);
+        std::vector<uint32_t> seeds;
+        for (int i = 0; i < numChunks; ++i) {
+            seeds.emplace_back(NumberGenerator::getInstance().getRandomInt());
+        }
+        Parallel::forEachChunk(
+            numClusters,
+            [&](int chunkIndex, int startIndex, int endIndex) {
+                std::mt19937 randomEngine(seeds.at(chunkIndex));
+                for (int i = startIndex; i < endIndex; ++i) {
+                    func(data.clusters.at(i), randomEngine);
+                }
+            },
+            MinClustersPerThread);
+    }
+
+    template <typename T>
+    T const& getRandomElement(std::vector<T> const& elements, std::mt19937& randomEngine)
+    {
+        return elements.at(std::uniform_int_distribution<size_t>(0, elements.size() - 1)(randomEngine));
     }
 }
 
 void DescriptionHelper::randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes)
 {
-    for (auto& cluster : data.clusters) {
-        auto newColor = colorCodes[NumberGenerator::getInstance().getRandomInt(toInt(colorCodes.size()))];
+    if (colorCodes.empty()) {
+        return;
+    }
+    executeForEachClusterInParallel(data, [&](ClusterDescription& cluster, std::mt19937& randomEngine) {
+        auto newColor = getRandomElement(colorCodes, randomEngine);
         for (auto& cell : cluster.cells) {
             cell.color = newColor;
         }
-    }
+    });
 }
 
 namespace
 {
+    //rewrites the color bytes of all nodes including those in subgenomes
     void colorizeGenomeNodes(std::vector<uint8_t>& genome, int color)
     {
-        auto desc = GenomeDescriptionConverter::convertBytesToDescription(genome);
-        for (auto& node : desc.cells) {
-            node.color = color;
-            if (node.hasGenome()) {
-                colorizeGenomeNodes(node.getGenomeRef(), color);
+        GenomeScanner::forEachNodeRecursively(genome, [&](GenomeNodeInfo const& node) {
+            if (node.address + Const::CellColorPos < node.genomeEndAddress) {
+                genome[node.address + Const::CellColorPos] = static_cast<uint8_t>(color);
             }
-        }
-        genome = GenomeDescriptionConverter::convertDescriptionToBytes(desc);
+        });
     }
 }
 
 void DescriptionHelper::randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes)
 {
-    for (auto& cluster : data.clusters) {
-        auto newColor = colorCodes[NumberGenerator::getInstance().getRandomInt(toInt(colorCodes.size()))];
+    if (colorCodes.empty()) {
+        return;
+    }
+    executeForEachClusterInParallel(data, [&](ClusterDescription& cluster, std::mt19937& randomEngine) {
+        auto newColor = getRandomElement(colorCodes, randomEngine);
         for (auto& cell : cluster.cells) {
             if (cell.hasGenome()) {
-                colorizeGenomeNodes(cell.getGenomeRef(), newColor);
+                auto& genome = cell.getGenomeRef();
+                colorizeGenomeNodes(genome, newColor);
             }
         }
-    }
+    });
 }
 
 void DescriptionHelper::randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy)
 {
-    for (auto& cluster : data.clusters) {
-        auto energy = NumberGenerator::getInstance().getRandomReal(minEnergy, maxEnergy);
+    executeForEachClusterInParallel(data, [&](ClusterDescription& cluster, std::mt19937& randomEngine) {
+        auto energy = std::uniform_real_distribution<float>(minEnergy, maxEnergy)(randomEngine);
         for (auto& cell : cluster.cells) {
             cell.energy = energy;
         }
-    }
+    });
 }
 
 void DescriptionHelper::randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge)
 {
-    for (auto& cluster : data.clusters) {
-        auto age = NumberGenerator::getInstance().getRandomReal(minAge, maxAge);
+    executeForEachClusterInParallel(data, [&](ClusterDescription& cluster, std::mt19937& randomEngine) {
+        auto age = std::uniform_int_distribution<int>(minAge, maxAge)(randomEngine);
         for (auto& cell : cluster.cells) {
             cell.age = age;
         }
-    }
+    });
 }
 
-void DescriptionHelper::generateExecutionOrderNumbers(DataDescription& data, std::unordered_set<uint64_t> const& cellIds, int maxBranchNumbers)
+namespace
 {
-    std::unordered_map<uint64_t, int> idToIndexMap;
-    for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
-        idToIndexMap.emplace(cell.id, toInt(index));
+    //connections of the cells in compressed sparse row format (cell indices instead of ids)
+    struct CellGraph
+    {
+        std::vector<int> offsets;  //neighbors of cell i are neighbors[offsets[i]] ... neighbors[offsets[i + 1] - 1]
+        std::vector<int> neighbors;
+
+        int getNumCells() const { return toInt(offsets.size()) - 1; }
+    };
+
+    std::vector<std::pair<uint64_t, int>> createSortedCellIndicesById(DataDescription const& data)
+    {
+        std::vector<std::pair<uint64_t, int>> result;
+        result.reserve(data.cells.size());
+        for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
+            result.emplace_back(cell.id, toInt(index));
+        }
+        std::ranges::sort(result);
+        return result;
     }
 
-    std::set<uint64_t> visitedCellIds(cellIds.begin(), cellIds.end());
-    std::vector<std::vector<uint64_t>> cellIdPaths;
-    for (auto const& cellId : cellIds) {
-        cellIdPaths.emplace_back(std::vector<uint64_t>{cellId});
+    std::optional<int> findCellIndex(std::vector<std::pair<uint64_t, int>> const& sortedCellIndicesById, uint64_t id)
+    {
+        auto findResult = std::ranges::lower_bound(sortedCellIndicesById, id, {}, [](auto const& element) { return element.first; });
+        if (findResult == sortedCellIndicesById.end() || findResult->first != id) {
+            return std::nullopt;
+        }
+        return findResult->second;
     }
 
-    int origNumVisitedCells = 0;
-    do {
+    CellGraph createCellGraph(DataDescription const& data, std::vector<std::pair<uint64_t, int>> const& sortedCellIndicesById)
+    {
+        CellGraph result;
+        result.offsets.reserve(data.cells.size() + 1);
+        result.offsets.emplace_back(0);
+        for (auto const& cell : data.cells) {
+            for (auto const& connection : cell.connections) {
+                if (auto neighborIndex = findCellIndex(sortedCellIndicesById, connection.cellId)) {
+                    result.neighbors.emplace_back(*neighborIndex);
+                }
+            }
+            result.offsets.emplace_back(toInt(result.neighbors.size()));
+        }
+        return result;
+    }
 
-        //set branch numbers an last cell on path
-        for (auto const& cellIdPath : cellIdPaths) {
-            if (cellIdPath.empty()) {
-                continue;
+    //returns a representative cell index per cell identifying its connected component
+    std::vector<int> calcComponents(CellGraph const& graph)
+    {
+        std::vector<int> result(graph.getNumCells());
+        std::iota(result.begin(), result.end(), 0);
+        auto findRoot = [&](int index) {
+            while (result[index] != index) {
+                result[index] = result[result[index]];
+                index = result[index];
             }
-            auto const& lastCellId = cellIdPath.back();
-
-            auto& cell = data.cells.at(idToIndexMap.at(lastCellId));
-            cell.setExecutionOrderNumber((cellIdPath.size() - 1) % maxBranchNumbers);
-        }
-
-        //modify paths
-        origNumVisitedCells = visitedCellIds.size();
-        for (auto& cellIdPath : cellIdPaths) {
-            auto found = false;
-            while (!found && !cellIdPath.empty()) {
-                auto const& lastCellId = cellIdPath.back();
-                auto& cell = data.cells.at(idToIndexMap.at(lastCellId));
-                for (auto const& connection : cell.connections) {
-                    auto connectingCellId = connection.cellId;
-                    if (visitedCellIds.find(connectingCellId) == visitedCellIds.end()) {
-                        cellIdPath.emplace_back(connectingCellId);
-                        visitedCellIds.insert(connectingCellId);
-                        found = true;
-                        break;
-                    }
+            return index;
+        };
+        for (int index = 0; index < graph.getNumCells(); ++index) {
+            for (int i = graph.offsets[index]; i < graph.offsets[index + 1]; ++i) {
+                auto root1 = findRoot(index);
+                auto root2 = findRoot(graph.neighbors[i]);
+                if (root1 != root2) {
+                    result[std::max(root1, root2)] = std::min(root1, root2);
                 }
-                if (!found) {
-                    cellIdPath.pop_back();
+            }
+        }
+        for (int index = 0; index < graph.getNumCells(); ++index) {
+            result[index] = findRoot(index);
+        }
+        return result;
+    }
+}
+
+void DescriptionHelper::generateExecutionOrderNumbers(DataDescription& data, std::unordered_set<uint64_t> const& cellIds, int maxBranchNumbers)
+{
+    auto sortedCellIndicesById = createSortedCellIndicesById(data);
+    auto graph = createCellGraph(data, sortedCellIndicesById);
+    auto components = calcComponents(graph);
+
+    //start cells grouped by component
+    std::unordered_map<int, int> componentToGroupIndex;
+    std::vector<std::vector<int>> startCellIndicesByGroup;
+    for (auto const& cellId : cellIds) {
+        auto cellIndex = findCellIndex(sortedCellIndicesById, cellId);
+        if (!cellIndex) {
+            continue;
+        }
+        auto [iter, inserted] = componentToGroupIndex.try_emplace(components[*cellIndex], toInt(startCellIndicesByGroup.size()));
+        if (inserted) {
+            startCellIndicesByGroup.emplace_back();
+        }
+        startCellIndicesByGroup.at(iter->second).emplace_back(*cellIndex);
+    }
+
+    //components are disjoint => each thread accesses different cells
+    std::vector<uint8_t> visited(data.cells.size(), 0);
+    std::vector<int> nextNeighborPos(graph.offsets.begin(), graph.offsets.end() - 1);
+    Parallel::forEachChunk(toInt(startCellIndicesByGroup.size()), [&](int, int startIndex, int endIndex) {
+        for (int groupIndex = startIndex; groupIndex < endIndex; ++groupIndex) {
+            auto const& startCellIndices = startCellIndicesByGroup.at(groupIndex);
+            std::vector<std::vector<int>> cellIndexPaths;
+            for (auto const& cellIndex : startCellIndices) {
+                visited[cellIndex] = 1;
+                data.cells.at(cellIndex).setExecutionOrderNumber(0);
+                cellIndexPaths.emplace_back(std::vector<int>{cellIndex});
+            }
+
+            //extend all paths by one cell per iteration by depth-first search
+            while (!cellIndexPaths.empty()) {
+                for (auto& cellIndexPath : cellIndexPaths) {
+                    while (!cellIndexPath.empty()) {
+                        auto lastCellIndex = cellIndexPath.back();
+                        auto& neighborPos = nextNeighborPos[lastCellIndex];
+                        while (neighborPos < graph.offsets[lastCellIndex + 1] && visited[graph.neighbors[neighborPos]]) {
+                            ++neighborPos;
+                        }
+                        if (neighborPos < graph.offsets[lastCellIndex + 1]) {
+                            auto nextCellIndex = graph.neighbors[neighborPos];
+                            visited[nextCellIndex] = 1;
+                            data.cells.at(nextCellIndex).setExecutionOrderNumber(toInt(cellIndexPath.size()) % maxBranchNumbers);
+                            cellIndexPath.emplace_back(nextCellIndex);
+                            break;
+                        }
+                        cellIndexPath.pop_back();
+                    }
                 }
+                std::erase_if(cellIndexPaths, [](auto const& cellIndexPath) { return cellIndexPath.empty(); });
             }
         }
-    } while (origNumVisitedCells != visitedCellIds.size());
+    });
 }
 
 void DescriptionHelper::removeMetadata(DataDescription& data)
@@ -523,6 +664,16 @@ void DescriptionHelper::removeMetadata(DataDescription& data)
     }
 }
 
+void DescriptionHelper::removeMetadata(SharedDataDescription& data)
+{
+    for (int i = 0; i < data.getNumCells(); ++i) {
+        auto const& metadata = data.getCell(i).metadata;
+        if (!metadata.name.empty() || !metadata.description.empty()) {
+            removeMetadata(data.getCellRef(i));
+        }
+    }
+}
+
 namespace
 {
     int getNewCreatureId(int origCreatureId, std::unordered_map<int, int>& origToNewCreatureIdMap)
@@ -65,7 +65,7 @@ public:
         MEMBER_DECLARATION(GridMultiplyParameters, float, verticalVelYinc, 0);
         MEMBER_DECLARATION(GridMultiplyParameters, float, verticalAngularVelInc, 0);
     };
-    static DataDescription gridMultiply(DataDescription const& input, GridMultiplyParameters const& parameters);
+    static DataDescription gridMultiply(SharedDataDescription const& input, GridMultiplyParameters const& parameters);
 
     struct RandomMultiplyParameters
     {
@@ -81,7 +81,7 @@ public:
         MEMBER_DECLARATION(RandomMultiplyParameters, bool, overlappingCheck, false);
     };
     static DataDescription randomMultiply(
-        DataDescription const& input,
+        SharedDataDescription const& input,
         RandomMultiplyParameters const& parameters,
         IntVector2D const& worldSize,
         DataDescription&& existentData,
@@ -93,7 +93,7 @@ public:
 
     static void reconnectCells(DataDescription& data, float maxDistance);
     static void removeStickiness(DataDescription& data);
-    static void correctConnections(ClusteredDataDescription& data, IntVector2D const& worldSize);
+    static void correctConnections(ClusteredDataDescription& data, IntVector2D const& worldSize, float maxConnectionDistance);
 
     static void randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes);
     static void randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes);
@@ -108,6 +108,7 @@ public:
     static std::vector<CellOrParticleDescription> getConstructorToMainGenomes(DataDescription const& data);
 
     static void removeMetadata(DataDescription& data);
+    static void removeMetadata(SharedDataDescription& data);
     static void generateNewCreatureIds(DataDescription& data);
     static void generateNewCreatureIds(ClusteredDataDescription& data);
 
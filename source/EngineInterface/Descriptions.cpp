@@ -146,6 +146,13 @@ DataDescription& DataDescription::add(DataDescription const& other)
     return *this;
 }
 
+DataDescription& DataDescription::add(DataDescription&& other)
+{
+    cells.insert(cells.end(), std::make_move_iterator(other.cells.begin()), std::make_move_iterator(other.cells.end()));
+    particles.insert(particles.end(), std::make_move_iterator(other.particles.begin()), std::make_move_iterator(other.particles.end()));
+    return *this;
+}
+
 DataDescription& DataDescription::addCells(std::vector<CellDescription> const& value)
 {
     cells.insert(cells.end(), value.begin(), value.end());
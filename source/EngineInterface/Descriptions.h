@@ -162,6 +162,11 @@ struct SensorDescription
         fixedAngle = value;
         return *this;
     }
+    SensorDescription& setMinDensity(float value)
+    {
+        minDensity = value;
+        return *this;
+    }
     SensorDescription& setColor(int value)
     {
         color = value;
@@ -538,6 +543,7 @@ struct DataDescription
     auto operator<=>(DataDescription const&) const = default;
 
     DataDescription& add(DataDescription const& other);
+    DataDescription& add(DataDescription&& other);
     DataDescription& addCells(std::vector<CellDescription> const& value);
     DataDescription& addCell(CellDescription const& value);
 
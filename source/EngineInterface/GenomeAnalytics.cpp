@@ -0,0 +1,241 @@
+#include "GenomeAnalytics.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+#include "Base/Parallel.h"
+#include "Descriptions.h"
+#include "GenomeScanner.h"
+
+namespace
+{
+    auto constexpr ShingleSize = 4;
+    auto constexpr NumSketchBands = 4;
+    auto constexpr NumSketchRowsPerBand = static_cast<int>(std::tuple_size_v<GenomeSketch>) / NumSketchBands;
+    auto constexpr MinCellsPerThread = 4096;
+    auto constexpr MinGenomesPerThread = 64;
+
+    //finalizer of MurmurHash3
+    uint64_t mix(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ull;
+        value ^= value >> 33;
+        return value;
+    }
+
+    std::vector<uint8_t> const* getGenome(CellDescription const& cell)
+    {
+        switch (cell.getCellFunctionType()) {
+        case CellFunction_Constructor:
+            return &std::get<ConstructorDescription>(*cell.cellFunction).genome;
+        case CellFunction_Injector:
+            return &std::get<InjectorDescription>(*cell.cellFunction).genome;
+        default:
+            return nullptr;
+        }
+    }
+
+    class UnionFind
+    {
+    public:
+        UnionFind(int size)
+            : _parents(size)
+        {
+            std::iota(_parents.begin(), _parents.end(), 0);
+        }
+
+        int find(int index)
+        {
+            while (_parents[index] != index) {
+                _parents[index] = _parents[_parents[index]];
+                index = _parents[index];
+            }
+            return index;
+        }
+
+        void unite(int index1, int index2)
+        {
+            auto root1 = find(index1);
+            auto root2 = find(index2);
+            if (root1 != root2) {
+                _parents[std::max(root1, root2)] = std::min(root1, root2);
+            }
+        }
+
+    private:
+        std::vector<int> _parents;
+    };
+}
+
+GenomeAnalyticsData GenomeAnalytics::analyze(DataDescription const& data, float similarityThreshold)
+{
+    GenomeAnalyticsData result;
+
+    std::vector<CellDescription const*> cellsWithGenome;
+    for (auto const& cell : data.cells) {
+        if (getGenome(cell)) {
+            cellsWithGenome.emplace_back(&cell);
+        }
+    }
+    result.numCellsWithGenome = toInt(cellsWithGenome.size());
+
+    std::vector<uint64_t> hashes(cellsWithGenome.size());
+    Parallel::forEachChunk(
+        result.numCellsWithGenome,
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                hashes[index] = calcHash(*getGenome(*cellsWithGenome[index]));
+            }
+        },
+        MinCellsPerThread);
+
+    //group cells by genome, genomes with colliding hashes are distinguished by comparing their bytes
+    std::vector<std::vector<uint8_t> const*> distinctGenomes;
+    std::unordered_map<uint64_t, std::vector<int>> genomeIndicesByHash;
+    for (int index = 0; index < result.numCellsWithGenome; ++index) {
+        auto const& genome = *getGenome(*cellsWithGenome[index]);
+        auto& genomeIndices = genomeIndicesByHash[hashes[index]];
+        auto findResult = std::find_if(genomeIndices.begin(), genomeIndices.end(), [&](int genomeIndex) { return *distinctGenomes[genomeIndex] == genome; });
+        auto genomeIndex = 0;
+        if (findResult != genomeIndices.end()) {
+            genomeIndex = *findResult;
+        } else {
+            genomeIndex = toInt(distinctGenomes.size());
+            genomeIndices.emplace_back(genomeIndex);
+            distinctGenomes.emplace_back(&genome);
+            GenomeStatistics statistics;
+            statistics.hash = hashes[index];
+            result.genomes.emplace_back(statistics);
+        }
+        result.genomes[genomeIndex].cellIds.emplace_back(cellsWithGenome[index]->id);
+    }
+
+    Parallel::forEachChunk(
+        toInt(result.genomes.size()),
+        [&](int, int startIndex, int endIndex) {
+            GenomeNodeIndex nodeIndex;
+            for (int index = startIndex; index < endIndex; ++index) {
+                auto const& genome = *distinctGenomes[index];
+                auto& statistics = result.genomes[index];
+                nodeIndex.build(genome);
+                statistics.numBytes = toInt(genome.size());
+                statistics.numNodes = nodeIndex.getNumNodes();
+                statistics.numNodesRecursively = nodeIndex.getNumNodesRecursively();
+                statistics.depth = nodeIndex.getMaxDepth();
+                statistics.sketch = calcSketch(genome);
+            }
+        },
+        MinGenomesPerThread);
+
+    std::stable_sort(result.genomes.begin(), result.genomes.end(), [](auto const& statistics1, auto const& statistics2) {
+        return statistics1.cellIds.size() > statistics2.cellIds.size();
+    });
+
+    std::vector<GenomeSketch> sketches;
+    sketches.reserve(result.genomes.size());
+    for (auto const& genome : result.genomes) {
+        sketches.emplace_back(genome.sketch);
+    }
+    auto similarityGroups = calcSimilarityGroups(sketches, similarityThreshold);
+    result.numSimilarityGroups = 0;
+    for (int genomeIndex = 0; genomeIndex < toInt(result.genomes.size()); ++genomeIndex) {
+        result.genomes[genomeIndex].similarityGroup = similarityGroups[genomeIndex];
+        result.numSimilarityGroups = std::max(result.numSimilarityGroups, similarityGroups[genomeIndex] + 1);
+    }
+
+    return result;
+}
+
+uint64_t GenomeAnalytics::calcHash(std::vector<uint8_t> const& genome)
+{
+    auto result = mix(genome.size() + 1);
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= genome.size(); pos += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, genome.data() + pos, sizeof(uint64_t));
+        result = mix(result ^ word);
+    }
+    uint64_t remainingBytes = 0;
+    if (pos < genome.size()) {
+        std::memcpy(&remainingBytes, genome.data() + pos, genome.size() - pos);
+    }
+    return mix(result ^ remainingBytes);
+}
+
+GenomeSketch GenomeAnalytics::calcSketch(std::vector<uint8_t> const& genome)
+{
+    GenomeSketch result;
+    result.fill(std::numeric_limits<uint32_t>::max());
+
+    auto numShingles = std::max(1, toInt(genome.size()) - ShingleSize + 1);
+    for (int pos = 0; pos < numShingles; ++pos) {
+        uint32_t shingle = 0;
+        auto shingleSize = std::min(ShingleSize, toInt(genome.size()) - pos);
+        if (shingleSize > 0) {
+            std::memcpy(&shingle, genome.data() + pos, shingleSize);
+        }
+        auto shingleHash = mix(shingle);
+        for (int i = 0; i < toInt(result.size()); ++i) {
+            auto value = static_cast<uint32_t>(mix(shingleHash + i) >> 32);
+            result[i] = std::min(result[i], value);
+        }
+    }
+    return result;
+}
+
+std::vector<int> GenomeAnalytics::calcSimilarityGroups(std::vector<GenomeSketch> const& sketches, float similarityThreshold)
+{
+    auto numSketches = toInt(sketches.size());
+    UnionFind groups(numSketches);
+
+    //locality-sensitive hashing: only sketches with an identical band are compared
+    //a newcomer is compared with all members of its bucket which are not already in its group,
+    //hence the groups are the connected components of the similarity relation and do not depend on the input order
+    for (int band = 0; band < NumSketchBands; ++band) {
+        std::unordered_map<uint64_t, std::vector<int>> sketchIndicesByBandHash;
+        sketchIndicesByBandHash.reserve(numSketches);
+        for (int sketchIndex = 0; sketchIndex < numSketches; ++sketchIndex) {
+            auto const& sketch = sketches[sketchIndex];
+            uint64_t bandHash = band;
+            for (int row = 0; row < NumSketchRowsPerBand; ++row) {
+                bandHash = mix(bandHash ^ sketch[band * NumSketchRowsPerBand + row]);
+            }
+            auto& bucket = sketchIndicesByBandHash[bandHash];
+            for (auto const& otherIndex : bucket) {
+                if (groups.find(sketchIndex) != groups.find(otherIndex) && estimateSimilarity(sketch, sketches[otherIndex]) >= similarityThreshold) {
+                    groups.unite(sketchIndex, otherIndex);
+                }
+            }
+            bucket.emplace_back(sketchIndex);
+        }
+    }
+
+    std::vector<int> result(numSketches);
+    std::vector<int> groupByRoot(numSketches, -1);
+    auto numGroups = 0;
+    for (int sketchIndex = 0; sketchIndex < numSketches; ++sketchIndex) {
+        auto& group = groupByRoot[groups.find(sketchIndex)];
+        if (group == -1) {
+            group = numGroups++;
+        }
+        result[sketchIndex] = group;
+    }
+    return result;
+}
+
+float GenomeAnalytics::estimateSimilarity(GenomeSketch const& sketch1, GenomeSketch const& sketch2)
+{
+    auto matches = 0;
+    for (int i = 0; i < toInt(sketch1.size()); ++i) {
+        if (sketch1[i] == sketch2[i]) {
+            ++matches;
+        }
+    }
+    return toFloat(matches) / toFloat(sketch1.size());
+}
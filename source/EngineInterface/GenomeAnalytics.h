@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Definitions.h"
+
+using GenomeSketch = std::array<uint32_t, 16>;
+
+struct GenomeStatistics
+{
+    uint64_t hash = 0;
+    GenomeSketch sketch = {};
+    int numBytes = 0;
+    int numNodes = 0;
+    int numNodesRecursively = 0;
+    int depth = 0;                  //0 if the genome contains no subgenome nodes
+    int similarityGroup = 0;        //near-identical genomes share the same group
+    std::vector<uint64_t> cellIds;  //cells carrying this genome
+};
+
+struct GenomeAnalyticsData
+{
+    std::vector<GenomeStatistics> genomes;  //sorted by number of cells in descending order
+    int numCellsWithGenome = 0;
+    int numSimilarityGroups = 0;
+};
+
+class GenomeAnalytics
+{
+public:
+    //minimum estimated similarity for genomes in the same similarity group
+    static auto constexpr DefaultSimilarityThreshold = 0.8f;
+
+    static GenomeAnalyticsData analyze(DataDescription const& data, float similarityThreshold = DefaultSimilarityThreshold);
+
+    static uint64_t calcHash(std::vector<uint8_t> const& genome);
+
+    //min-hash sketch over byte shingles of the genome, allows to estimate the similarity of two genomes
+    static GenomeSketch calcSketch(std::vector<uint8_t> const& genome);
+    static float estimateSimilarity(GenomeSketch const& sketch1, GenomeSketch const& sketch2);
+
+    //groups of sketches connected by estimated similarities of at least similarityThreshold, numbered in order of their first sketch
+    static std::vector<int> calcSimilarityGroups(std::vector<GenomeSketch> const& sketches, float similarityThreshold);
+};
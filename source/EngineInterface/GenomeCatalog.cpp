@@ -0,0 +1,281 @@
+#include "GenomeCatalog.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+
+#include "Base/Definitions.h"
+#include "GenomeAnalytics.h"
+#include "GenomeDecoderBase.h"
+#include "Serializer.h"
+
+namespace
+{
+    auto constexpr Magic = "ALIENGC";  //8 bytes including the terminating zero
+    auto constexpr MagicSize = 8;
+    auto constexpr Version = 1;
+    auto constexpr HeaderSize = MagicSize + 4 + 4 + 8;
+
+    //all values are stored in little-endian byte order
+    template <typename T>
+    void writeValue(std::ostream& stream, T value)
+    {
+        char bytes[sizeof(T)];
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            bytes[i] = static_cast<char>((static_cast<uint64_t>(value) >> (8 * i)) & 0xff);
+        }
+        stream.write(bytes, sizeof(T));
+    }
+
+    template <typename T>
+    bool readValue(std::istream& stream, T& value)
+    {
+        unsigned char bytes[sizeof(T)];
+        if (!stream.read(reinterpret_cast<char*>(bytes), sizeof(T))) {
+            return false;
+        }
+        uint64_t result = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            result |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        }
+        value = static_cast<T>(result);
+        return true;
+    }
+
+    void writeHeader(std::ostream& stream, uint32_t numEntries, uint64_t indexOffset)
+    {
+        stream.write(Magic, MagicSize);
+        writeValue<uint32_t>(stream, Version);
+        writeValue<uint32_t>(stream, numEntries);
+        writeValue<uint64_t>(stream, indexOffset);
+    }
+
+    void writeEntry(std::ostream& stream, GenomeCatalogEntry const& entry)
+    {
+        writeValue<uint64_t>(stream, entry.hash);
+        writeValue<uint64_t>(stream, entry.offset);
+        writeValue<uint32_t>(stream, entry.numBytes);
+        writeValue<uint32_t>(stream, entry.numNodes);
+        writeValue<uint32_t>(stream, entry.numNodesRecursively);
+        writeValue<uint32_t>(stream, entry.depth);
+        writeValue<uint32_t>(stream, entry.colors);
+        auto nameLength = static_cast<uint16_t>(std::min(entry.name.size(), size_t(0xffff)));
+        writeValue<uint16_t>(stream, nameLength);
+        stream.write(entry.name.data(), nameLength);
+    }
+
+    bool readEntry(std::istream& stream, GenomeCatalogEntry& entry)
+    {
+        uint32_t numBytes, numNodes, numNodesRecursively, depth;
+        uint16_t nameLength;
+        if (!readValue(stream, entry.hash) || !readValue(stream, entry.offset) || !readValue(stream, numBytes) || !readValue(stream, numNodes)
+            || !readValue(stream, numNodesRecursively) || !readValue(stream, depth) || !readValue(stream, entry.colors) || !readValue(stream, nameLength)) {
+            return false;
+        }
+        entry.numBytes = toInt(numBytes);
+        if (entry.numBytes < 0) {
+            return false;
+        }
+        entry.numNodes = toInt(numNodes);
+        entry.numNodesRecursively = toInt(numNodesRecursively);
+        entry.depth = toInt(depth);
+        entry.name.resize(nameLength);
+        return static_cast<bool>(stream.read(entry.name.data(), nameLength));
+    }
+}
+
+bool GenomeCatalog::serializeCatalogToFile(std::string const& filename, std::vector<NamedGenome> const& genomes)
+{
+    try {
+        std::ofstream stream(filename, std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        writeHeader(stream, 0, 0);
+
+        std::vector<GenomeCatalogEntry> entries;
+        entries.reserve(genomes.size());
+        std::unordered_map<uint64_t, std::vector<int>> entryIndicesByHash;
+        uint64_t offset = HeaderSize;
+        for (auto const& [name, genome] : genomes) {
+            auto entry = createEntry(name, genome);
+            auto& candidates = entryIndicesByHash[entry.hash];
+            auto findResult = std::find_if(candidates.begin(), candidates.end(), [&](int index) {
+                return genomes.at(index).genome == genome;
+            });
+            if (findResult != candidates.end()) {
+                entry.offset = entries.at(*findResult).offset;
+            } else {
+                entry.offset = offset;
+                stream.write(reinterpret_cast<char const*>(genome.data()), genome.size());
+                offset += genome.size();
+            }
+            candidates.emplace_back(toInt(entries.size()));
+            entries.emplace_back(entry);
+        }
+
+        for (auto const& entry : entries) {
+            writeEntry(stream, entry);
+        }
+        stream.seekp(0);
+        writeHeader(stream, static_cast<uint32_t>(entries.size()), offset);
+        return static_cast<bool>(stream);
+    } catch (...) {
+        return false;
+    }
+}
+
+bool GenomeCatalog::convertGenomeFilesToCatalog(std::string const& catalogFilename, std::vector<std::string> const& genomeFilenames)
+{
+    std::vector<NamedGenome> genomes;
+    genomes.reserve(genomeFilenames.size());
+    for (auto const& genomeFilename : genomeFilenames) {
+        NamedGenome namedGenome{.name = std::filesystem::path(genomeFilename).stem().string()};
+        if (!Serializer::deserializeGenomeFromFile(namedGenome.genome, genomeFilename)) {
+            return false;
+        }
+        genomes.emplace_back(std::move(namedGenome));
+    }
+    return serializeCatalogToFile(catalogFilename, genomes);
+}
+
+bool GenomeCatalog::convertGenomeDirectoryToCatalog(std::string const& catalogFilename, std::string const& directory)
+{
+    std::vector<std::string> genomeFilenames;
+    try {
+        for (auto const& directoryEntry : std::filesystem::directory_iterator(directory)) {
+            if (directoryEntry.is_regular_file() && directoryEntry.path().extension() == ".genome") {
+                genomeFilenames.emplace_back(directoryEntry.path().string());
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    std::sort(genomeFilenames.begin(), genomeFilenames.end());
+    return convertGenomeFilesToCatalog(catalogFilename, genomeFilenames);
+}
+
+bool GenomeCatalog::appendGenomeToCatalog(std::string const& filename, NamedGenome const& genome)
+{
+    std::vector<GenomeCatalogEntry> entries;
+    if (!deserializeIndexFromFile(entries, filename)) {
+        return false;
+    }
+    try {
+        std::fstream stream(filename, std::ios::binary | std::ios::in | std::ios::out);
+        if (!stream) {
+            return false;
+        }
+        char magic[MagicSize];
+        uint32_t version, numEntries;
+        uint64_t indexOffset;
+        if (!stream.read(magic, MagicSize) || !readValue(stream, version) || !readValue(stream, numEntries) || !readValue(stream, indexOffset)) {
+            return false;
+        }
+
+        auto entry = createEntry(genome.name, genome.genome);
+        entry.offset = indexOffset;
+        for (auto const& otherEntry : entries) {
+            std::vector<uint8_t> otherGenome;
+            if (otherEntry.hash == entry.hash && deserializeGenomeFromFile(otherGenome, filename, otherEntry) && otherGenome == genome.genome) {
+                entry.offset = otherEntry.offset;
+                break;
+            }
+        }
+        if (entry.offset == indexOffset) {
+            stream.seekp(indexOffset);
+            stream.write(reinterpret_cast<char const*>(genome.genome.data()), genome.genome.size());
+            indexOffset += genome.genome.size();
+        }
+        entries.emplace_back(entry);
+
+        stream.seekp(indexOffset);
+        for (auto const& indexEntry : entries) {
+            writeEntry(stream, indexEntry);
+        }
+        stream.seekp(0);
+        writeHeader(stream, static_cast<uint32_t>(entries.size()), indexOffset);
+        return static_cast<bool>(stream);
+    } catch (...) {
+        return false;
+    }
+}
+
+bool GenomeCatalog::deserializeIndexFromFile(std::vector<GenomeCatalogEntry>& entries, std::string const& filename)
+{
+    try {
+        std::ifstream stream(filename, std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        char magic[MagicSize];
+        uint32_t version, numEntries;
+        uint64_t indexOffset;
+        if (!stream.read(magic, MagicSize) || std::memcmp(magic, Magic, MagicSize) != 0) {
+            return false;
+        }
+        if (!readValue(stream, version) || version != Version || !readValue(stream, numEntries) || !readValue(stream, indexOffset)) {
+            return false;
+        }
+
+        if (!stream.seekg(indexOffset)) {
+            return false;
+        }
+        std::vector<GenomeCatalogEntry> result;
+        result.reserve(std::min(numEntries, 1u << 20));
+        for (uint32_t i = 0; i < numEntries; ++i) {
+            GenomeCatalogEntry entry;
+            if (!readEntry(stream, entry) || entry.offset < HeaderSize || entry.offset + entry.numBytes > indexOffset) {
+                return false;
+            }
+            result.emplace_back(std::move(entry));
+        }
+        entries = std::move(result);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool GenomeCatalog::deserializeGenomeFromFile(std::vector<uint8_t>& genome, std::string const& filename, GenomeCatalogEntry const& entry)
+{
+    try {
+        if (entry.numBytes < 0) {
+            return false;
+        }
+        std::ifstream stream(filename, std::ios::binary);
+        if (!stream || !stream.seekg(entry.offset)) {
+            return false;
+        }
+        std::vector<uint8_t> result(entry.numBytes);
+        if (!stream.read(reinterpret_cast<char*>(result.data()), entry.numBytes)) {
+            return false;
+        }
+        if (GenomeAnalytics::calcHash(result) != entry.hash) {
+            return false;
+        }
+        genome = std::move(result);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+GenomeCatalogEntry GenomeCatalog::createEntry(std::string const& name, std::vector<uint8_t> const& genome)
+{
+    GenomeCatalogEntry result;
+    result.name = name;
+    result.hash = GenomeAnalytics::calcHash(genome);
+    result.numBytes = toInt(genome.size());
+
+    auto genomeSize = toInt(genome.size());
+    result.numNodes = GenomeDecoderBase::getNumNodes(genome.data(), genomeSize);
+    result.depth = GenomeDecoderBase::getGenomeDepth(genome.data(), genomeSize);
+    GenomeDecoderBase::executeForEachNodeRecursively(genome.data(), genomeSize, [&](int depth, int nodeAddress) {
+        ++result.numNodesRecursively;
+        result.colors |= 1u << GenomeDecoderBase::getNextCellColor(genome.data(), nodeAddress);
+    });
+    return result;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct NamedGenome
+{
+    std::string name;
+    std::vector<uint8_t> genome;
+};
+
+struct GenomeCatalogEntry
+{
+    std::string name;
+    uint64_t hash = 0;
+    uint64_t offset = 0;     //position of the genome bytes in the catalog file
+    int numBytes = 0;
+    int numNodes = 0;
+    int numNodesRecursively = 0;
+    int depth = 0;
+    uint32_t colors = 0;     //bit i is set if a node of color i occurs in the genome or its subgenomes
+
+    bool hasColor(int color) const { return (colors & (1u << color)) != 0; }
+};
+
+//single file containing many genomes together with an index for random access:
+//header | genome bytes | index with name, hash, offset and metadata of each entry
+//identical genomes are stored only once
+class GenomeCatalog
+{
+public:
+    static bool serializeCatalogToFile(std::string const& filename, std::vector<NamedGenome> const& genomes);
+
+    //entries are named after the stems of the genome files
+    static bool convertGenomeFilesToCatalog(std::string const& catalogFilename, std::vector<std::string> const& genomeFilenames);
+
+    //converts all .genome files of the directory (non-recursively) in lexicographic order of their filenames
+    static bool convertGenomeDirectoryToCatalog(std::string const& catalogFilename, std::string const& directory);
+
+    //writes the genome over the old index and appends the extended index, the genome bytes are reused if an identical genome is already stored
+    static bool appendGenomeToCatalog(std::string const& filename, NamedGenome const& genome);
+
+    static bool deserializeIndexFromFile(std::vector<GenomeCatalogEntry>& entries, std::string const& filename);
+
+    //fails if the bytes read do not match the hash of the entry
+    static bool deserializeGenomeFromFile(std::vector<uint8_t>& genome, std::string const& filename, GenomeCatalogEntry const& entry);
+
+    static GenomeCatalogEntry createEntry(std::string const& name, std::vector<uint8_t> const& genome);
+};
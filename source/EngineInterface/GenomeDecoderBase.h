@@ -0,0 +1,490 @@
+#pragma once
+
+#include <cstdint>
+
+#include "CellFunctionConstants.h"
+#include "FundamentalConstants.h"
+#include "GenomeConstants.h"
+
+#if defined(__CUDACC__)
+#define GENOME_DECODER_FUNCTION __inline__ __host__ __device__
+//templates are also instantiated with device-only callables and random generators
+#define GENOME_DECODER_TEMPLATE _Pragma("nv_exec_check_disable")
+#else
+#define GENOME_DECODER_FUNCTION inline
+#define GENOME_DECODER_TEMPLATE
+#endif
+
+//byte-level genome decoding shared by host and device code (GenomeDecoder in EngineGpuKernels extends it by functions on simulation objects)
+//bytes beyond genomeSize are read as 0 by all functions receiving the genome size
+class GenomeDecoderBase
+{
+public:
+    //calls func(nodeAddress) for each node without descending into subgenomes
+    template <typename Func>
+    GENOME_DECODER_FUNCTION static void executeForEachNode(uint8_t const* genome, int genomeSize, Func func);
+
+    //calls func(depth, nodeAddress) for each node including the nodes of subgenomes in depth-first order
+    template <typename Func>
+    GENOME_DECODER_FUNCTION static void executeForEachNodeRecursively(uint8_t const* genome, int genomeSize, Func func);
+
+    GENOME_DECODER_FUNCTION static int getGenomeDepth(uint8_t const* genome, int genomeSize);
+    GENOME_DECODER_FUNCTION static int getNumNodesRecursively(uint8_t const* genome, int genomeSize);
+
+    //RandomGenerator needs to provide int random(int maxValue) (inclusive) and bool randomBool()
+    template <typename RandomGenerator>
+    GENOME_DECODER_FUNCTION static int getRandomGenomeNodeAddress(
+        RandomGenerator& randomGenerator,
+        uint8_t const* genome,
+        int genomeSize,
+        bool considerZeroSubGenomes,
+        int* subGenomesSizeIndices = nullptr,
+        int* numSubGenomesSizeIndices = nullptr,
+        int randomRefIndex = 0);
+
+    //RandomGenerator needs to provide void randomBytes(uint8_t* data, int size)
+    template <typename RandomGenerator>
+    GENOME_DECODER_FUNCTION static void setRandomCellFunctionData(
+        RandomGenerator& randomGenerator,
+        uint8_t* genome,
+        int nodeAddress,
+        CellFunction const& cellFunction,
+        bool makeSelfCopy,
+        int subGenomeSize);
+
+    GENOME_DECODER_FUNCTION static int getNumNodes(uint8_t const* genome, int genomeSize);
+    GENOME_DECODER_FUNCTION static int getNodeAddress(uint8_t const* genome, int genomeSize, int nodeIndex);
+    GENOME_DECODER_FUNCTION static int findStartNodeAddress(uint8_t const* genome, int genomeSize, int refIndex);
+    GENOME_DECODER_FUNCTION static int getNextCellFunctionDataSize(uint8_t const* genome, int genomeSize, int nodeAddress, bool withSubgenomes = true);
+    GENOME_DECODER_FUNCTION static int getNextCellFunctionType(uint8_t const* genome, int nodeAddress);
+    GENOME_DECODER_FUNCTION static bool isNextCellSelfCopy(uint8_t const* genome, int nodeAddress);
+    GENOME_DECODER_FUNCTION static int getNextCellColor(uint8_t const* genome, int nodeAddress);
+    GENOME_DECODER_FUNCTION static void setNextCellFunctionType(uint8_t* genome, int nodeAddress, CellFunction cellFunction);
+    GENOME_DECODER_FUNCTION static void setNextCellColor(uint8_t* genome, int nodeAddress, int color);
+    GENOME_DECODER_FUNCTION static void setNextAngle(uint8_t* genome, int nodeAddress, uint8_t angle);
+    GENOME_DECODER_FUNCTION static void setNextRequiredConnections(uint8_t* genome, int nodeAddress, uint8_t angle);
+    GENOME_DECODER_FUNCTION static void setNextConstructionAngle1(uint8_t* genome, int nodeAddress, uint8_t angle);
+    GENOME_DECODER_FUNCTION static void setNextConstructionAngle2(uint8_t* genome, int nodeAddress, uint8_t angle);
+    GENOME_DECODER_FUNCTION static void setNextConstructorSeparation(uint8_t* genome, int nodeAddress, bool separation);
+
+    GENOME_DECODER_FUNCTION static int
+    getNextSubGenomeSize(uint8_t const* genome, int genomeSize, int nodeAddress);  //prerequisites: (constructor or injector) and !makeSelfCopy
+    GENOME_DECODER_FUNCTION static int getCellFunctionDataSize(
+        CellFunction cellFunction,
+        bool makeSelfCopy,
+        int genomeSize);  //genomeSize only relevant for cellFunction = constructor or injector
+    GENOME_DECODER_FUNCTION static bool hasSelfCopy(uint8_t const* genome, int genomeSize);
+
+    GENOME_DECODER_FUNCTION static uint8_t readByte(uint8_t const* genome, int genomeSize, int address);
+    GENOME_DECODER_FUNCTION static int readWord(uint8_t const* genome, int address);
+    GENOME_DECODER_FUNCTION static void writeWord(uint8_t* genome, int address, int word);
+
+    GENOME_DECODER_FUNCTION static bool convertByteToBool(uint8_t b);
+    GENOME_DECODER_FUNCTION static uint8_t convertBoolToByte(bool value);
+    GENOME_DECODER_FUNCTION static int convertBytesToWord(uint8_t b1, uint8_t b2);
+    GENOME_DECODER_FUNCTION static void convertWordToBytes(int word, uint8_t& b1, uint8_t& b2);
+    GENOME_DECODER_FUNCTION static uint8_t convertAngleToByte(float angle);
+    GENOME_DECODER_FUNCTION static uint8_t convertOptionalByteToByte(int value);
+
+    static auto constexpr MAX_SUBGENOME_RECURSION_DEPTH = 30;
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+GENOME_DECODER_TEMPLATE
+template <typename Func>
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::executeForEachNode(uint8_t const* genome, int genomeSize, Func func)
+{
+    for (int currentNodeAddress = Const::GenomeHeaderSize; currentNodeAddress < genomeSize;) {
+        func(currentNodeAddress);
+
+        currentNodeAddress += Const::CellBasicBytes + getNextCellFunctionDataSize(genome, genomeSize, currentNodeAddress);
+    }
+}
+
+GENOME_DECODER_TEMPLATE
+template <typename Func>
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::executeForEachNodeRecursively(uint8_t const* genome, int genomeSize, Func func)
+{
+    int subGenomeEndAddresses[MAX_SUBGENOME_RECURSION_DEPTH];
+    int depth = 0;
+    for (auto nodeAddress = Const::GenomeHeaderSize; nodeAddress < genomeSize;) {
+        auto cellFunction = getNextCellFunctionType(genome, nodeAddress);
+        func(depth, nodeAddress);
+
+        //sizes are limited by the enclosing subgenome
+        auto currentGenomeSize = depth > 0 ? subGenomeEndAddresses[depth - 1] : genomeSize;
+
+        bool goToNextSibling = true;
+        if (cellFunction == CellFunction_Constructor || cellFunction == CellFunction_Injector) {
+            auto cellFunctionFixedBytes = cellFunction == CellFunction_Constructor ? Const::ConstructorFixedBytes : Const::InjectorFixedBytes;
+            auto makeSelfCopy = convertByteToBool(readByte(genome, currentGenomeSize, nodeAddress + Const::CellBasicBytes + cellFunctionFixedBytes));
+            auto subGenomeSize = makeSelfCopy ? 0 : getNextSubGenomeSize(genome, currentGenomeSize, nodeAddress);
+
+            //subgenomes without complete header contain no nodes
+            if (subGenomeSize >= Const::GenomeHeaderSize && depth < MAX_SUBGENOME_RECURSION_DEPTH) {
+                nodeAddress += Const::CellBasicBytes + cellFunctionFixedBytes + 3;
+                subGenomeEndAddresses[depth++] = nodeAddress + subGenomeSize;
+                nodeAddress += Const::GenomeHeaderSize;
+                goToNextSibling = false;
+            }
+        }
+        if (goToNextSibling) {
+            nodeAddress += Const::CellBasicBytes + getNextCellFunctionDataSize(genome, currentGenomeSize, nodeAddress);
+        }
+
+        //a node exceeding its subgenome is truncated at the end of the subgenome
+        for (int i = 0; i < MAX_SUBGENOME_RECURSION_DEPTH && depth > 0; ++i) {
+            if (subGenomeEndAddresses[depth - 1] <= nodeAddress) {
+                nodeAddress = subGenomeEndAddresses[depth - 1];
+                --depth;
+            } else {
+                break;
+            }
+        }
+    }
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getGenomeDepth(uint8_t const* genome, int genomeSize)
+{
+    auto result = 0;
+    executeForEachNodeRecursively(genome, genomeSize, [&result](int depth, int nodeAddress) { result = result > depth ? result : depth; });
+    return result;
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getNumNodesRecursively(uint8_t const* genome, int genomeSize)
+{
+    auto result = 0;
+    executeForEachNodeRecursively(genome, genomeSize, [&result](int depth, int nodeAddress) { ++result; });
+    return result;
+}
+
+GENOME_DECODER_TEMPLATE
+template <typename RandomGenerator>
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getRandomGenomeNodeAddress(
+    RandomGenerator& randomGenerator,
+    uint8_t const* genome,
+    int genomeSize,
+    bool considerZeroSubGenomes,
+    int* subGenomesSizeIndices,
+    int* numSubGenomesSizeIndices,
+    int randomRefIndex)
+{
+    if (numSubGenomesSizeIndices) {
+        *numSubGenomesSizeIndices = 0;
+    }
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return Const::GenomeHeaderSize;
+    }
+    if (randomRefIndex == 0) {
+        randomRefIndex = randomGenerator.random(genomeSize - 1);
+    }
+
+    int result = 0;
+    for (int depth = 0; depth < MAX_SUBGENOME_RECURSION_DEPTH; ++depth) {
+        auto nodeAddress = findStartNodeAddress(genome, genomeSize, randomRefIndex);
+        result += nodeAddress;
+        auto cellFunction = getNextCellFunctionType(genome, nodeAddress);
+
+        if (cellFunction == CellFunction_Constructor || cellFunction == CellFunction_Injector) {
+            auto cellFunctionFixedBytes = cellFunction == CellFunction_Constructor ? Const::ConstructorFixedBytes : Const::InjectorFixedBytes;
+            auto makeSelfCopy = convertByteToBool(readByte(genome, genomeSize, nodeAddress + Const::CellBasicBytes + cellFunctionFixedBytes));
+            if (makeSelfCopy) {
+                break;
+            } else {
+                if (nodeAddress + Const::CellBasicBytes + cellFunctionFixedBytes > randomRefIndex) {
+                    break;
+                }
+                if (numSubGenomesSizeIndices) {
+                    subGenomesSizeIndices[*numSubGenomesSizeIndices] = result + Const::CellBasicBytes + cellFunctionFixedBytes + 1;
+                    ++(*numSubGenomesSizeIndices);
+                }
+                auto subGenomeStartIndex = nodeAddress + Const::CellBasicBytes + cellFunctionFixedBytes + 3;
+                auto subGenomeSize = getNextSubGenomeSize(genome, genomeSize, nodeAddress);
+                if (subGenomeSize <= Const::GenomeHeaderSize) {
+                    if (subGenomeSize == Const::GenomeHeaderSize && considerZeroSubGenomes && randomGenerator.randomBool()) {
+                        result += Const::CellBasicBytes + cellFunctionFixedBytes + 3 + Const::GenomeHeaderSize;
+                    } else {
+                        if (numSubGenomesSizeIndices) {
+                            --(*numSubGenomesSizeIndices);
+                        }
+                    }
+                    break;
+                }
+                genomeSize = subGenomeSize;
+                genome = genome + subGenomeStartIndex;
+                randomRefIndex -= subGenomeStartIndex;
+                result += Const::CellBasicBytes + cellFunctionFixedBytes + 3;
+            }
+        } else {
+            break;
+        }
+    }
+    return result;
+}
+
+GENOME_DECODER_TEMPLATE
+template <typename RandomGenerator>
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::setRandomCellFunctionData(
+    RandomGenerator& randomGenerator,
+    uint8_t* genome,
+    int nodeAddress,
+    CellFunction const& cellFunction,
+    bool makeSelfCopy,
+    int subGenomeSize)
+{
+    auto newCellFunctionSize = getCellFunctionDataSize(cellFunction, makeSelfCopy, subGenomeSize);
+    randomGenerator.randomBytes(genome + nodeAddress, newCellFunctionSize);
+    if (cellFunction == CellFunction_Constructor || cellFunction == CellFunction_Injector) {
+        auto cellFunctionFixedBytes = cellFunction == CellFunction_Constructor ? Const::ConstructorFixedBytes : Const::InjectorFixedBytes;
+        genome[nodeAddress + cellFunctionFixedBytes] = makeSelfCopy ? 1 : 0;
+        if (!makeSelfCopy) {
+            writeWord(genome, nodeAddress + cellFunctionFixedBytes + 1, subGenomeSize);
+        }
+    }
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getNumNodes(uint8_t const* genome, int genomeSize)
+{
+    int result = 0;
+    int currentNodeAddress = Const::GenomeHeaderSize;
+    for (; result < genomeSize && currentNodeAddress < genomeSize; ++result) {
+        currentNodeAddress += Const::CellBasicBytes + getNextCellFunctionDataSize(genome, genomeSize, currentNodeAddress);
+    }
+
+    return result;
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getNodeAddress(uint8_t const* genome, int genomeSize, int nodeIndex)
+{
+    int currentNodeAddress = Const::GenomeHeaderSize;
+    for (int currentNodeIndex = 0; currentNodeIndex < nodeIndex; ++currentNodeIndex) {
+        if (currentNodeAddress >= genomeSize) {
+            break;
+        }
+        currentNodeAddress += Const::CellBasicBytes + getNextCellFunctionDataSize(genome, genomeSize, currentNodeAddress);
+    }
+
+    return currentNodeAddress;
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::findStartNodeAddress(uint8_t const* genome, int genomeSize, int refIndex)
+{
+    int currentNodeAddress = Const::GenomeHeaderSize;
+    for (; currentNodeAddress <= refIndex;) {
+        auto prevCurrentNodeAddress = currentNodeAddress;
+        currentNodeAddress += Const::CellBasicBytes + getNextCellFunctionDataSize(genome, genomeSize, currentNodeAddress);
+        if (currentNodeAddress > refIndex) {
+            return prevCurrentNodeAddress;
+        }
+    }
+    return Const::GenomeHeaderSize;
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getNextCellFunctionDataSize(uint8_t const* genome, int genomeSize, int nodeAddress, bool withSubgenomes)
+{
+    auto cellFunction = getNextCellFunctionType(genome, nodeAddress);
+    switch (cellFunction) {
+    case CellFunction_Neuron:
+        return Const::NeuronBytes;
+    case CellFunction_Transmitter:
+        return Const::TransmitterBytes;
+    case CellFunction_Constructor: {
+        if (withSubgenomes) {
+            auto isMakeCopy = convertByteToBool(readByte(genome, genomeSize, nodeAddress + Const::CellBasicBytes + Const::ConstructorFixedBytes));
+            if (isMakeCopy) {
+                return Const::ConstructorFixedBytes + 1;
+            } else {
+                return Const::ConstructorFixedBytes + 3 + getNextSubGenomeSize(genome, genomeSize, nodeAddress);
+            }
+        } else {
+            return Const::ConstructorFixedBytes;
+        }
+    }
+    case CellFunction_Sensor:
+        return Const::SensorBytes;
+    case CellFunction_Nerve:
+        return Const::NerveBytes;
+    case CellFunction_Attacker:
+        return Const::AttackerBytes;
+    case CellFunction_Injector: {
+        if (withSubgenomes) {
+            auto isMakeCopy = convertByteToBool(readByte(genome, genomeSize, nodeAddress + Const::CellBasicBytes + Const::InjectorFixedBytes));
+            if (isMakeCopy) {
+                return Const::InjectorFixedBytes + 1;
+            } else {
+                return Const::InjectorFixedBytes + 3 + getNextSubGenomeSize(genome, genomeSize, nodeAddress);
+            }
+        } else {
+            return Const::InjectorFixedBytes;
+        }
+    }
+    case CellFunction_Muscle:
+        return Const::MuscleBytes;
+    case CellFunction_Defender:
+        return Const::DefenderBytes;
+    default:
+        return 0;
+    }
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getNextCellFunctionType(uint8_t const* genome, int nodeAddress)
+{
+    return genome[nodeAddress] % CellFunction_Count;
+}
+
+GENOME_DECODER_FUNCTION bool GenomeDecoderBase::isNextCellSelfCopy(uint8_t const* genome, int nodeAddress)
+{
+    switch (getNextCellFunctionType(genome, nodeAddress)) {
+    case CellFunction_Constructor:
+        return convertByteToBool(genome[nodeAddress + Const::CellBasicBytes + Const::ConstructorFixedBytes]);
+    case CellFunction_Injector:
+        return convertByteToBool(genome[nodeAddress + Const::CellBasicBytes + Const::InjectorFixedBytes]);
+    }
+    return false;
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getNextCellColor(uint8_t const* genome, int nodeAddress)
+{
+    return genome[nodeAddress + Const::CellColorPos] % MAX_COLORS;
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::setNextCellFunctionType(uint8_t* genome, int nodeAddress, CellFunction cellFunction)
+{
+    genome[nodeAddress] = static_cast<uint8_t>(cellFunction);
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::setNextCellColor(uint8_t* genome, int nodeAddress, int color)
+{
+    genome[nodeAddress + Const::CellColorPos] = static_cast<uint8_t>(color);
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::setNextAngle(uint8_t* genome, int nodeAddress, uint8_t angle)
+{
+    genome[nodeAddress + Const::CellAnglePos] = angle;
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::setNextRequiredConnections(uint8_t* genome, int nodeAddress, uint8_t angle)
+{
+    genome[nodeAddress + Const::CellRequiredConnectionsPos] = angle;
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::setNextConstructionAngle1(uint8_t* genome, int nodeAddress, uint8_t angle)
+{
+    genome[nodeAddress + Const::CellBasicBytes + Const::ConstructorConstructionAngle1Pos] = angle;
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::setNextConstructionAngle2(uint8_t* genome, int nodeAddress, uint8_t angle)
+{
+    genome[nodeAddress + Const::CellBasicBytes + Const::ConstructorConstructionAngle2Pos] = angle;
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::setNextConstructorSeparation(uint8_t* genome, int nodeAddress, bool separation)
+{
+    genome[nodeAddress + Const::CellBasicBytes + Const::ConstructorFixedBytes + 3 + Const::ConstructorSeparation] = convertBoolToByte(separation);
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getNextSubGenomeSize(uint8_t const* genome, int genomeSize, int nodeAddress)
+{
+    auto cellFunction = getNextCellFunctionType(genome, nodeAddress);
+    auto cellFunctionFixedBytes = cellFunction == CellFunction_Constructor ? Const::ConstructorFixedBytes : Const::InjectorFixedBytes;
+    auto subGenomeSizeIndex = nodeAddress + Const::CellBasicBytes + cellFunctionFixedBytes + 1;
+    auto result = convertBytesToWord(readByte(genome, genomeSize, subGenomeSizeIndex), readByte(genome, genomeSize, subGenomeSizeIndex + 1));
+    auto maxResult = genomeSize - (subGenomeSizeIndex + 2);
+    result = result < maxResult ? result : maxResult;
+    return result > 0 ? result : 0;
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::getCellFunctionDataSize(CellFunction cellFunction, bool makeSelfCopy, int genomeSize)
+{
+    switch (cellFunction) {
+    case CellFunction_Neuron:
+        return Const::NeuronBytes;
+    case CellFunction_Transmitter:
+        return Const::TransmitterBytes;
+    case CellFunction_Constructor: {
+        return makeSelfCopy ? Const::ConstructorFixedBytes + 1 : Const::ConstructorFixedBytes + 3 + genomeSize;
+    }
+    case CellFunction_Sensor:
+        return Const::SensorBytes;
+    case CellFunction_Nerve:
+        return Const::NerveBytes;
+    case CellFunction_Attacker:
+        return Const::AttackerBytes;
+    case CellFunction_Injector: {
+        return makeSelfCopy ? Const::InjectorFixedBytes + 1 : Const::InjectorFixedBytes + 3 + genomeSize;
+    }
+    case CellFunction_Muscle:
+        return Const::MuscleBytes;
+    case CellFunction_Defender:
+        return Const::DefenderBytes;
+    default:
+        return 0;
+    }
+}
+
+GENOME_DECODER_FUNCTION bool GenomeDecoderBase::hasSelfCopy(uint8_t const* genome, int genomeSize)
+{
+    int nodeAddress = 0;
+    for (; nodeAddress < genomeSize;) {
+        if (isNextCellSelfCopy(genome, nodeAddress)) {
+            return true;
+        }
+        nodeAddress += Const::CellBasicBytes + getNextCellFunctionDataSize(genome, genomeSize, nodeAddress);
+    }
+
+    return false;
+}
+
+GENOME_DECODER_FUNCTION uint8_t GenomeDecoderBase::readByte(uint8_t const* genome, int genomeSize, int address)
+{
+    return address < genomeSize ? genome[address] : 0;
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::readWord(uint8_t const* genome, int address)
+{
+    return convertBytesToWord(genome[address], genome[address + 1]);
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::writeWord(uint8_t* genome, int address, int word)
+{
+    convertWordToBytes(word, genome[address], genome[address + 1]);
+}
+
+GENOME_DECODER_FUNCTION bool GenomeDecoderBase::convertByteToBool(uint8_t b)
+{
+    return static_cast<int8_t>(b) > 0;
+}
+
+GENOME_DECODER_FUNCTION uint8_t GenomeDecoderBase::convertBoolToByte(bool value)
+{
+    return value ? 1 : 0;
+}
+
+GENOME_DECODER_FUNCTION int GenomeDecoderBase::convertBytesToWord(uint8_t b1, uint8_t b2)
+{
+    return static_cast<int>(b1) | (static_cast<int>(b2 << 8));
+}
+
+GENOME_DECODER_FUNCTION void GenomeDecoderBase::convertWordToBytes(int word, uint8_t& b1, uint8_t& b2)
+{
+    b1 = static_cast<uint8_t>(word & 0xff);
+    b2 = static_cast<uint8_t>((word >> 8) & 0xff);
+}
+
+GENOME_DECODER_FUNCTION uint8_t GenomeDecoderBase::convertAngleToByte(float angle)
+{
+    if (angle > 180.0f) {
+        angle -= 360.0f;
+    }
+    if (angle < -180.0f) {
+        angle += 360.0f;
+    }
+    return static_cast<uint8_t>(static_cast<int8_t>(angle / 180 * 120));
+}
+
+GENOME_DECODER_FUNCTION uint8_t GenomeDecoderBase::convertOptionalByteToByte(int value)
+{
+    return static_cast<uint8_t>(value);
+}
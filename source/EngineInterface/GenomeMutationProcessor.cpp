@@ -0,0 +1,766 @@
+#include "GenomeMutationProcessor.h"
+
+#include <cstdlib>
+
+#include "Base/Definitions.h"
+#include "Base/SplitMix64.h"
+#include "GenomeDecoderBase.h"
+#include "ShapeGenerator.h"
+
+namespace
+{
+    bool isRandomEvent(GenomeMutationRandomGenerator& randomGenerator, float probability)
+    {
+        if (probability > 0.001f) {
+            return randomGenerator.random() < probability;
+        } else {
+            return randomGenerator.random() < probability * 1000 && randomGenerator.random() < 0.001f;
+        }
+    }
+
+    bool containsSelfReplication(std::vector<uint8_t> const& genome)
+    {
+        auto genomeSize = toInt(genome.size());
+        for (int nodeAddress = Const::GenomeHeaderSize; nodeAddress < genomeSize;) {
+            if (GenomeDecoderBase::isNextCellSelfCopy(genome.data(), nodeAddress)) {
+                return true;
+            }
+            nodeAddress += Const::CellBasicBytes + GenomeDecoderBase::getNextCellFunctionDataSize(genome.data(), genomeSize, nodeAddress);
+        }
+        return false;
+    }
+
+    void adaptMutationId(GenomeMutationRandomGenerator& randomGenerator, MutatedGenome& target)
+    {
+        if (containsSelfReplication(target.genome)) {
+            target.offspringMutationId = std::abs(randomGenerator.createNewSmallId());
+        }
+    }
+
+    int getNewColorFromTransition(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, int origColor)
+    {
+        int numAllowedColors = 0;
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            if (parameters.cellFunctionConstructorMutationColorTransitions[origColor][i]) {
+                ++numAllowedColors;
+            }
+        }
+        if (numAllowedColors == 0) {
+            return -1;
+        }
+        int randomAllowedColorIndex = randomGenerator.random(numAllowedColors - 1);
+        int allowedColorIndex = 0;
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            if (parameters.cellFunctionConstructorMutationColorTransitions[origColor][i]) {
+                if (allowedColorIndex == randomAllowedColorIndex) {
+                    return i;
+                }
+                ++allowedColorIndex;
+            }
+        }
+        return 0;
+    }
+
+    //returns the offset and size of the innermost subgenome containing the size field at the end of the given list
+    void getInnermostSubGenome(
+        std::vector<uint8_t> const& genome,
+        int const* subGenomesSizeIndices,
+        int numSubGenomesSizeIndices,
+        int& subGenomeOffset,
+        int& subGenomeSize)
+    {
+        if (numSubGenomesSizeIndices > 0) {
+            auto sizeIndex = subGenomesSizeIndices[numSubGenomesSizeIndices - 1];
+            subGenomeOffset = sizeIndex + 2;  //after the 2 size bytes the subgenome starts
+            subGenomeSize = GenomeDecoderBase::readWord(genome.data(), sizeIndex);
+        } else {
+            subGenomeOffset = 0;
+            subGenomeSize = toInt(genome.size());
+        }
+    }
+}
+
+GenomeMutationRandomGenerator::GenomeMutationRandomGenerator(uint64_t seed)
+    : _state(seed)
+{}
+
+int GenomeMutationRandomGenerator::random(int maxValue)
+{
+    if (maxValue <= 0) {
+        return 0;
+    }
+    return static_cast<int>(next() % (static_cast<uint64_t>(maxValue) + 1));
+}
+
+float GenomeMutationRandomGenerator::random()
+{
+    return static_cast<float>(next() >> 40) / static_cast<float>(1 << 24);
+}
+
+bool GenomeMutationRandomGenerator::randomBool()
+{
+    return random(1) == 0;
+}
+
+uint8_t GenomeMutationRandomGenerator::randomByte()
+{
+    return static_cast<uint8_t>(random(255));
+}
+
+void GenomeMutationRandomGenerator::randomBytes(uint8_t* data, int size)
+{
+    for (int i = 0; i < size; ++i) {
+        data[i] = randomByte();
+    }
+}
+
+int GenomeMutationRandomGenerator::createNewSmallId()
+{
+    return _currentSmallId++;
+}
+
+uint64_t GenomeMutationRandomGenerator::next()
+{
+    return SplitMix64::next(_state);
+}
+
+void GenomeMutationProcessor::applyRandomMutation(
+    GenomeMutationRandomGenerator& randomGenerator,
+    SimulationParameters const& parameters,
+    MutatedGenome& target)
+{
+    auto const& values = parameters.baseValues;
+    auto color = target.color;
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationNeuronDataProbability[color])) {
+        neuronDataMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationPropertiesProbability[color])) {
+        propertiesMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationGeometryProbability[color])) {
+        geometryMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationCustomGeometryProbability[color])) {
+        customGeometryMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationCellFunctionProbability[color])) {
+        cellFunctionMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationInsertionProbability[color])) {
+        insertMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationDeletionProbability[color])) {
+        deleteMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationTranslationProbability[color])) {
+        translateMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationDuplicationProbability[color])) {
+        duplicateMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationColorProbability[color])) {
+        colorMutation(randomGenerator, parameters, target);
+    }
+    if (isRandomEvent(randomGenerator, values.cellFunctionConstructorMutationUniformColorProbability[color])) {
+        uniformColorMutation(randomGenerator, parameters, target);
+    }
+}
+
+void GenomeMutationProcessor::applyMutation(
+    MutationType type,
+    GenomeMutationRandomGenerator& randomGenerator,
+    SimulationParameters const& parameters,
+    MutatedGenome& target)
+{
+    switch (type) {
+    case MutationType::Properties:
+        propertiesMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::NeuronData:
+        neuronDataMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::Geometry:
+        geometryMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::CustomGeometry:
+        customGeometryMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::CellFunction:
+        cellFunctionMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::Insertion:
+        insertMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::Deletion:
+        deleteMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::Translation:
+        translateMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::Duplication:
+        duplicateMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::Color:
+        colorMutation(randomGenerator, parameters, target);
+        break;
+    case MutationType::UniformColor:
+        uniformColorMutation(randomGenerator, parameters, target);
+        break;
+    }
+}
+
+void GenomeMutationProcessor::neuronDataMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+    auto nodeAddress = GenomeDecoderBase::getRandomGenomeNodeAddress(randomGenerator, genome, genomeSize, false);
+
+    auto type = GenomeDecoderBase::getNextCellFunctionType(genome, nodeAddress);
+    if (type == CellFunction_Neuron) {
+        auto delta = randomGenerator.random(Const::NeuronBytes - 1);
+        genome[nodeAddress + Const::CellBasicBytes + delta] = randomGenerator.randomByte();
+    }
+}
+
+void GenomeMutationProcessor::propertiesMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+
+    auto numNodes = GenomeDecoderBase::getNumNodesRecursively(genome, genomeSize);
+    auto node = randomGenerator.random(numNodes - 1);
+    auto sequenceNumber = 0;
+    GenomeDecoderBase::executeForEachNodeRecursively(genome, genomeSize, [&](int depth, int nodeAddress) {
+        if (sequenceNumber++ != node) {
+            return;
+        }
+
+        //basic property mutation
+        if (randomGenerator.randomBool()) {
+            auto randomDelta = randomGenerator.random(Const::CellBasicBytes - 1);
+            if (randomDelta == 0) {  //no cell function type change
+                return;
+            }
+            if (randomDelta == Const::CellColorPos) {  //no color change
+                return;
+            }
+            if (randomDelta == Const::CellAnglePos || randomDelta == Const::CellRequiredConnectionsPos) {  //no structure change
+                return;
+            }
+            genome[nodeAddress + randomDelta] = randomGenerator.randomByte();
+        }
+
+        //cell function specific mutation
+        else {
+            auto nextCellFunctionDataSize = GenomeDecoderBase::getNextCellFunctionDataSize(genome, genomeSize, nodeAddress, false);
+            if (nextCellFunctionDataSize > 0) {
+                auto randomDelta = randomGenerator.random(nextCellFunctionDataSize - 1);
+                auto cellFunction = GenomeDecoderBase::getNextCellFunctionType(genome, nodeAddress);
+                if (cellFunction == CellFunction_Constructor
+                    && (randomDelta == Const::ConstructorConstructionAngle1Pos
+                        || randomDelta == Const::ConstructorConstructionAngle2Pos)) {  //no construction angles change
+                    return;
+                }
+                genome[nodeAddress + Const::CellBasicBytes + randomDelta] = randomGenerator.randomByte();
+            }
+        }
+    });
+}
+
+void GenomeMutationProcessor::geometryMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize < Const::GenomeHeaderSize) {
+        return;
+    }
+
+    auto subgenomeOffset = 0;
+    auto subgenomeSize = genomeSize;
+    if (genomeSize > Const::GenomeHeaderSize) {
+        int subGenomesSizeIndices[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH];
+        int numSubGenomesSizeIndices;
+        GenomeDecoderBase::getRandomGenomeNodeAddress(
+            randomGenerator, genome, genomeSize, false, subGenomesSizeIndices, &numSubGenomesSizeIndices);  //return value will be discarded
+        getInnermostSubGenome(target.genome, subGenomesSizeIndices, numSubGenomesSizeIndices, subgenomeOffset, subgenomeSize);
+    }
+    auto subgenome = genome + subgenomeOffset;
+
+    auto delta = randomGenerator.random(Const::GenomeHeaderSize - 1);
+    auto mutatedByte = randomGenerator.randomByte();
+    if (delta == Const::GenomeHeaderSeparationPos && GenomeDecoderBase::convertByteToBool(mutatedByte)) {
+        return;
+    }
+    if (delta == Const::GenomeHeaderShapePos) {
+        auto shape = mutatedByte % ConstructionShape_Count;
+        auto origShape = subgenome[delta] % ConstructionShape_Count;
+        if (origShape != ConstructionShape_Custom && shape == ConstructionShape_Custom) {
+            subgenome[Const::GenomeHeaderAlignmentPos] = ConstructorAngleAlignment_60;  //alignment used for custom shapes on the GPU
+
+            //the node data of the custom shape continues the former predefined shape
+            auto nodeIndex = 0;
+            GenomeDecoderBase::executeForEachNode(subgenome, subgenomeSize, [&](int nodeAddress) {
+                auto generationResult = ShapeTables::getConstructionData(origShape, nodeIndex++);
+                subgenome[nodeAddress + Const::CellAnglePos] = GenomeDecoderBase::convertAngleToByte(generationResult.angle);
+                subgenome[nodeAddress + Const::CellRequiredConnectionsPos] =
+                    GenomeDecoderBase::convertOptionalByteToByte(generationResult.numRequiredAdditionalConnections.value_or(-1));
+            });
+        }
+    }
+    if (subgenome[delta] != mutatedByte) {
+        adaptMutationId(randomGenerator, target);
+    }
+    subgenome[delta] = mutatedByte;
+}
+
+void GenomeMutationProcessor::customGeometryMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+
+    auto numNodes = GenomeDecoderBase::getNumNodesRecursively(genome, genomeSize);
+    auto node = randomGenerator.random(numNodes - 1);
+    auto sequenceNumber = 0;
+    GenomeDecoderBase::executeForEachNodeRecursively(genome, genomeSize, [&](int depth, int nodeAddress) {
+        if (sequenceNumber++ != node) {
+            return;
+        }
+        auto cellFunction = GenomeDecoderBase::getNextCellFunctionType(genome, nodeAddress);
+        auto choice = cellFunction == CellFunction_Constructor ? randomGenerator.random(3) : randomGenerator.random(1);
+        switch (choice) {
+        case 0:
+            GenomeDecoderBase::setNextAngle(genome, nodeAddress, randomGenerator.randomByte());
+            break;
+        case 1:
+            GenomeDecoderBase::setNextRequiredConnections(genome, nodeAddress, randomGenerator.randomByte());
+            break;
+        case 2:
+            GenomeDecoderBase::setNextConstructionAngle1(genome, nodeAddress, randomGenerator.randomByte());
+            break;
+        case 3:
+            GenomeDecoderBase::setNextConstructionAngle2(genome, nodeAddress, randomGenerator.randomByte());
+            break;
+        }
+        adaptMutationId(randomGenerator, target);
+    });
+}
+
+void GenomeMutationProcessor::cellFunctionMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+    int subGenomesSizeIndices[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH];
+    int numSubGenomesSizeIndices;
+    auto nodeAddress =
+        GenomeDecoderBase::getRandomGenomeNodeAddress(randomGenerator, genome, genomeSize, false, subGenomesSizeIndices, &numSubGenomesSizeIndices);
+
+    auto newCellFunction = randomGenerator.random(CellFunction_Count - 1);
+    auto makeSelfCopy = parameters.cellFunctionConstructorMutationSelfReplication ? randomGenerator.randomBool() : false;
+    if (newCellFunction == CellFunction_Injector) {  //not injection mutation allowed at the moment
+        return;
+    }
+    if ((newCellFunction == CellFunction_Constructor || newCellFunction == CellFunction_Injector) && !makeSelfCopy) {
+        if (parameters.cellFunctionConstructorMutationPreventDepthIncrease
+            && GenomeDecoderBase::getGenomeDepth(genome, genomeSize) <= numSubGenomesSizeIndices) {
+            return;
+        }
+    }
+
+    auto origCellFunction = GenomeDecoderBase::getNextCellFunctionType(genome, nodeAddress);
+    if (origCellFunction == CellFunction_Constructor || origCellFunction == CellFunction_Injector) {
+        if (GenomeDecoderBase::getNextSubGenomeSize(genome, genomeSize, nodeAddress) > Const::GenomeHeaderSize) {
+            return;
+        }
+    }
+    auto newCellFunctionSize = GenomeDecoderBase::getCellFunctionDataSize(newCellFunction, makeSelfCopy, Const::GenomeHeaderSize);
+    auto origCellFunctionSize = GenomeDecoderBase::getNextCellFunctionDataSize(genome, genomeSize, nodeAddress);
+    auto sizeDelta = newCellFunctionSize - origCellFunctionSize;
+
+    if (!parameters.cellFunctionConstructorMutationSelfReplication) {
+        if (GenomeDecoderBase::hasSelfCopy(genome + nodeAddress, Const::CellBasicBytes + origCellFunctionSize)) {
+            return;
+        }
+    }
+
+    auto targetGenomeSize = genomeSize + sizeDelta;
+    if (targetGenomeSize > MAX_GENOME_BYTES) {
+        return;
+    }
+    std::vector<uint8_t> targetGenome(targetGenomeSize);
+    std::copy(genome, genome + nodeAddress + Const::CellBasicBytes, targetGenome.data());
+    GenomeDecoderBase::setNextCellFunctionType(targetGenome.data(), nodeAddress, newCellFunction);
+    GenomeDecoderBase::setRandomCellFunctionData(
+        randomGenerator, targetGenome.data(), nodeAddress + Const::CellBasicBytes, newCellFunction, makeSelfCopy, Const::GenomeHeaderSize);
+    if (newCellFunction == CellFunction_Constructor && !makeSelfCopy) {
+        GenomeDecoderBase::setNextConstructorSeparation(targetGenome.data(), nodeAddress, false);  //currently no subgenome with separation property wished
+    }
+    std::copy(genome + nodeAddress + Const::CellBasicBytes + origCellFunctionSize, genome + genomeSize, targetGenome.data() + nodeAddress + Const::CellBasicBytes + newCellFunctionSize);
+
+    for (int i = 0; i < numSubGenomesSizeIndices; ++i) {
+        auto subGenomeSize = GenomeDecoderBase::readWord(genome, subGenomesSizeIndices[i]);
+        GenomeDecoderBase::writeWord(targetGenome.data(), subGenomesSizeIndices[i], subGenomeSize + sizeDelta);
+    }
+    if (target.genomeReadPosition > nodeAddress) {
+        target.genomeReadPosition += sizeDelta;
+    }
+    target.genome = std::move(targetGenome);
+    adaptMutationId(randomGenerator, target);
+}
+
+void GenomeMutationProcessor::insertMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize < Const::GenomeHeaderSize) {
+        return;
+    }
+
+    int subGenomesSizeIndices[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH + 1];
+    int numSubGenomesSizeIndices;
+
+    int nodeAddress = 0;
+    if (randomGenerator.randomBool() && randomGenerator.randomBool() && genomeSize > Const::GenomeHeaderSize) {
+
+        //choose a random node position to a constructor with a subgenome
+        int numConstructorsWithSubgenome = 0;
+        GenomeDecoderBase::executeForEachNodeRecursively(genome, genomeSize, [&](int depth, int nodeAddressIntern) {
+            auto cellFunctionType = GenomeDecoderBase::getNextCellFunctionType(genome, nodeAddressIntern);
+            if (cellFunctionType == CellFunction_Constructor && !GenomeDecoderBase::isNextCellSelfCopy(genome, nodeAddressIntern)) {
+                ++numConstructorsWithSubgenome;
+            }
+        });
+        if (numConstructorsWithSubgenome > 0) {
+            auto randomIndex = randomGenerator.random(numConstructorsWithSubgenome - 1);
+            int counter = 0;
+            GenomeDecoderBase::executeForEachNodeRecursively(genome, genomeSize, [&](int depth, int nodeAddressIntern) {
+                auto cellFunctionType = GenomeDecoderBase::getNextCellFunctionType(genome, nodeAddressIntern);
+                if (cellFunctionType == CellFunction_Constructor && !GenomeDecoderBase::isNextCellSelfCopy(genome, nodeAddressIntern)) {
+                    if (randomIndex == counter) {
+                        nodeAddress = nodeAddressIntern + Const::CellBasicBytes + Const::ConstructorFixedBytes + 3 + 1;
+                    }
+                    ++counter;
+                }
+            });
+        }
+    }
+    nodeAddress = GenomeDecoderBase::getRandomGenomeNodeAddress(
+        randomGenerator, genome, genomeSize, true, subGenomesSizeIndices, &numSubGenomesSizeIndices, nodeAddress);
+
+    auto newColor = target.color;
+    if (nodeAddress < genomeSize) {
+        newColor = GenomeDecoderBase::getNextCellColor(genome, nodeAddress);
+    }
+    auto newCellFunction = randomGenerator.random(CellFunction_Count - 1);
+    auto makeSelfCopy = parameters.cellFunctionConstructorMutationSelfReplication ? randomGenerator.randomBool() : false;
+    if (newCellFunction == CellFunction_Injector) {  //not injection mutation allowed at the moment
+        return;
+    }
+    if ((newCellFunction == CellFunction_Constructor || newCellFunction == CellFunction_Injector) && !makeSelfCopy) {
+        if (parameters.cellFunctionConstructorMutationPreventDepthIncrease
+            && GenomeDecoderBase::getGenomeDepth(genome, genomeSize) <= numSubGenomesSizeIndices) {
+            return;
+        }
+    }
+
+    auto newCellFunctionSize = GenomeDecoderBase::getCellFunctionDataSize(newCellFunction, makeSelfCopy, Const::GenomeHeaderSize);
+    auto sizeDelta = newCellFunctionSize + Const::CellBasicBytes;
+
+    auto targetGenomeSize = genomeSize + sizeDelta;
+    if (targetGenomeSize > MAX_GENOME_BYTES) {
+        return;
+    }
+    std::vector<uint8_t> targetGenome(targetGenomeSize);
+    std::copy(genome, genome + nodeAddress, targetGenome.data());
+    randomGenerator.randomBytes(targetGenome.data() + nodeAddress, Const::CellBasicBytes);
+    GenomeDecoderBase::setNextCellFunctionType(targetGenome.data(), nodeAddress, newCellFunction);
+    GenomeDecoderBase::setNextCellColor(targetGenome.data(), nodeAddress, newColor);
+    GenomeDecoderBase::setRandomCellFunctionData(
+        randomGenerator, targetGenome.data(), nodeAddress + Const::CellBasicBytes, newCellFunction, makeSelfCopy, Const::GenomeHeaderSize);
+    if (newCellFunction == CellFunction_Constructor && !makeSelfCopy) {
+        GenomeDecoderBase::setNextConstructorSeparation(targetGenome.data(), nodeAddress, false);  //currently no subgenome with separation property wished
+    }
+    std::copy(genome + nodeAddress, genome + genomeSize, targetGenome.data() + nodeAddress + sizeDelta);
+
+    for (int i = 0; i < numSubGenomesSizeIndices; ++i) {
+        auto subGenomeSize = GenomeDecoderBase::readWord(genome, subGenomesSizeIndices[i]);
+        GenomeDecoderBase::writeWord(targetGenome.data(), subGenomesSizeIndices[i], subGenomeSize + sizeDelta);
+    }
+    if (target.genomeReadPosition > nodeAddress || target.genomeReadPosition == genomeSize) {
+        target.genomeReadPosition += sizeDelta;
+    }
+    target.genome = std::move(targetGenome);
+    adaptMutationId(randomGenerator, target);
+}
+
+void GenomeMutationProcessor::deleteMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+
+    int subGenomesSizeIndices[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH];
+    int numSubGenomesSizeIndices;
+    auto nodeAddress =
+        GenomeDecoderBase::getRandomGenomeNodeAddress(randomGenerator, genome, genomeSize, false, subGenomesSizeIndices, &numSubGenomesSizeIndices);
+
+    auto origCellFunctionSize = GenomeDecoderBase::getNextCellFunctionDataSize(genome, genomeSize, nodeAddress);
+    auto deleteSize = Const::CellBasicBytes + origCellFunctionSize;
+
+    if (!parameters.cellFunctionConstructorMutationSelfReplication) {
+        if (GenomeDecoderBase::hasSelfCopy(genome + nodeAddress, deleteSize)) {
+            return;
+        }
+    }
+
+    auto targetGenomeSize = genomeSize - deleteSize;
+    std::copy(genome + nodeAddress + deleteSize, genome + genomeSize, genome + nodeAddress);
+
+    for (int i = 0; i < numSubGenomesSizeIndices; ++i) {
+        auto subGenomeSize = GenomeDecoderBase::readWord(genome, subGenomesSizeIndices[i]);
+        GenomeDecoderBase::writeWord(genome, subGenomesSizeIndices[i], subGenomeSize - deleteSize);
+    }
+    if (target.genomeReadPosition > nodeAddress || target.genomeReadPosition == genomeSize) {
+        target.genomeReadPosition -= deleteSize;
+    }
+    target.genome.resize(targetGenomeSize);
+    adaptMutationId(randomGenerator, target);
+}
+
+void GenomeMutationProcessor::translateMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+
+    //calc source range
+    int subGenomesSizeIndices1[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH + 1];
+    int numSubGenomesSizeIndices1;
+    auto startSourceIndex =
+        GenomeDecoderBase::getRandomGenomeNodeAddress(randomGenerator, genome, genomeSize, false, subGenomesSizeIndices1, &numSubGenomesSizeIndices1);
+
+    int subGenomeOffset;
+    int subGenomeSize;
+    getInnermostSubGenome(target.genome, subGenomesSizeIndices1, numSubGenomesSizeIndices1, subGenomeOffset, subGenomeSize);
+    auto subGenome = genome + subGenomeOffset;
+    auto numCells = GenomeDecoderBase::getNumNodes(subGenome, subGenomeSize);
+    auto endRelativeCellIndex = randomGenerator.random(numCells - 1) + 1;
+    auto endRelativeNodeAddress = GenomeDecoderBase::getNodeAddress(subGenome, subGenomeSize, endRelativeCellIndex);
+    auto endSourceIndex = endRelativeNodeAddress + subGenomeOffset;
+    if (endSourceIndex <= startSourceIndex) {
+        return;
+    }
+    auto sourceRangeSize = endSourceIndex - startSourceIndex;
+
+    //calc target insertion point
+    int subGenomesSizeIndices2[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH + 1];
+    int numSubGenomesSizeIndices2;
+    auto startTargetIndex =
+        GenomeDecoderBase::getRandomGenomeNodeAddress(randomGenerator, genome, genomeSize, true, subGenomesSizeIndices2, &numSubGenomesSizeIndices2);
+
+    if (startTargetIndex >= startSourceIndex && startTargetIndex <= endSourceIndex) {
+        return;
+    }
+    if (parameters.cellFunctionConstructorMutationPreventDepthIncrease) {
+        auto genomeDepth = GenomeDecoderBase::getGenomeDepth(genome, genomeSize);
+        auto sourceRangeDepth = GenomeDecoderBase::getGenomeDepth(subGenome, subGenomeSize);
+        if (genomeDepth < sourceRangeDepth + numSubGenomesSizeIndices2) {
+            return;
+        }
+    }
+
+    std::vector<uint8_t> targetGenome(genomeSize);
+    if (startTargetIndex > endSourceIndex) {
+
+        //copy genome
+        auto targetPos = std::copy(genome, genome + startSourceIndex, targetGenome.data());
+        targetPos = std::copy(genome + endSourceIndex, genome + startTargetIndex, targetPos);
+        targetPos = std::copy(genome + startSourceIndex, genome + endSourceIndex, targetPos);
+        std::copy(genome + startTargetIndex, genome + genomeSize, targetPos);
+
+        if (target.genomeReadPosition >= startSourceIndex && target.genomeReadPosition <= startTargetIndex) {
+            target.genomeReadPosition = 0;
+        }
+
+        //adjust sub genome size fields
+        for (int i = 0; i < numSubGenomesSizeIndices1; ++i) {
+            auto size = GenomeDecoderBase::readWord(targetGenome.data(), subGenomesSizeIndices1[i]);
+            GenomeDecoderBase::writeWord(targetGenome.data(), subGenomesSizeIndices1[i], size - sourceRangeSize);
+        }
+        for (int i = 0; i < numSubGenomesSizeIndices2; ++i) {
+            auto address = subGenomesSizeIndices2[i];
+            if (address >= startSourceIndex) {
+                address -= sourceRangeSize;
+            }
+            auto size = GenomeDecoderBase::readWord(targetGenome.data(), address);
+            GenomeDecoderBase::writeWord(targetGenome.data(), address, size + sourceRangeSize);
+        }
+
+    } else {
+
+        //copy genome
+        auto targetPos = std::copy(genome, genome + startTargetIndex, targetGenome.data());
+        targetPos = std::copy(genome + startSourceIndex, genome + endSourceIndex, targetPos);
+        targetPos = std::copy(genome + startTargetIndex, genome + startSourceIndex, targetPos);
+        std::copy(genome + endSourceIndex, genome + genomeSize, targetPos);
+
+        if (target.genomeReadPosition >= startTargetIndex && target.genomeReadPosition <= endSourceIndex) {
+            target.genomeReadPosition = 0;
+        }
+
+        //adjust sub genome size fields
+        for (int i = 0; i < numSubGenomesSizeIndices1; ++i) {
+            auto address = subGenomesSizeIndices1[i];
+            if (address >= startTargetIndex) {
+                address += sourceRangeSize;
+            }
+            auto size = GenomeDecoderBase::readWord(targetGenome.data(), address);
+            GenomeDecoderBase::writeWord(targetGenome.data(), address, size - sourceRangeSize);
+        }
+        for (int i = 0; i < numSubGenomesSizeIndices2; ++i) {
+            auto size = GenomeDecoderBase::readWord(targetGenome.data(), subGenomesSizeIndices2[i]);
+            GenomeDecoderBase::writeWord(targetGenome.data(), subGenomesSizeIndices2[i], size + sourceRangeSize);
+        }
+    }
+
+    target.genome = std::move(targetGenome);
+    adaptMutationId(randomGenerator, target);
+}
+
+void GenomeMutationProcessor::duplicateMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+
+    int startSourceIndex;
+    int endSourceIndex;
+    int subGenomeOffset;
+    int subGenomeSize;
+    {
+        int subGenomesSizeIndices[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH + 1];
+        int numSubGenomesSizeIndices;
+        startSourceIndex =
+            GenomeDecoderBase::getRandomGenomeNodeAddress(randomGenerator, genome, genomeSize, false, subGenomesSizeIndices, &numSubGenomesSizeIndices);
+
+        getInnermostSubGenome(target.genome, subGenomesSizeIndices, numSubGenomesSizeIndices, subGenomeOffset, subGenomeSize);
+        auto numCells = GenomeDecoderBase::getNumNodes(genome + subGenomeOffset, subGenomeSize);
+        auto endRelativeCellIndex = randomGenerator.random(numCells - 1) + 1;
+        auto endRelativeNodeAddress = GenomeDecoderBase::getNodeAddress(genome + subGenomeOffset, subGenomeSize, endRelativeCellIndex);
+        endSourceIndex = endRelativeNodeAddress + subGenomeOffset;
+        if (endSourceIndex <= startSourceIndex) {
+            return;
+        }
+    }
+    auto sizeDelta = endSourceIndex - startSourceIndex;
+    if (!parameters.cellFunctionConstructorMutationSelfReplication) {
+        if (GenomeDecoderBase::hasSelfCopy(genome + startSourceIndex, sizeDelta)) {
+            return;
+        }
+    }
+
+    int subGenomesSizeIndices[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH + 1];
+    int numSubGenomesSizeIndices;
+    auto startTargetIndex =
+        GenomeDecoderBase::getRandomGenomeNodeAddress(randomGenerator, genome, genomeSize, true, subGenomesSizeIndices, &numSubGenomesSizeIndices);
+
+    auto targetGenomeSize = genomeSize + sizeDelta;
+    if (targetGenomeSize > MAX_GENOME_BYTES) {
+        return;
+    }
+
+    if (parameters.cellFunctionConstructorMutationPreventDepthIncrease) {
+        auto genomeDepth = GenomeDecoderBase::getGenomeDepth(genome, genomeSize);
+        auto sourceRangeDepth = GenomeDecoderBase::getGenomeDepth(genome + subGenomeOffset, subGenomeSize);
+        if (genomeDepth < sourceRangeDepth + numSubGenomesSizeIndices) {
+            return;
+        }
+    }
+
+    std::vector<uint8_t> targetGenome(targetGenomeSize);
+    auto targetPos = std::copy(genome, genome + startTargetIndex, targetGenome.data());
+    targetPos = std::copy(genome + startSourceIndex, genome + endSourceIndex, targetPos);
+    std::copy(genome + startTargetIndex, genome + genomeSize, targetPos);
+
+    for (int i = 0; i < numSubGenomesSizeIndices; ++i) {
+        auto size = GenomeDecoderBase::readWord(targetGenome.data(), subGenomesSizeIndices[i]);
+        GenomeDecoderBase::writeWord(targetGenome.data(), subGenomesSizeIndices[i], size + sizeDelta);
+    }
+    if (target.genomeReadPosition > startTargetIndex || target.genomeReadPosition == genomeSize) {
+        target.genomeReadPosition += sizeDelta;
+    }
+    target.genome = std::move(targetGenome);
+    adaptMutationId(randomGenerator, target);
+}
+
+void GenomeMutationProcessor::colorMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+
+    int subGenomesSizeIndices[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH];
+    int numSubGenomesSizeIndices;
+    GenomeDecoderBase::getRandomGenomeNodeAddress(
+        randomGenerator, genome, genomeSize, false, subGenomesSizeIndices, &numSubGenomesSizeIndices);  //return value will be discarded
+
+    int subgenomeOffset;
+    int subgenomeSize;
+    getInnermostSubGenome(target.genome, subGenomesSizeIndices, numSubGenomesSizeIndices, subgenomeOffset, subgenomeSize);
+    auto subgenome = genome + subgenomeOffset;
+
+    int nodeAddress = Const::GenomeHeaderSize;
+    auto origColor = GenomeDecoderBase::getNextCellColor(subgenome, nodeAddress);
+    auto newColor = getNewColorFromTransition(randomGenerator, parameters, origColor);
+    if (newColor == -1) {
+        return;
+    }
+    if (origColor != newColor) {
+        adaptMutationId(randomGenerator, target);
+    }
+
+    for (int dummy = 0; nodeAddress < subgenomeSize && dummy < subgenomeSize; ++dummy) {
+        GenomeDecoderBase::setNextCellColor(subgenome, nodeAddress, newColor);
+        nodeAddress += Const::CellBasicBytes + GenomeDecoderBase::getNextCellFunctionDataSize(subgenome, subgenomeSize, nodeAddress);
+    }
+}
+
+void GenomeMutationProcessor::uniformColorMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target)
+{
+    auto genome = target.genome.data();
+    auto genomeSize = toInt(target.genome.size());
+    if (genomeSize <= Const::GenomeHeaderSize) {
+        return;
+    }
+
+    auto origColor = GenomeDecoderBase::getNextCellColor(genome, Const::GenomeHeaderSize);
+    auto newColor = getNewColorFromTransition(randomGenerator, parameters, origColor);
+    if (newColor == -1) {
+        return;
+    }
+    if (origColor != newColor) {
+        adaptMutationId(randomGenerator, target);
+    }
+
+    GenomeDecoderBase::executeForEachNodeRecursively(
+        genome, genomeSize, [&](int depth, int nodeAddress) { GenomeDecoderBase::setNextCellColor(genome, nodeAddress, newColor); });
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "MutationType.h"
+#include "SimulationParameters.h"
+
+//seedable counterpart of CudaNumberGenerator for host-side mutations
+class GenomeMutationRandomGenerator
+{
+public:
+    GenomeMutationRandomGenerator(uint64_t seed);
+
+    int random(int maxValue);  //uniform in [0, maxValue]
+    float random();            //uniform in [0, 1)
+    bool randomBool();
+    uint8_t randomByte();
+    void randomBytes(uint8_t* data, int size);
+    int createNewSmallId();
+
+private:
+    uint64_t next();
+
+    uint64_t _state;
+    int _currentSmallId = 0;
+};
+
+//genome of a constructor together with the process data that mutations update
+struct MutatedGenome
+{
+    std::vector<uint8_t> genome;
+    int genomeReadPosition = 0;
+    int offspringMutationId = 0;
+    int color = 0;  //color of the cell carrying the genome, used for insertions into empty genomes
+};
+
+//host implementation of the mutations in EngineGpuKernels/MutationProcessor.cuh
+class GenomeMutationProcessor
+{
+public:
+    //uses the base values of the parameters since spots are not available on the host
+    static void applyRandomMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void applyMutation(
+        MutationType type,
+        GenomeMutationRandomGenerator& randomGenerator,
+        SimulationParameters const& parameters,
+        MutatedGenome& target);
+
+    static void neuronDataMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void propertiesMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void geometryMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void customGeometryMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void cellFunctionMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void insertMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void deleteMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void translateMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void duplicateMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void colorMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+    static void uniformColorMutation(GenomeMutationRandomGenerator& randomGenerator, SimulationParameters const& parameters, MutatedGenome& target);
+};
@@ -0,0 +1,304 @@
+#include "GenomeOptimizer.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "Base/Parallel.h"
+#include "Descriptions.h"
+#include "GenomeAnalytics.h"
+#include "GenomeDecoderBase.h"
+
+namespace
+{
+    auto constexpr MinGenomesPerThread = 64;
+
+    //reads a (sub)genome and writes its canonical encoding to 'target' if it is not null
+    class GenomeProcessor
+    {
+    public:
+        GenomeProcessor(GenomeValidationResult& result, std::vector<uint8_t>* target)
+            : _result(result)
+            , _target(target)
+        {}
+
+        void processGenome(uint8_t const* genome, int genomeSize, int depth)
+        {
+            if (genomeSize == 0) {
+                return;
+            }
+            if (genomeSize < Const::GenomeHeaderSize) {
+                ++_result.numIncompleteHeaders;
+                _result.numUnreachableBytes += genomeSize;
+                return;
+            }
+            _genome = genome;
+            _genomeSize = genomeSize;
+
+            writeModulo(Const::GenomeHeaderShapePos, ConstructionShape_Count);
+            writeBool(1);
+            writeBool(Const::GenomeHeaderSeparationPos);
+            writeModulo(Const::GenomeHeaderAlignmentPos, ConstructorAngleAlignment_Count);
+            writeRaw(4, 2);  //stiffness and connection distance
+
+            for (auto nodeAddress = Const::GenomeHeaderSize; nodeAddress < genomeSize;) {
+                nodeAddress = processNode(nodeAddress, depth);
+            }
+        }
+
+    private:
+        //returns the address of the next node
+        int processNode(int nodeAddress, int depth)
+        {
+            auto cellFunction = GenomeDecoderBase::getNextCellFunctionType(_genome, nodeAddress);
+            writeModulo(nodeAddress, CellFunction_Count);
+            writeRaw(nodeAddress + 1, 2);  //angle and energy
+            writeOptional(nodeAddress + Const::CellRequiredConnectionsPos, MAX_CELL_BONDS + 1);
+            writeRaw(nodeAddress + 4, 1);  //execution order number: its range is a simulation parameter
+            writeModulo(nodeAddress + Const::CellColorPos, MAX_COLORS);
+            writeOptional(nodeAddress + 6, 0);
+            writeBool(nodeAddress + 7);
+
+            auto dataAddress = nodeAddress + Const::CellBasicBytes;
+            auto nodeEndAddress = dataAddress;
+            switch (cellFunction) {
+            case CellFunction_Neuron:
+                writeRaw(dataAddress, Const::NeuronBytes);
+                nodeEndAddress += Const::NeuronBytes;
+                break;
+            case CellFunction_Transmitter:
+                writeModulo(dataAddress, EnergyDistributionMode_Count);
+                nodeEndAddress += Const::TransmitterBytes;
+                break;
+            case CellFunction_Constructor:
+                writeRaw(dataAddress, Const::ConstructorFixedBytes);
+                nodeEndAddress = processGenomeReference(dataAddress + Const::ConstructorFixedBytes, depth);
+                break;
+            case CellFunction_Sensor:
+                writeModulo(dataAddress, SensorMode_Count);
+                writeRaw(dataAddress + 1, 2);  //angle and density
+                writeModulo(dataAddress + 3, MAX_COLORS);
+                nodeEndAddress += Const::SensorBytes;
+                break;
+            case CellFunction_Nerve:
+                writeRaw(dataAddress, Const::NerveBytes);
+                nodeEndAddress += Const::NerveBytes;
+                break;
+            case CellFunction_Attacker:
+                writeModulo(dataAddress, EnergyDistributionMode_Count);
+                nodeEndAddress += Const::AttackerBytes;
+                break;
+            case CellFunction_Injector:
+                writeModulo(dataAddress, InjectorMode_Count);
+                nodeEndAddress = processGenomeReference(dataAddress + Const::InjectorFixedBytes, depth);
+                break;
+            case CellFunction_Muscle:
+                writeModulo(dataAddress, MuscleMode_Count);
+                nodeEndAddress += Const::MuscleBytes;
+                break;
+            case CellFunction_Defender:
+                writeModulo(dataAddress, DefenderMode_Count);
+                nodeEndAddress += Const::DefenderBytes;
+                break;
+            }
+            if (nodeEndAddress > _genomeSize) {
+                ++_result.numTruncatedNodes;
+            }
+            return nodeAddress + Const::CellBasicBytes + GenomeDecoderBase::getNextCellFunctionDataSize(_genome, _genomeSize, nodeAddress);
+        }
+
+        //processes the self-copy flag and the subgenome at 'address', returns the end address claimed by the encoded subgenome size
+        int processGenomeReference(int address, int depth)
+        {
+            writeBool(address);
+            if (GenomeDecoderBase::convertByteToBool(readByte(address))) {
+                return address + 1;
+            }
+            auto encodedSize = GenomeDecoderBase::convertBytesToWord(readByte(address + 1), readByte(address + 2));
+            auto subGenomeAddress = address + 3;
+            if (subGenomeAddress > _genomeSize) {
+                //truncated size word, the decoders read an empty subgenome
+                write(address + 1, 0);
+                write(address + 2, 0);
+                return subGenomeAddress + encodedSize;
+            }
+            auto subGenomeSize = std::min(encodedSize, _genomeSize - subGenomeAddress);
+
+            auto sizePos = 0;
+            if (_target) {
+                sizePos = toInt(_target->size());
+                _target->resize(sizePos + 2);
+            }
+            if (depth < GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH) {
+                auto genome = _genome;
+                auto genomeSize = _genomeSize;
+                processGenome(genome + subGenomeAddress, subGenomeSize, depth + 1);
+                _genome = genome;
+                _genomeSize = genomeSize;
+            } else if (_target) {
+                //the decoders do not descend any further
+                _target->insert(_target->end(), _genome + subGenomeAddress, _genome + subGenomeAddress + subGenomeSize);
+            }
+            if (_target) {
+                auto newSize = toInt(_target->size()) - (sizePos + 2);
+                GenomeDecoderBase::convertWordToBytes(newSize, (*_target)[sizePos], (*_target)[sizePos + 1]);
+            }
+            return subGenomeAddress + encodedSize;
+        }
+
+        uint8_t readByte(int address) const { return GenomeDecoderBase::readByte(_genome, _genomeSize, address); }
+
+        //bytes beyond the (sub)genome are not written, truncated nodes stay truncated
+        void write(int address, uint8_t value)
+        {
+            if (address >= _genomeSize) {
+                return;
+            }
+            if (_genome[address] != value) {
+                ++_result.numNonCanonicalBytes;
+            }
+            if (_target) {
+                _target->emplace_back(value);
+            }
+        }
+
+        void writeRaw(int address, int count)
+        {
+            for (int i = 0; i < count; ++i) {
+                write(address + i, readByte(address + i));
+            }
+        }
+
+        void writeModulo(int address, int moduloValue) { write(address, static_cast<uint8_t>(readByte(address) % moduloValue)); }
+
+        void writeBool(int address) { write(address, GenomeDecoderBase::convertBoolToByte(GenomeDecoderBase::convertByteToBool(readByte(address)))); }
+
+        //moduloValue == 0 is used if the range of the value is a simulation parameter
+        void writeOptional(int address, int moduloValue)
+        {
+            auto value = readByte(address);
+            if (value > 127) {
+                write(address, 0xff);
+            } else {
+                write(address, moduloValue > 0 ? static_cast<uint8_t>(value % moduloValue) : value);
+            }
+        }
+
+        GenomeValidationResult& _result;
+        std::vector<uint8_t>* _target;
+        uint8_t const* _genome = nullptr;
+        int _genomeSize = 0;
+    };
+
+    std::vector<int> getNodeAddresses(std::vector<uint8_t> const& genome)
+    {
+        std::vector<int> result;
+        GenomeDecoderBase::executeForEachNode(genome.data(), toInt(genome.size()), [&](int nodeAddress) { result.emplace_back(nodeAddress); });
+        return result;
+    }
+}
+
+GenomeValidationResult GenomeOptimizer::validate(std::vector<uint8_t> const& genome)
+{
+    GenomeValidationResult result;
+    GenomeProcessor(result, nullptr).processGenome(genome.data(), toInt(genome.size()), 0);
+    return result;
+}
+
+std::vector<uint8_t> GenomeOptimizer::optimize(std::vector<uint8_t> const& genome)
+{
+    GenomeValidationResult validationResult;
+    std::vector<uint8_t> result;
+    result.reserve(genome.size());
+    GenomeProcessor(validationResult, &result).processGenome(genome.data(), toInt(genome.size()), 0);
+    return result;
+}
+
+GenomeOptimizationStatistics GenomeOptimizer::optimize(ClusteredDataDescription& data)
+{
+    GenomeOptimizationStatistics result;
+
+    //collect distinct genomes
+    std::vector<std::vector<uint8_t>*> genomeRefs;
+    std::vector<int> genomeIndices;
+    std::vector<std::vector<uint8_t>> distinctGenomes;
+    std::unordered_map<uint64_t, std::vector<int>> distinctGenomeIndicesByHash;
+    for (auto& cluster : data.clusters) {
+        for (auto& cell : cluster.cells) {
+            if (!cell.hasGenome()) {
+                continue;
+            }
+            auto& genome = cell.getGenomeRef();
+            auto& candidates = distinctGenomeIndicesByHash[GenomeAnalytics::calcHash(genome)];
+            auto findResult = std::ranges::find_if(candidates, [&](int index) { return distinctGenomes.at(index) == genome; });
+            if (findResult != candidates.end()) {
+                genomeIndices.emplace_back(*findResult);
+            } else {
+                candidates.emplace_back(toInt(distinctGenomes.size()));
+                genomeIndices.emplace_back(toInt(distinctGenomes.size()));
+                distinctGenomes.emplace_back(genome);
+            }
+            genomeRefs.emplace_back(&genome);
+            result.numBytesBefore += genome.size();
+        }
+    }
+    result.numGenomes = toInt(genomeRefs.size());
+    result.numDistinctGenomes = toInt(distinctGenomes.size());
+
+    //optimize distinct genomes
+    auto numDistinctGenomes = toInt(distinctGenomes.size());
+    std::vector<std::vector<uint8_t>> optimizedGenomes(numDistinctGenomes);
+    std::vector<char> invalidGenomes(numDistinctGenomes, false);
+    Parallel::forEachChunk(
+        numDistinctGenomes,
+        [&](int, int startIndex, int endIndex) {
+            for (int index = startIndex; index < endIndex; ++index) {
+                invalidGenomes[index] = !validate(distinctGenomes[index]).isValid();
+                optimizedGenomes[index] = optimize(distinctGenomes[index]);
+            }
+        },
+        MinGenomesPerThread);
+
+    //write back
+    auto genomeRefIndex = 0;
+    for (auto& cluster : data.clusters) {
+        for (auto& cell : cluster.cells) {
+            if (!cell.hasGenome()) {
+                continue;
+            }
+            auto distinctIndex = genomeIndices.at(genomeRefIndex++);
+            auto const& origGenome = distinctGenomes.at(distinctIndex);
+            auto const& optimizedGenome = optimizedGenomes.at(distinctIndex);
+            result.numBytesAfter += optimizedGenome.size();
+            if (invalidGenomes.at(distinctIndex)) {
+                ++result.numInvalidGenomes;
+            }
+            if (optimizedGenome == origGenome) {
+                continue;
+            }
+            ++result.numChangedGenomes;
+            if (cell.getCellFunctionType() == CellFunction_Constructor) {
+                auto& constructor = std::get<ConstructorDescription>(*cell.cellFunction);
+                constructor.genomeReadPosition = convertGenomeReadPosition(origGenome, optimizedGenome, constructor.genomeReadPosition);
+            }
+            cell.getGenomeRef() = optimizedGenome;
+        }
+    }
+    return result;
+}
+
+int GenomeOptimizer::convertGenomeReadPosition(std::vector<uint8_t> const& origGenome, std::vector<uint8_t> const& optimizedGenome, int readPosition)
+{
+    if (readPosition >= toInt(origGenome.size())) {
+        return toInt(optimizedGenome.size());
+    }
+    if (readPosition < Const::GenomeHeaderSize) {
+        return std::min(readPosition, toInt(optimizedGenome.size()));
+    }
+    auto origNodeAddresses = getNodeAddresses(origGenome);
+    auto optimizedNodeAddresses = getNodeAddresses(optimizedGenome);
+    auto nodeIndex = toInt(std::ranges::upper_bound(origNodeAddresses, readPosition) - origNodeAddresses.begin()) - 1;
+    if (nodeIndex < 0 || nodeIndex >= toInt(optimizedNodeAddresses.size())) {
+        return toInt(optimizedGenome.size());
+    }
+    return optimizedNodeAddresses.at(nodeIndex);
+}
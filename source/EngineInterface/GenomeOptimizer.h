@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Definitions.h"
+
+struct GenomeValidationResult
+{
+    int numTruncatedNodes = 0;       //nodes exceeding their (sub)genome, the missing bytes are read as 0
+    int numIncompleteHeaders = 0;    //(sub)genomes which are shorter than a header and hence contain no nodes
+    int numUnreachableBytes = 0;     //bytes of incomplete headers
+    int numNonCanonicalBytes = 0;    //bytes which are only interpreted modulo a value range
+
+    bool isValid() const { return numTruncatedNodes == 0 && numIncompleteHeaders == 0; }
+    bool isCanonical() const { return isValid() && numNonCanonicalBytes == 0; }
+};
+
+struct GenomeOptimizationStatistics
+{
+    int numGenomes = 0;
+    int numDistinctGenomes = 0;
+    int numInvalidGenomes = 0;
+    int numChangedGenomes = 0;
+    uint64_t numBytesBefore = 0;
+    uint64_t numBytesAfter = 0;
+};
+
+//validates and canonicalizes genome byte code on the host, the result is never larger than the original genome
+//the optimized genome is decoded to the same nodes as the original one by the gpu kernels and GenomeDescriptionConverter:
+//- truncated nodes stay truncated since the decoders read the missing bytes as 0
+//- incomplete headers of subgenomes are removed
+//- subgenome sizes are rewritten to the sizes actually used
+//- bytes interpreted modulo a parameter-independent range (cell function, color, modes, bools, ...) are reduced to that range
+class GenomeOptimizer
+{
+public:
+    static GenomeValidationResult validate(std::vector<uint8_t> const& genome);
+
+    static std::vector<uint8_t> optimize(std::vector<uint8_t> const& genome);
+
+    //optimizes all genomes of constructors and injectors and adapts the genome read positions of the constructors
+    static GenomeOptimizationStatistics optimize(ClusteredDataDescription& data);
+
+    //maps a read position of a constructor from the original genome to the optimized genome
+    static int convertGenomeReadPosition(std::vector<uint8_t> const& origGenome, std::vector<uint8_t> const& optimizedGenome, int readPosition);
+};
@@ -0,0 +1,132 @@
+#include "GenomeScanner.h"
+
+#include <algorithm>
+
+#include "Base/Definitions.h"
+#include "GenomeDecoderBase.h"
+
+GenomeNodeInfo GenomeScanner::scanNode(std::vector<uint8_t> const& data, int nodeAddress, int genomeEndAddress)
+{
+    auto genome = data.data();
+
+    GenomeNodeInfo result;
+    result.address = nodeAddress;
+    result.genomeEndAddress = genomeEndAddress;
+    result.cellFunction = GenomeDecoderBase::readByte(genome, genomeEndAddress, nodeAddress) % CellFunction_Count;
+    if (nodeAddress >= genomeEndAddress) {
+        result.endAddress = genomeEndAddress;
+        return result;
+    }
+
+    if (result.cellFunction == CellFunction_Constructor || result.cellFunction == CellFunction_Injector) {
+        auto cellFunctionFixedBytes = result.cellFunction == CellFunction_Constructor ? Const::ConstructorFixedBytes : Const::InjectorFixedBytes;
+        auto makeSelfCopy =
+            GenomeDecoderBase::convertByteToBool(GenomeDecoderBase::readByte(genome, genomeEndAddress, nodeAddress + Const::CellBasicBytes + cellFunctionFixedBytes));
+        if (!makeSelfCopy) {
+            result.subGenomeAddress = nodeAddress + Const::CellBasicBytes + cellFunctionFixedBytes + 3;
+            result.subGenomeEndAddress = result.subGenomeAddress + GenomeDecoderBase::getNextSubGenomeSize(genome, genomeEndAddress, nodeAddress);
+        }
+    }
+    auto endAddress = nodeAddress + Const::CellBasicBytes + GenomeDecoderBase::getNextCellFunctionDataSize(genome, genomeEndAddress, nodeAddress);
+    result.endAddress = std::min(endAddress, genomeEndAddress);
+    return result;
+}
+
+int GenomeScanner::getNumNodes(std::vector<uint8_t> const& data)
+{
+    auto result = 0;
+    forEachNode(data, [&](GenomeNodeInfo const&) { ++result; });
+    return result;
+}
+
+int GenomeScanner::getNumNodesRecursively(std::vector<uint8_t> const& data)
+{
+    auto result = 0;
+    forEachNodeRecursively(data, [&](GenomeNodeInfo const&) { ++result; });
+    return result;
+}
+
+int GenomeScanner::getNodeIndex(std::vector<uint8_t> const& data, int nodeAddress)
+{
+    auto dataSize = toInt(data.size());
+    auto result = 0;
+    for (auto address = std::min(Const::GenomeHeaderSize, dataSize); address < dataSize && address < nodeAddress; ++result) {
+        address = scanNode(data, address, dataSize).endAddress;
+    }
+    return result;
+}
+
+int GenomeScanner::getNodeAddress(std::vector<uint8_t> const& data, int nodeIndex)
+{
+    auto dataSize = toInt(data.size());
+    auto result = std::min(Const::GenomeHeaderSize, dataSize);
+    for (int index = 0; index < nodeIndex && result < dataSize; ++index) {
+        result = scanNode(data, result, dataSize).endAddress;
+    }
+    return result;
+}
+
+GenomeNodeIndex::GenomeNodeIndex(std::vector<uint8_t> const& data)
+{
+    build(data);
+}
+
+void GenomeNodeIndex::build(std::vector<uint8_t> const& data)
+{
+    _nodes.clear();
+    _maxDepth = 0;
+    _genomeEndAddress = std::min(Const::GenomeHeaderSize, toInt(data.size()));
+
+    GenomeScanner::forEachNode(data, [&](GenomeNodeInfo const& node) {
+        _nodes.emplace_back(node);
+        _genomeEndAddress = node.endAddress;
+    });
+    _numNodes = toInt(_nodes.size());
+
+    for (int index = 0; index < _numNodes; ++index) {
+        auto node = _nodes[index];
+        if (node.hasSubGenome()) {
+            GenomeScanner::forEachNodeRecursively(
+                data,
+                node.subGenomeAddress,
+                node.subGenomeEndAddress,
+                [&](GenomeNodeInfo const& subNode) {
+                    _nodes.emplace_back(subNode);
+                    _maxDepth = std::max(_maxDepth, subNode.depth);
+                },
+                1);
+        }
+    }
+}
+
+int GenomeNodeIndex::getNumNodes() const
+{
+    return _numNodes;
+}
+
+int GenomeNodeIndex::getNumNodesRecursively() const
+{
+    return toInt(_nodes.size());
+}
+
+int GenomeNodeIndex::getMaxDepth() const
+{
+    return _maxDepth;
+}
+
+int GenomeNodeIndex::getNodeIndex(int nodeAddress) const
+{
+    auto nodesEnd = _nodes.begin() + _numNodes;
+    auto findResult = std::lower_bound(_nodes.begin(), nodesEnd, nodeAddress, [](GenomeNodeInfo const& node, int address) { return node.address < address; });
+    return toInt(findResult - _nodes.begin());
+}
+
+int GenomeNodeIndex::getNodeAddress(int nodeIndex) const
+{
+    return nodeIndex < _numNodes ? _nodes[nodeIndex].address : _genomeEndAddress;
+}
+
+std::vector<GenomeNodeInfo> const& GenomeNodeIndex::getNodes() const
+{
+    return _nodes;
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "CellFunctionConstants.h"
+#include "GenomeConstants.h"
+
+struct GenomeNodeInfo
+{
+    int address = 0;            //absolute byte position in the scanned data
+    int endAddress = 0;         //clamped to the end of the enclosing genome
+    int genomeEndAddress = 0;   //end of the enclosing (sub)genome
+    int depth = 0;              //0 for nodes of the outermost genome
+    CellFunction cellFunction = CellFunction_None;
+
+    //byte range of the contained subgenome (empty for self-copies and other cell functions)
+    int subGenomeAddress = 0;
+    int subGenomeEndAddress = 0;
+
+    bool hasSubGenome() const { return subGenomeEndAddress > subGenomeAddress; }
+};
+
+//traverses genome bytes without decoding them into descriptions (byte layout as in GenomeDescriptionConverter)
+class GenomeScanner
+{
+public:
+    static GenomeNodeInfo scanNode(std::vector<uint8_t> const& data, int nodeAddress, int genomeEndAddress);
+
+    //calls func(GenomeNodeInfo const&) for each node of the genome located in [genomeAddress, genomeEndAddress)
+    template <typename Func>
+    static void forEachNode(std::vector<uint8_t> const& data, int genomeAddress, int genomeEndAddress, Func const& func, int depth = 0);
+    template <typename Func>
+    static void forEachNode(std::vector<uint8_t> const& data, Func const& func);
+
+    //includes the nodes of all subgenomes in depth-first order
+    template <typename Func>
+    static void forEachNodeRecursively(std::vector<uint8_t> const& data, int genomeAddress, int genomeEndAddress, Func const& func, int depth = 0);
+    template <typename Func>
+    static void forEachNodeRecursively(std::vector<uint8_t> const& data, Func const& func);
+
+    static int getNumNodes(std::vector<uint8_t> const& data);
+    static int getNumNodesRecursively(std::vector<uint8_t> const& data);
+
+    //number of nodes of the outermost genome starting before nodeAddress
+    static int getNodeIndex(std::vector<uint8_t> const& data, int nodeAddress);
+
+    //returns the end of the genome if nodeIndex exceeds the number of nodes
+    static int getNodeAddress(std::vector<uint8_t> const& data, int nodeIndex);
+};
+
+//node-offset index of a genome including the nodes of its subgenomes, memory is reused when building the index again
+class GenomeNodeIndex
+{
+public:
+    GenomeNodeIndex() = default;
+    explicit GenomeNodeIndex(std::vector<uint8_t> const& data);
+
+    void build(std::vector<uint8_t> const& data);
+
+    int getNumNodes() const;
+    int getNumNodesRecursively() const;
+    int getMaxDepth() const;
+    int getNodeIndex(int nodeAddress) const;
+    int getNodeAddress(int nodeIndex) const;
+
+    //nodes of the outermost genome come first, followed by the nodes of subgenomes in depth-first order
+    std::vector<GenomeNodeInfo> const& getNodes() const;
+
+private:
+    std::vector<GenomeNodeInfo> _nodes;
+    int _numNodes = 0;
+    int _maxDepth = 0;
+    int _genomeEndAddress = 0;
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+template <typename Func>
+void GenomeScanner::forEachNode(std::vector<uint8_t> const& data, int genomeAddress, int genomeEndAddress, Func const& func, int depth)
+{
+    for (auto nodeAddress = std::min(genomeAddress + Const::GenomeHeaderSize, genomeEndAddress); nodeAddress < genomeEndAddress;) {
+        auto node = scanNode(data, nodeAddress, genomeEndAddress);
+        node.depth = depth;
+        func(node);
+        nodeAddress = node.endAddress;
+    }
+}
+
+template <typename Func>
+void GenomeScanner::forEachNode(std::vector<uint8_t> const& data, Func const& func)
+{
+    forEachNode(data, 0, static_cast<int>(data.size()), func);
+}
+
+template <typename Func>
+void GenomeScanner::forEachNodeRecursively(std::vector<uint8_t> const& data, int genomeAddress, int genomeEndAddress, Func const& func, int depth)
+{
+    forEachNode(
+        data,
+        genomeAddress,
+        genomeEndAddress,
+        [&](GenomeNodeInfo const& node) {
+            func(node);
+            if (node.hasSubGenome()) {
+                forEachNodeRecursively(data, node.subGenomeAddress, node.subGenomeEndAddress, func, depth + 1);
+            }
+        },
+        depth);
+}
+
+template <typename Func>
+void GenomeScanner::forEachNodeRecursively(std::vector<uint8_t> const& data, Func const& func)
+{
+    forEachNodeRecursively(data, 0, static_cast<int>(data.size()), func);
+}
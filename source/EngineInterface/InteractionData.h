@@ -0,0 +1,24 @@
+#pragma once
+
+#include "VectorTypes.h"
+
+struct ApplyForceData
+{
+    float2 startPos;
+    float2 endPos;
+    float2 force;
+    float radius;
+    bool onlyRotation;
+};
+
+struct PointSelectionData
+{
+    float2 pos;
+    float radius;
+};
+
+struct AreaSelectionData
+{
+    float2 startPos;
+    float2 endPos;
+};
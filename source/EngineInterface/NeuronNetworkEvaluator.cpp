@@ -0,0 +1,175 @@
+#include "NeuronNetworkEvaluator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "Base/Definitions.h"
+#include "Base/Parallel.h"
+
+namespace
+{
+    auto constexpr MinBlocksPerChunk = 64;
+    auto constexpr BlockSize = NeuronNetworkEvaluator::BlockSize;
+
+    auto constexpr MinExpArgument = -87.0f;
+    auto constexpr MaxExpArgument = 88.0f;
+
+    //exp(x) for x in [MinExpArgument, MaxExpArgument] via 2^n * p(r) with x = n * ln(2) + r and |r| <= ln(2) / 2
+    //(relative error below 2e-7), in contrast to std::exp it contains no branches and calls, so that loops over it are vectorized
+    inline float calcExp(float x)
+    {
+        auto constexpr RoundingShift = 12582912.0f;  //1.5 * 2^23, adding it rounds to an integer
+        auto n = (x * 1.44269504088896341f + RoundingShift) - RoundingShift;
+        auto r = x - n * 0.693359375f + n * 2.12194440e-4f;
+        auto p = 1.9875691500e-4f;
+        p = p * r + 1.3981999507e-3f;
+        p = p * r + 8.3334519073e-3f;
+        p = p * r + 4.1665795894e-2f;
+        p = p * r + 1.6666665459e-1f;
+        p = p * r + 5.0000001201e-1f;
+        p = p * r * r + r + 1.0f;
+        return p * std::bit_cast<float>((static_cast<int32_t>(n) + 127) << 23);
+    }
+
+    //outputs[lane][row] = scaledSigmoid(biases[row][lane] + sum_col weights[row][col][lane] * inputs[lane][col])
+    //the loops over the lanes are independent and vectorized, the function is compiled for several instruction sets if supported
+    VECTORIZED_FUNCTION void evaluateBlock(float const* weights, float const* biases, float const* inputs, float* outputs, int numLanes)
+    {
+        float input[MAX_CHANNELS][BlockSize];
+        for (int col = 0; col < MAX_CHANNELS; ++col) {
+            for (int lane = 0; lane < BlockSize; ++lane) {
+                input[col][lane] = lane < numLanes ? inputs[lane * MAX_CHANNELS + col] : 0.0f;
+            }
+        }
+
+        float output[MAX_CHANNELS * BlockSize];
+        for (int row = 0; row < MAX_CHANNELS; ++row) {
+            auto sum = output + row * BlockSize;
+            for (int lane = 0; lane < BlockSize; ++lane) {
+                sum[lane] = biases[row * BlockSize + lane];
+            }
+            for (int col = 0; col < MAX_CHANNELS; ++col) {
+                for (int lane = 0; lane < BlockSize; ++lane) {
+                    sum[lane] += weights[(row * MAX_CHANNELS + col) * BlockSize + lane] * input[col][lane];
+                }
+            }
+        }
+
+        //the clamping is done in a separate loop because gcc does not if-convert it when followed by further floating point
+        //operations in the same loop (which might trap), this would prevent vectorization
+        for (int i = 0; i < MAX_CHANNELS * BlockSize; ++i) {
+            output[i] = std::min(std::max(-output[i], MinExpArgument), MaxExpArgument);
+        }
+        for (int i = 0; i < MAX_CHANNELS * BlockSize; ++i) {
+            output[i] = 2.0f / (1.0f + calcExp(output[i])) - 1.0f;
+        }
+
+        for (int lane = 0; lane < numLanes; ++lane) {
+            for (int row = 0; row < MAX_CHANNELS; ++row) {
+                outputs[lane * MAX_CHANNELS + row] = output[row * BlockSize + lane];
+            }
+        }
+    }
+}
+
+float NeuronNetworkEvaluator::scaledSigmoid(float z)
+{
+    return 2.0f / (1.0f + calcExp(std::min(std::max(-z, MinExpArgument), MaxExpArgument))) - 1.0f;
+}
+
+void NeuronNetworkEvaluator::clear()
+{
+    _numNetworks = 0;
+    _weights.clear();
+    _biases.clear();
+}
+
+void NeuronNetworkEvaluator::reserve(int numNetworks)
+{
+    auto numBlocks = (numNetworks + BlockSize - 1) / BlockSize;
+    _weights.reserve(numBlocks * WeightsPerBlock);
+    _biases.reserve(numBlocks * BiasesPerBlock);
+}
+
+int NeuronNetworkEvaluator::addNetwork(NeuronDescription const& neuron)
+{
+    float weights[MAX_CHANNELS * MAX_CHANNELS];
+    for (int row = 0; row < MAX_CHANNELS; ++row) {
+        for (int col = 0; col < MAX_CHANNELS; ++col) {
+            weights[row * MAX_CHANNELS + col] = neuron.weights[row][col];
+        }
+    }
+    return addNetwork(weights, neuron.biases.data());
+}
+
+int NeuronNetworkEvaluator::addNetwork(float const* weights, float const* biases)
+{
+    auto lane = _numNetworks % BlockSize;
+    if (lane == 0) {
+        _weights.resize(_weights.size() + WeightsPerBlock, 0.0f);
+        _biases.resize(_biases.size() + BiasesPerBlock, 0.0f);
+    }
+    auto blockWeights = _weights.data() + _weights.size() - WeightsPerBlock;
+    auto blockBiases = _biases.data() + _biases.size() - BiasesPerBlock;
+    for (int entry = 0; entry < MAX_CHANNELS * MAX_CHANNELS; ++entry) {
+        blockWeights[entry * BlockSize + lane] = weights[entry];
+    }
+    for (int row = 0; row < MAX_CHANNELS; ++row) {
+        blockBiases[row * BlockSize + lane] = biases[row];
+    }
+    return _numNetworks++;
+}
+
+void NeuronNetworkEvaluator::evaluate(std::span<float const> inputs, std::span<float> outputs) const
+{
+    CHECK(toInt(inputs.size()) == _numNetworks * MAX_CHANNELS);
+    CHECK(toInt(outputs.size()) == _numNetworks * MAX_CHANNELS);
+
+    auto numBlocks = (_numNetworks + BlockSize - 1) / BlockSize;
+    Parallel::forEachChunk(
+        numBlocks,
+        [&](int, int startBlock, int endBlock) {
+            for (int blockIndex = startBlock; blockIndex < endBlock; ++blockIndex) {
+                auto offset = blockIndex * BlockSize * MAX_CHANNELS;
+                evaluateBlock(
+                    _weights.data() + blockIndex * WeightsPerBlock,
+                    _biases.data() + blockIndex * BiasesPerBlock,
+                    inputs.data() + offset,
+                    outputs.data() + offset,
+                    std::min(BlockSize, _numNetworks - blockIndex * BlockSize));
+            }
+        },
+        MinBlocksPerChunk);
+}
+
+void NeuronNetworkEvaluator::evaluateSequence(int networkIndex, std::span<float const> inputs, std::span<float> outputs) const
+{
+    CHECK(networkIndex >= 0 && networkIndex < _numNetworks);
+    CHECK(inputs.size() == outputs.size() && inputs.size() % MAX_CHANNELS == 0);
+
+    //the weights of the network are broadcast to all lanes which then run over consecutive time steps
+    auto blockWeights = _weights.data() + (networkIndex / BlockSize) * WeightsPerBlock;
+    auto blockBiases = _biases.data() + (networkIndex / BlockSize) * BiasesPerBlock;
+    auto networkLane = networkIndex % BlockSize;
+    std::vector<float> weights(WeightsPerBlock);
+    std::vector<float> biases(BiasesPerBlock);
+    for (int entry = 0; entry < MAX_CHANNELS * MAX_CHANNELS; ++entry) {
+        std::fill_n(weights.begin() + entry * BlockSize, BlockSize, blockWeights[entry * BlockSize + networkLane]);
+    }
+    for (int row = 0; row < MAX_CHANNELS; ++row) {
+        std::fill_n(biases.begin() + row * BlockSize, BlockSize, blockBiases[row * BlockSize + networkLane]);
+    }
+
+    auto numSteps = toInt(inputs.size()) / MAX_CHANNELS;
+    auto numBlocks = (numSteps + BlockSize - 1) / BlockSize;
+    Parallel::forEachChunk(
+        numBlocks,
+        [&](int, int startBlock, int endBlock) {
+            for (int blockIndex = startBlock; blockIndex < endBlock; ++blockIndex) {
+                auto offset = blockIndex * BlockSize * MAX_CHANNELS;
+                evaluateBlock(weights.data(), biases.data(), inputs.data() + offset, outputs.data() + offset, std::min(BlockSize, numSteps - blockIndex * BlockSize));
+            }
+        },
+        MinBlocksPerChunk);
+}
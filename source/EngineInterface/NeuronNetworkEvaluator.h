@@ -0,0 +1,44 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "FundamentalConstants.h"
+#include "Descriptions.h"
+
+//evaluates the networks of many neuron cells on the host in the same way as NeuronProcessor on the gpu:
+//output[row] = scaledSigmoid(bias[row] + sum_col weight[row][col] * input[col])
+//the weights are packed into blocks of BlockSize networks stored lane-interleaved such that the inner loops run over
+//independent networks (or time steps) and are vectorized by the compiler (with AVX-512/AVX2 clones on gcc/clang)
+class NeuronNetworkEvaluator
+{
+public:
+    static int constexpr BlockSize = 8;
+
+    static float scaledSigmoid(float z);  //maps to [-1, 1]
+
+    void clear();
+    void reserve(int numNetworks);
+
+    //returns the index of the added network
+    int addNetwork(NeuronDescription const& neuron);
+    //weights in row-major order as in NeuronFunction::NeuronState
+    int addNetwork(float const* weights, float const* biases);
+
+    int getNumNetworks() const { return _numNetworks; }
+
+    //inputs and outputs contain MAX_CHANNELS values for each network
+    void evaluate(std::span<float const> inputs, std::span<float> outputs) const;
+
+    //evaluates a single network on a sequence of recorded inputs ("brain replay")
+    //inputs and outputs contain MAX_CHANNELS values for each time step
+    void evaluateSequence(int networkIndex, std::span<float const> inputs, std::span<float> outputs) const;
+
+private:
+    static int constexpr WeightsPerBlock = MAX_CHANNELS * MAX_CHANNELS * BlockSize;
+    static int constexpr BiasesPerBlock = MAX_CHANNELS * BlockSize;
+
+    int _numNetworks = 0;
+    std::vector<float> _weights;  //[block][row][col][lane]
+    std::vector<float> _biases;   //[block][row][lane]
+};
@@ -1,5 +1,10 @@
 #include "PreviewDescriptionConverter.h"
 
+#include <algorithm>
+#include <ranges>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
 #include <boost/range/combine.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 
@@ -7,9 +12,13 @@
 #include "ShapeGenerator.h"
 #include "Base/Math.h"
 #include "EngineInterface/GenomeDescriptionConverter.h"
+#include "GenomeAnalytics.h"
 
 namespace
 {
+    //sorted indices of connected cells, stored inline up to the usual number of bonds
+    using ConnectionIndices = boost::container::small_vector<int, MAX_CELL_BONDS + 2>;
+
     struct CellPreviewDescriptionIntern
     {
         RealVector2D pos;
@@ -18,20 +27,29 @@ namespace
         std::optional<int> inputExecutionOrderNumber;
         bool outputBlocked = false;
         int color = 0;
-        std::set<int> connectionIndices;
+        ConnectionIndices connectionIndices;
     };
 
-    void insert(std::vector<CellPreviewDescriptionIntern>& target, std::vector<CellPreviewDescriptionIntern> const& source)
+    void addConnectionIndex(ConnectionIndices& connectionIndices, int connectionIndex)
     {
-        auto offset = toInt(source.size());
-        for (auto& cell : target) {
-            std::set<int> newConnectionIndices;
-            for (auto const& connectionIndex : cell.connectionIndices) {
-                newConnectionIndices.insert(connectionIndex + offset);
+        auto pos = std::lower_bound(connectionIndices.begin(), connectionIndices.end(), connectionIndex);
+        if (pos == connectionIndices.end() || *pos != connectionIndex) {
+            connectionIndices.insert(pos, connectionIndex);
+        }
+    }
+
+    bool containsConnectionIndex(ConnectionIndices const& connectionIndices, int connectionIndex)
+    {
+        return std::binary_search(connectionIndices.begin(), connectionIndices.end(), connectionIndex);
+    }
+
+    void shiftConnectionIndices(std::vector<CellPreviewDescriptionIntern>& cells, int offset)
+    {
+        for (auto& cell : cells) {
+            for (auto& connectionIndex : cell.connectionIndices) {
+                connectionIndex += offset;
             }
-            cell.connectionIndices = newConnectionIndices;
         }
-        target.insert(target.begin(), source.begin(), source.end());
     }
 
     void rotate(std::vector<CellPreviewDescriptionIntern>& cells, RealVector2D const& center, float angle)
@@ -50,34 +68,26 @@ namespace
         }
     }
 
+    //same criterion as in CellConnectionProcessor::wouldResultInOverlappingConnection: only connections between two neighbors of cell1 are considered
     bool isThereNoOverlappingConnection(
         std::vector<CellPreviewDescriptionIntern> const& cells,
         CellPreviewDescriptionIntern const& cell1,
         CellPreviewDescriptionIntern const& cell2)
     {
-        auto n = cell1.connectionIndices.size();
-        if (n < 2) {
+        if (cell1.connectionIndices.size() < 2) {
             return true;
         }
+        auto numCells = toInt(cells.size());
         for (auto const& connectionIndex : cell1.connectionIndices) {
-            if (connectionIndex >= cells.size()) {
+            if (connectionIndex >= numCells) {
                 continue;
             }
-            auto connectedCell = cells.at(connectionIndex);
-            std::set<int> otherConnectionIndices;
-            std::set_intersection(
-                cell1.connectionIndices.begin(),
-                cell1.connectionIndices.end(),
-                connectedCell.connectionIndices.begin(),
-                connectedCell.connectionIndices.end(),
-                std::inserter(otherConnectionIndices, otherConnectionIndices.begin()));
-
-            for (auto const& otherConnectionIndex : otherConnectionIndices) {
-                if (otherConnectionIndex >= cells.size()) {
+            auto const& connectedCell = cells[connectionIndex];
+            for (auto const& otherConnectionIndex : cell1.connectionIndices) {
+                if (otherConnectionIndex >= numCells || !containsConnectionIndex(connectedCell.connectionIndices, otherConnectionIndex)) {
                     continue;
                 }
-                auto otherConnectedCell = cells.at(otherConnectionIndex);
-                if (Math::crossing(cell1.pos, cell2.pos, connectedCell.pos, otherConnectedCell.pos)) {
+                if (Math::crossing(cell1.pos, cell2.pos, connectedCell.pos, cells[otherConnectionIndex].pos)) {
                     return false;
                 }
             }
@@ -102,7 +112,6 @@ namespace
         RealVector2D pos;
         std::unordered_map<IntVector2D, std::vector<int>> cellInternIndicesBySlot;
         int index = 0;
-        auto shapeGenerator = ShapeGeneratorFactory::create(genome.info.shape);
         for (auto const& node : genome.cells) {
             if (index > 0) {
                 pos += result.direction * genome.info.connectionDistance;
@@ -112,7 +121,7 @@ namespace
             shapeResult.angle = node.referenceAngle;
             shapeResult.numRequiredAdditionalConnections = node.numRequiredAdditionalConnections;
             if (genome.info.shape != ConstructionShape_Custom) {
-                shapeResult = shapeGenerator->generateNextConstructionData();
+                shapeResult = ShapeTables::getConstructionData(genome.info.shape, index);
             }
             if (lastReferenceAngle.has_value() && index == genome.cells.size() - 1) {
                 shapeResult.angle = *lastReferenceAngle;
@@ -131,10 +140,10 @@ namespace
             cellIntern.nodeIndex = uniformNodeIndex ? *uniformNodeIndex : index;
             cellIntern.pos = pos;
             if (index > 0) {
-                cellIntern.connectionIndices.insert(index - 1);
+                addConnectionIndex(cellIntern.connectionIndices, index - 1);
             }
             if (index < genome.cells.size() - 1) {
-                cellIntern.connectionIndices.insert(index + 1);
+                addConnectionIndex(cellIntern.connectionIndices, index + 1);
             }
 
             //find nearby cells
@@ -172,8 +181,8 @@ namespace
                 }
                 auto& otherCell = result.cellsIntern.at(otherCellIndex);
                 if (isThereNoOverlappingConnection(result.cellsIntern, cellIntern, otherCell) && isThereNoOverlappingConnection(result.cellsIntern, otherCell, cellIntern)) {
-                    cellIntern.connectionIndices.insert(otherCellIndex);
-                    otherCell.connectionIndices.insert(index);
+                    addConnectionIndex(cellIntern.connectionIndices, otherCellIndex);
+                    addConnectionIndex(otherCell.connectionIndices, index);
                 }
             }
 
@@ -184,13 +193,104 @@ namespace
         return result;
     }
 
-    std::vector<CellPreviewDescriptionIntern> convertToPreviewDescriptionIntern(
+    void transform(ProcessedGenomeDescriptionResult& preview, RealVector2D const& desiredEndPos, float desiredEndAngle)
+    {
+        auto& cells = preview.cellsIntern;
+        if (cells.empty()) {
+            return;
+        }
+        auto actualEndAngle = Math::angleOfVector(preview.direction);
+        auto angleDiff = Math::subtractAngle(desiredEndAngle, actualEndAngle);
+        rotate(cells, cells.back().pos, angleDiff + 180.0f);
+        translate(cells, desiredEndPos - cells.back().pos);
+    }
+}
+
+//previews of subgenomes before transforming them to their final position, they only depend on the subgenome bytes and the reference angle of the last node
+struct PreviewDescriptionCacheData
+{
+    struct SubGenomeEntry
+    {
+        std::vector<uint8_t> genome;
+        std::optional<float> lastReferenceAngle;
+        bool separateConstruction = false;
+        ProcessedGenomeDescriptionResult preview;
+    };
+    std::unordered_map<uint64_t, std::vector<SubGenomeEntry>> subGenomeEntriesByHash;
+    int numSubGenomeEntries = 0;
+
+    std::vector<float> connectingCellMaxDistances;
+    std::optional<std::vector<uint8_t>> genome;
+    PreviewDescription preview;
+};
+
+namespace
+{
+    auto constexpr MaxCachedSubGenomes = 1000;
+
+    ProcessedGenomeDescriptionResult convertToUntransformedPreviewDescriptionIntern(
         GenomeDescription const& genome,
         std::optional<int> const& uniformNodeIndex,
         std::optional<float> const& lastReferenceAngle,
-        std::optional<RealVector2D> const& desiredEndPos,
-        std::optional<float> const& desiredEndAngle,
-        SimulationParameters const& parameters)
+        SimulationParameters const& parameters,
+        PreviewDescriptionCacheData* cache);
+
+    struct SubGenomePreview
+    {
+        std::vector<CellPreviewDescriptionIntern> cellsIntern;
+        bool separateConstruction = false;
+    };
+    SubGenomePreview convertSubGenomeToPreviewDescriptionIntern(
+        std::vector<uint8_t> const& data,
+        int uniformNodeIndex,
+        std::optional<float> const& lastReferenceAngle,
+        RealVector2D const& desiredEndPos,
+        float desiredEndAngle,
+        SimulationParameters const& parameters,
+        PreviewDescriptionCacheData* cache)
+    {
+        PreviewDescriptionCacheData::SubGenomeEntry const* cacheEntry = nullptr;
+        std::vector<PreviewDescriptionCacheData::SubGenomeEntry>* cacheEntries = nullptr;
+        if (cache) {
+            cacheEntries = &cache->subGenomeEntriesByHash[GenomeAnalytics::calcHash(data)];
+            for (auto const& entry : *cacheEntries) {
+                if (entry.lastReferenceAngle == lastReferenceAngle && entry.genome == data) {
+                    cacheEntry = &entry;
+                    break;
+                }
+            }
+        }
+
+        SubGenomePreview result;
+        ProcessedGenomeDescriptionResult preview;
+        if (cacheEntry) {
+            preview = cacheEntry->preview;
+            result.separateConstruction = cacheEntry->separateConstruction;
+        } else {
+            auto subGenome = GenomeDescriptionConverter::convertBytesToDescription(data);
+            preview = convertToUntransformedPreviewDescriptionIntern(subGenome, 0, lastReferenceAngle, parameters, cache);
+            result.separateConstruction = subGenome.info.separateConstruction;
+            if (cache && cache->numSubGenomeEntries < MaxCachedSubGenomes) {
+                cacheEntries->emplace_back(PreviewDescriptionCacheData::SubGenomeEntry{
+                    .genome = data, .lastReferenceAngle = lastReferenceAngle, .separateConstruction = result.separateConstruction, .preview = preview});
+                ++cache->numSubGenomeEntries;
+            }
+        }
+
+        for (auto& cell : preview.cellsIntern) {
+            cell.nodeIndex = uniformNodeIndex;
+        }
+        transform(preview, desiredEndPos, desiredEndAngle);
+        result.cellsIntern = std::move(preview.cellsIntern);
+        return result;
+    }
+
+    ProcessedGenomeDescriptionResult convertToUntransformedPreviewDescriptionIntern(
+        GenomeDescription const& genome,
+        std::optional<int> const& uniformNodeIndex,
+        std::optional<float> const& lastReferenceAngle,
+        SimulationParameters const& parameters,
+        PreviewDescriptionCacheData* cache)
     {
         if (genome.cells.empty()) {
             return {};
@@ -198,10 +298,13 @@ namespace
 
         ProcessedGenomeDescriptionResult processedGenome = processMainGenomeDescription(genome, uniformNodeIndex, lastReferenceAngle, parameters);
 
-        std::vector<CellPreviewDescriptionIntern> result = processedGenome.cellsIntern;
-
         //process sub genomes
-        size_t indexOffset = 0;
+        struct SubGenomePart
+        {
+            std::vector<CellPreviewDescriptionIntern> cellsIntern;
+            std::optional<int> connectedCellIndex;
+        };
+        std::vector<SubGenomePart> parts;
         int index = 0;
         for (auto const& [node, cellIntern] : boost::combine(genome.cells, processedGenome.cellsIntern)) {
             if (node.getCellFunctionType() == CellFunction_Constructor) {
@@ -210,17 +313,16 @@ namespace
                     ++index;
                     continue;
                 }
-                auto data = constructor.getGenomeData();
+                auto const& data = std::get<std::vector<uint8_t>>(constructor.genome);
                 if (data.size() <= Const::GenomeHeaderSize) {
                     ++index;
                     continue;
                 }
-                auto subGenome = GenomeDescriptionConverter::convertBytesToDescription(data);
 
                 //angles of connected cells
                 std::vector<float> angles;
                 for (auto const& connectedCellIndex : cellIntern.connectionIndices) {
-                    auto connectedCellIntern = processedGenome.cellsIntern.at(connectedCellIndex);
+                    auto const& connectedCellIntern = processedGenome.cellsIntern.at(connectedCellIndex);
                     angles.emplace_back(Math::angleOfVector(connectedCellIntern.pos - cellIntern.pos));
                 }
                 std::ranges::sort(angles);
@@ -247,28 +349,41 @@ namespace
                 }
                 targetAngle += constructor.constructionAngle1;
                 auto direction = Math::unitVectorOfAngle(targetAngle);
-                auto previewPart = convertToPreviewDescriptionIntern(
-                    subGenome, cellIntern.nodeIndex, constructor.constructionAngle2, cellIntern.pos + direction, targetAngle, parameters);
-                insert(result, previewPart);
-                indexOffset += previewPart.size();
-                if (!subGenome.info.separateConstruction) {
-                    auto cellIndex1 = previewPart.size() - 1;
-                    auto cellIndex2 = index + indexOffset;
-                    result.at(cellIndex1).connectionIndices.insert(toInt(cellIndex2));
-                    result.at(cellIndex2).connectionIndices.insert(toInt(cellIndex1));
-                }
+                auto previewPart = convertSubGenomeToPreviewDescriptionIntern(
+                    data, cellIntern.nodeIndex, constructor.constructionAngle2, cellIntern.pos + direction, targetAngle, parameters, cache);
+                parts.emplace_back(SubGenomePart{
+                    .cellsIntern = std::move(previewPart.cellsIntern),
+                    .connectedCellIndex = previewPart.separateConstruction ? std::nullopt : std::make_optional(index)});
             }
             ++index;
         }
 
-        //transform to desired position and angle
-        if (desiredEndAngle) {
-            auto actualEndAngle = Math::angleOfVector(processedGenome.direction);
-            auto angleDiff = Math::subtractAngle(*desiredEndAngle, actualEndAngle);
-            rotate(result, result.back().pos, angleDiff + 180.0f);
+        //subgenome parts are placed in reverse order in front of the main genome
+        ProcessedGenomeDescriptionResult result;
+        result.direction = processedGenome.direction;
+        auto numCells = processedGenome.cellsIntern.size();
+        for (auto const& part : parts) {
+            numCells += part.cellsIntern.size();
+        }
+        result.cellsIntern.reserve(numCells);
+        for (auto& part : parts | std::views::reverse) {
+            shiftConnectionIndices(part.cellsIntern, toInt(result.cellsIntern.size()));
+            result.cellsIntern.insert(result.cellsIntern.end(), std::make_move_iterator(part.cellsIntern.begin()), std::make_move_iterator(part.cellsIntern.end()));
         }
-        if (desiredEndPos) {
-            translate(result, *desiredEndPos - result.back().pos);
+        auto mainOffset = toInt(result.cellsIntern.size());
+        shiftConnectionIndices(processedGenome.cellsIntern, mainOffset);
+        result.cellsIntern.insert(
+            result.cellsIntern.end(), std::make_move_iterator(processedGenome.cellsIntern.begin()), std::make_move_iterator(processedGenome.cellsIntern.end()));
+
+        auto partEndIndex = mainOffset;
+        for (auto const& part : parts) {
+            if (part.connectedCellIndex) {
+                auto cellIndex1 = partEndIndex - 1;
+                auto cellIndex2 = *part.connectedCellIndex + mainOffset;
+                addConnectionIndex(result.cellsIntern.at(cellIndex1).connectionIndices, cellIndex2);
+                addConnectionIndex(result.cellsIntern.at(cellIndex2).connectionIndices, cellIndex1);
+            }
+            partEndIndex -= toInt(part.cellsIntern.size());
         }
         return result;
     }
@@ -276,14 +391,16 @@ namespace
     PreviewDescription createPreviewDescription(std::vector<CellPreviewDescriptionIntern> const& cells, SimulationParameters const& parameters)
     {
         PreviewDescription result;
-        std::map<std::pair<int, int>, int> cellIndicesToCreatedConnectionIndex;
+        std::unordered_map<uint64_t, int> cellIndicesToCreatedConnectionIndex;
+        cellIndicesToCreatedConnectionIndex.reserve(cells.size() * 2);
+        auto toKey = [](int cellIndex1, int cellIndex2) { return (static_cast<uint64_t>(cellIndex1) << 32) | static_cast<uint32_t>(cellIndex2); };
         int index = 0;
         for (auto const& cell : cells) {
             CellPreviewDescription cellPreview{.pos = cell.pos, .executionOrderNumber = cell.executionOrderNumber, .color = cell.color, .nodeIndex = cell.nodeIndex};
             result.cells.emplace_back(cellPreview);
             for (auto const& connectionIndex : cell.connectionIndices) {
                 auto const& otherCell = cells.at(connectionIndex);
-                auto findResult = cellIndicesToCreatedConnectionIndex.find(std::pair(index, connectionIndex));
+                auto findResult = cellIndicesToCreatedConnectionIndex.find(toKey(index, connectionIndex));
                 auto inputExecutionOrderNumber = cell.inputExecutionOrderNumber.value_or(-1);
                 if (findResult == cellIndicesToCreatedConnectionIndex.end()) {
                     ConnectionPreviewDescription connection;
@@ -292,7 +409,7 @@ namespace
                     connection.arrowToCell1 =
                         inputExecutionOrderNumber == otherCell.executionOrderNumber && !otherCell.outputBlocked && inputExecutionOrderNumber != cell.executionOrderNumber;
                     result.connections.emplace_back(connection);
-                    cellIndicesToCreatedConnectionIndex.emplace(std::pair(connectionIndex, index), toInt(result.connections.size() - 1));
+                    cellIndicesToCreatedConnectionIndex.emplace(toKey(connectionIndex, index), toInt(result.connections.size() - 1));
                 } else {
                     auto connectionIndex = findResult->second;
                     result.connections.at(connectionIndex).arrowToCell2 = inputExecutionOrderNumber == otherCell.executionOrderNumber
@@ -308,6 +425,38 @@ namespace
 PreviewDescription
 PreviewDescriptionConverter::convert(GenomeDescription const& genome, std::optional<int> selectedNode, SimulationParameters const& parameters)
 {
-    auto cellInternDescriptions = convertToPreviewDescriptionIntern(genome, std::nullopt, std::nullopt, std::nullopt, std::nullopt, parameters);
+    auto cellInternDescriptions = convertToUntransformedPreviewDescriptionIntern(genome, std::nullopt, std::nullopt, parameters, nullptr).cellsIntern;
     return createPreviewDescription(cellInternDescriptions, parameters);
 }
+
+PreviewDescriptionCache::PreviewDescriptionCache()
+    : _data(std::make_unique<PreviewDescriptionCacheData>())
+{}
+
+PreviewDescriptionCache::~PreviewDescriptionCache() = default;
+
+PreviewDescription const& PreviewDescriptionCache::getPreview(std::vector<uint8_t> const& genome, SimulationParameters const& parameters)
+{
+    std::vector<float> connectingCellMaxDistances(
+        std::begin(parameters.cellFunctionConstructorConnectingCellMaxDistance), std::end(parameters.cellFunctionConstructorConnectingCellMaxDistance));
+    if (connectingCellMaxDistances != _data->connectingCellMaxDistances || _data->numSubGenomeEntries >= MaxCachedSubGenomes) {
+        clear();
+        _data->connectingCellMaxDistances = connectingCellMaxDistances;
+    }
+
+    if (_data->genome != genome) {
+        auto genomeDesc = GenomeDescriptionConverter::convertBytesToDescription(genome);
+        auto cellInternDescriptions = convertToUntransformedPreviewDescriptionIntern(genomeDesc, std::nullopt, std::nullopt, parameters, _data.get()).cellsIntern;
+        _data->preview = createPreviewDescription(cellInternDescriptions, parameters);
+        _data->genome = genome;
+    }
+    return _data->preview;
+}
+
+void PreviewDescriptionCache::clear()
+{
+    _data->subGenomeEntriesByHash.clear();
+    _data->numSubGenomeEntries = 0;
+    _data->genome.reset();
+    _data->preview = PreviewDescription();
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "GenomeDescriptions.h"
 #include "SimulationParameters.h"
 #include "PreviewDescriptions.h"
@@ -11,3 +13,18 @@ public:
     static PreviewDescription convert(GenomeDescription const& genome, std::optional<int> selectedNode, SimulationParameters const& parameters);
 };
 
+struct PreviewDescriptionCacheData;
+
+//keeps the preview of the last genome and memoizes the previews of its subgenomes, so that only modified parts are converted again
+class PreviewDescriptionCache
+{
+public:
+    PreviewDescriptionCache();
+    ~PreviewDescriptionCache();
+
+    PreviewDescription const& getPreview(std::vector<uint8_t> const& genome, SimulationParameters const& parameters);
+    void clear();
+
+private:
+    std::unique_ptr<PreviewDescriptionCacheData> _data;
+};
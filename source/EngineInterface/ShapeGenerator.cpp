@@ -1,209 +1,102 @@
 #include "ShapeGenerator.h"
 
-class _SegmentGenerator : public _ShapeGenerator
-{
-public:
-    ShapeGeneratorResult generateNextConstructionData() override
-    {
-        ShapeGeneratorResult result;
-        result.angle = 0;
-        result.numRequiredAdditionalConnections = 0;
-        return result;
-    }
-
-    ConstructorAngleAlignment getConstructorAngleAlignment() override { return ConstructorAngleAlignment_60; }
-};
+#include <algorithm>
+#include <array>
 
-class _TriangleGenerator : public _ShapeGenerator
+namespace
 {
-public:
-    ShapeGeneratorResult generateNextConstructionData() override
+    //step-wise generation of the construction data (same sequences as in ShapeGenerator.cuh), only used to build the tables
+    class ShapeSequence
     {
-        ShapeGeneratorResult result;
-        auto edgeLength = std::max(2, _processedEdges + 1);
-        result.angle = _edgePos < edgeLength - 1 ? 0 : 120.0f;
-        if (_processedEdges == 0) {
-            result.numRequiredAdditionalConnections = 0;
-        } else if (_processedEdges == 1) {
-            result.numRequiredAdditionalConnections = _edgePos == 0 ? 1 : 0;
-        } else {
-            if (_edgePos == edgeLength - 1) {
-                result.numRequiredAdditionalConnections = 0;
-            } else if (_edgePos == edgeLength - 2) {
-                result.numRequiredAdditionalConnections = 1;
-            } else {
-                result.numRequiredAdditionalConnections = 2;
+    public:
+        constexpr ShapeSequence(ConstructionShape shape = ConstructionShape_Custom)
+            : _shape(shape)
+        {}
+
+        constexpr ShapeTableEntry generateNext()
+        {
+            switch (_shape) {
+            case ConstructionShape_Segment:
+                return generateNextForSegment();
+            case ConstructionShape_Triangle:
+                return generateNextForTriangle();
+            case ConstructionShape_Rectangle:
+                return generateNextForRectangle();
+            case ConstructionShape_Hexagon:
+                return generateNextForHexagon();
+            case ConstructionShape_Loop:
+                return generateNextForLoop();
+            case ConstructionShape_Tube:
+                return generateNextForTube();
+            case ConstructionShape_Lolli:
+                return generateNextForLolli();
+            case ConstructionShape_SmallLolli:
+                return generateNextForSmallLolli();
+            default:
+                return ShapeTableEntry();
             }
         }
-        if (++_edgePos == edgeLength) {
-            _edgePos = 0;
-            ++_processedEdges;
-        }
-        return result;
-    }
-
-    ConstructorAngleAlignment getConstructorAngleAlignment() override { return ConstructorAngleAlignment_60; }
-
-private:
-    int _edgePos = 0;
-    int _processedEdges = 0;
-};
 
-class _RectangleGenerator : public _ShapeGenerator
-{
-public:
-    ShapeGeneratorResult generateNextConstructionData() override
-    {
-        ShapeGeneratorResult result;
-        if (_processedEdges == 0) {
-            result.angle = 0.0f;
-            result.numRequiredAdditionalConnections = 0;
-        } else if (_processedEdges == 1) {
-            result.angle = 90.0f;
-            result.numRequiredAdditionalConnections = 0;
-        } else {
-            result.angle = _edgePos == 0 ? 90.0f : 0.0f;
-            result.numRequiredAdditionalConnections = _edgePos == 0 ? 0 : 1;
-        }
-
-        auto edgeLength = _processedEdges / 2;
-        if (++_edgePos > edgeLength) {
-            _edgePos = 0;
-            ++_processedEdges;
-        }
-        return result;
-    }
-
-    ConstructorAngleAlignment getConstructorAngleAlignment() override { return ConstructorAngleAlignment_90; }
-
-private:
-    int _edgePos = 0;
-    int _processedEdges = 0;
-};
-
-class _HexagonGenerator : public _ShapeGenerator
-{
-public:
-    ShapeGeneratorResult generateNextConstructionData() override
-    {
-        ShapeGeneratorResult result;
-
-        auto edgeLength = _processedEdges / 6 + 1;
-        if (_processedEdges % 6 == 1) {
-            --edgeLength;
-        }
-
-        if (_processedEdges < 2) {
-            result.angle = 120.0f;
-            result.numRequiredAdditionalConnections = 0;
-        } else if (_processedEdges < 6) {
-            result.angle = 60.0f;
-            result.numRequiredAdditionalConnections = 1;
-        } else {
-            result.angle = _edgePos < edgeLength - 1 ? 0.0f : 60.0f;
-            result.numRequiredAdditionalConnections = _edgePos < edgeLength - 1 ? 2 : 1;
-        }
-
-        if (++_edgePos >= edgeLength) {
-            _edgePos = 0;
-            ++_processedEdges;
-        }
-        return result;
-    }
-
-    ConstructorAngleAlignment getConstructorAngleAlignment() override { return ConstructorAngleAlignment_60; }
-
-private:
-    int _edgePos = 0;
-    int _processedEdges = 0;
-};
-
-class _LoopGenerator : public _ShapeGenerator
-{
-public:
-    ShapeGeneratorResult generateNextConstructionData() override
-    {
-        ShapeGeneratorResult result;
-
-        auto edgeLength = (_processedEdges + 1) / 6 + 1;
-        if (_processedEdges % 6 == 0) {
-            --edgeLength;
-        }
-
-        if (_processedEdges < 5) {
-            result.angle = 60.0f;
+    private:
+        constexpr ShapeTableEntry generateNextForSegment()
+        {
+            ShapeTableEntry result;
+            result.angle = 0;
             result.numRequiredAdditionalConnections = 0;
-        } else if (_processedEdges == 5) {
-            result.angle = _edgePos == 0 ? 0.0f : 60.0f;
-            result.numRequiredAdditionalConnections = 1;
-        } else {
-            result.angle = _edgePos < edgeLength - 1 ? 0.0f : 60.0f;
-            result.numRequiredAdditionalConnections = _edgePos < edgeLength - 1 ? 2 : 1;
+            return result;
         }
 
-        if (++_edgePos >= edgeLength) {
-            _edgePos = 0;
-            ++_processedEdges;
+        constexpr ShapeTableEntry generateNextForTriangle()
+        {
+            ShapeTableEntry result;
+            auto edgeLength = std::max(2, _processedEdges + 1);
+            result.angle = _edgePos < edgeLength - 1 ? 0 : 120.0f;
+            if (_processedEdges == 0) {
+                result.numRequiredAdditionalConnections = 0;
+            } else if (_processedEdges == 1) {
+                result.numRequiredAdditionalConnections = _edgePos == 0 ? 1 : 0;
+            } else {
+                if (_edgePos == edgeLength - 1) {
+                    result.numRequiredAdditionalConnections = 0;
+                } else if (_edgePos == edgeLength - 2) {
+                    result.numRequiredAdditionalConnections = 1;
+                } else {
+                    result.numRequiredAdditionalConnections = 2;
+                }
+            }
+            if (++_edgePos == edgeLength) {
+                _edgePos = 0;
+                ++_processedEdges;
+            }
+            return result;
         }
-        return result;
-    }
 
-    ConstructorAngleAlignment getConstructorAngleAlignment() override { return ConstructorAngleAlignment_60; }
-
-private:
-    int _edgePos = 0;
-    int _processedEdges = 0;
-};
+        constexpr ShapeTableEntry generateNextForRectangle()
+        {
+            ShapeTableEntry result;
+            if (_processedEdges == 0) {
+                result.angle = 0.0f;
+                result.numRequiredAdditionalConnections = 0;
+            } else if (_processedEdges == 1) {
+                result.angle = 90.0f;
+                result.numRequiredAdditionalConnections = 0;
+            } else {
+                result.angle = _edgePos == 0 ? 90.0f : 0.0f;
+                result.numRequiredAdditionalConnections = _edgePos == 0 ? 0 : 1;
+            }
 
-class _TubeGenerator : public _ShapeGenerator
-{
-public:
-    ShapeGeneratorResult generateNextConstructionData() override
-    {
-        ShapeGeneratorResult result;
-        if (_pos % 6 == 0) {
-            result.angle = 0;
-            result.numRequiredAdditionalConnections = 2;
-        }
-        if (_pos % 6 == 1) {
-            result.angle = 60.0f;
-            result.numRequiredAdditionalConnections = _pos == 1 ? 0 : 1;
-        }
-        if (_pos % 6 == 2) {
-            result.angle = 120.0f;
-            result.numRequiredAdditionalConnections = 0;
-        }
-        if (_pos % 6 == 3) {
-            result.angle = 0;
-            result.numRequiredAdditionalConnections = 2;
-        }
-        if (_pos % 6 == 4) {
-            result.angle = -120.0f;
-            result.numRequiredAdditionalConnections = _pos == 4 ? 1 : 2;
-        }
-        if (_pos % 6 == 5) {
-            result.angle = -60.0f;
-            result.numRequiredAdditionalConnections = 1;
+            auto edgeLength = _processedEdges / 2;
+            if (++_edgePos > edgeLength) {
+                _edgePos = 0;
+                ++_processedEdges;
+            }
+            return result;
         }
-        ++_pos;
 
-        return result;
-    }
-
-    ConstructorAngleAlignment getConstructorAngleAlignment() override { return ConstructorAngleAlignment_60; }
-
-private:
-    int _pos = 0;
-};
-
-class _LolliGenerator : public _ShapeGenerator
-{
-public:
-    ShapeGeneratorResult generateNextConstructionData() override
-    {
-        ShapeGeneratorResult result;
+        constexpr ShapeTableEntry generateNextForHexagon()
+        {
+            ShapeTableEntry result;
 
-        if (_processedEdges < 12 || _edgePos == 0) {
             auto edgeLength = _processedEdges / 6 + 1;
             if (_processedEdges % 6 == 1) {
                 --edgeLength;
@@ -224,80 +117,226 @@ public:
                 _edgePos = 0;
                 ++_processedEdges;
             }
-        } else {
-            result.angle = _edgePos == 1 ? -60.0f : 0.0f;
-            result.numRequiredAdditionalConnections = _edgePos == 1 ? 2 : 0;
-            ++_edgePos;
+            return result;
         }
-        return result;
-    }
 
-    ConstructorAngleAlignment getConstructorAngleAlignment() override { return ConstructorAngleAlignment_60; }
+        constexpr ShapeTableEntry generateNextForLoop()
+        {
+            ShapeTableEntry result;
 
-private:
-    int _edgePos = 0;
-    int _processedEdges = 0;
-};
-
-class _SmallLolliGenerator : public _ShapeGenerator
-{
-public:
-    ShapeGeneratorResult generateNextConstructionData() override
-    {
-        ShapeGeneratorResult result;
-
-        if (_processedEdges < 6) {
-            auto edgeLength = _processedEdges / 6 + 1;
-            if (_processedEdges % 6 == 1) {
+            auto edgeLength = (_processedEdges + 1) / 6 + 1;
+            if (_processedEdges % 6 == 0) {
                 --edgeLength;
             }
 
-            if (_processedEdges < 2) {
-                result.angle = 120.0f;
-                result.numRequiredAdditionalConnections = 0;
-            } else {
+            if (_processedEdges < 5) {
                 result.angle = 60.0f;
+                result.numRequiredAdditionalConnections = 0;
+            } else if (_processedEdges == 5) {
+                result.angle = _edgePos == 0 ? 0.0f : 60.0f;
                 result.numRequiredAdditionalConnections = 1;
+            } else {
+                result.angle = _edgePos < edgeLength - 1 ? 0.0f : 60.0f;
+                result.numRequiredAdditionalConnections = _edgePos < edgeLength - 1 ? 2 : 1;
             }
 
             if (++_edgePos >= edgeLength) {
                 _edgePos = 0;
                 ++_processedEdges;
             }
-        } else {
-            result.angle = _edgePos == 0 ? -60.0f : 0.0f;
-            result.numRequiredAdditionalConnections = _edgePos == 0 ? 2 : 0;
+            return result;
+        }
+
+        constexpr ShapeTableEntry generateNextForTube()
+        {
+            ShapeTableEntry result;
+            if (_edgePos % 6 == 0) {
+                result.angle = 0;
+                result.numRequiredAdditionalConnections = 2;
+            }
+            if (_edgePos % 6 == 1) {
+                result.angle = 60.0f;
+                result.numRequiredAdditionalConnections = _edgePos == 1 ? 0 : 1;
+            }
+            if (_edgePos % 6 == 2) {
+                result.angle = 120.0f;
+                result.numRequiredAdditionalConnections = 0;
+            }
+            if (_edgePos % 6 == 3) {
+                result.angle = 0;
+                result.numRequiredAdditionalConnections = 2;
+            }
+            if (_edgePos % 6 == 4) {
+                result.angle = -120.0f;
+                result.numRequiredAdditionalConnections = _edgePos == 4 ? 1 : 2;
+            }
+            if (_edgePos % 6 == 5) {
+                result.angle = -60.0f;
+                result.numRequiredAdditionalConnections = 1;
+            }
             ++_edgePos;
+
+            return result;
+        }
+
+        constexpr ShapeTableEntry generateNextForLolli()
+        {
+            ShapeTableEntry result;
+
+            if (_processedEdges < 12 || _edgePos == 0) {
+                auto edgeLength = _processedEdges / 6 + 1;
+                if (_processedEdges % 6 == 1) {
+                    --edgeLength;
+                }
+
+                if (_processedEdges < 2) {
+                    result.angle = 120.0f;
+                    result.numRequiredAdditionalConnections = 0;
+                } else if (_processedEdges < 6) {
+                    result.angle = 60.0f;
+                    result.numRequiredAdditionalConnections = 1;
+                } else {
+                    result.angle = _edgePos < edgeLength - 1 ? 0.0f : 60.0f;
+                    result.numRequiredAdditionalConnections = _edgePos < edgeLength - 1 ? 2 : 1;
+                }
+
+                if (++_edgePos >= edgeLength) {
+                    _edgePos = 0;
+                    ++_processedEdges;
+                }
+            } else {
+                result.angle = _edgePos == 1 ? -60.0f : 0.0f;
+                result.numRequiredAdditionalConnections = _edgePos == 1 ? 2 : 0;
+                ++_edgePos;
+            }
+            return result;
+        }
+
+        constexpr ShapeTableEntry generateNextForSmallLolli()
+        {
+            ShapeTableEntry result;
+
+            if (_processedEdges < 6) {
+                auto edgeLength = _processedEdges / 6 + 1;
+                if (_processedEdges % 6 == 1) {
+                    --edgeLength;
+                }
+
+                if (_processedEdges < 2) {
+                    result.angle = 120.0f;
+                    result.numRequiredAdditionalConnections = 0;
+                } else {
+                    result.angle = 60.0f;
+                    result.numRequiredAdditionalConnections = 1;
+                }
+
+                if (++_edgePos >= edgeLength) {
+                    _edgePos = 0;
+                    ++_processedEdges;
+                }
+            } else {
+                result.angle = _edgePos == 0 ? -60.0f : 0.0f;
+                result.numRequiredAdditionalConnections = _edgePos == 0 ? 2 : 0;
+                ++_edgePos;
+            }
+            return result;
+        }
+
+        ConstructionShape _shape = ConstructionShape_Custom;
+        int _edgePos = 0;
+        int _processedEdges = 0;
+    };
+
+    struct ShapeTable
+    {
+        std::array<ShapeTableEntry, ShapeTables::NumEntries> entries;
+        ShapeSequence continuation;     //state after the last table entry
+    };
+
+    constexpr std::array<ShapeTable, ConstructionShape_Count> createShapeTables()
+    {
+        std::array<ShapeTable, ConstructionShape_Count> result;
+        for (ConstructionShape shape = 0; shape < ConstructionShape_Count; ++shape) {
+            auto& table = result[shape];
+            table.continuation = ShapeSequence(shape);
+            for (auto& entry : table.entries) {
+                entry = table.continuation.generateNext();
+            }
         }
         return result;
     }
 
-    ConstructorAngleAlignment getConstructorAngleAlignment() override { return ConstructorAngleAlignment_60; }
+    constexpr auto Tables = createShapeTables();
+
+    constexpr std::array<ConstructorAngleAlignment, ConstructionShape_Count> AngleAlignments = {
+        ConstructorAngleAlignment_60,
+        ConstructorAngleAlignment_60,
+        ConstructorAngleAlignment_60,
+        ConstructorAngleAlignment_90,
+        ConstructorAngleAlignment_60,
+        ConstructorAngleAlignment_60,
+        ConstructorAngleAlignment_60,
+        ConstructorAngleAlignment_60,
+        ConstructorAngleAlignment_60};
+}
+
+ShapeTableEntry const& ShapeTables::getEntry(ConstructionShape shape, int nodeIndex)
+{
+    return Tables[shape].entries[nodeIndex];
+}
+
+ShapeGeneratorResult ShapeTables::getConstructionData(ConstructionShape shape, int nodeIndex)
+{
+    ShapeTableEntry entry;
+    if (nodeIndex < NumEntries) {
+        entry = getEntry(shape, nodeIndex);
+    } else {
+        auto sequence = Tables[shape].continuation;
+        for (int i = NumEntries; i <= nodeIndex; ++i) {
+            entry = sequence.generateNext();
+        }
+    }
+    return ShapeGeneratorResult{.angle = entry.angle, .numRequiredAdditionalConnections = entry.numRequiredAdditionalConnections};
+}
+
+ConstructorAngleAlignment ShapeTables::getConstructorAngleAlignment(ConstructionShape shape)
+{
+    return AngleAlignments[shape];
+}
 
-private:
-    int _edgePos = 0;
-    int _processedEdges = 0;
-};
+namespace
+{
+    class _TableShapeGenerator : public _ShapeGenerator
+    {
+    public:
+        _TableShapeGenerator(ConstructionShape shape)
+            : _shape(shape)
+            , _table(Tables[shape])
+        {}
+
+        ShapeGeneratorResult generateNextConstructionData() override
+        {
+            auto entry = _nodeIndex < ShapeTables::NumEntries ? _table.entries[_nodeIndex] : _continuation.generateNext();
+            if (++_nodeIndex == ShapeTables::NumEntries) {
+                _continuation = _table.continuation;
+            }
+            return ShapeGeneratorResult{.angle = entry.angle, .numRequiredAdditionalConnections = entry.numRequiredAdditionalConnections};
+        }
+
+        ConstructorAngleAlignment getConstructorAngleAlignment() override { return ShapeTables::getConstructorAngleAlignment(_shape); }
+
+    private:
+        ConstructionShape _shape;
+        ShapeTable const& _table;
+        int _nodeIndex = 0;
+        ShapeSequence _continuation;
+    };
+}
 
 ShapeGenerator ShapeGeneratorFactory::create(ConstructionShape shape)
 {
-    switch (shape) {
-    case ConstructionShape_Segment:
-        return std::make_shared<_SegmentGenerator>();
-    case ConstructionShape_Triangle:
-        return std::make_shared<_TriangleGenerator>();
-    case ConstructionShape_Rectangle:
-        return std::make_shared<_RectangleGenerator>();
-    case ConstructionShape_Hexagon:
-        return std::make_shared<_HexagonGenerator>();
-    case ConstructionShape_Loop:
-        return std::make_shared<_LoopGenerator>();
-    case ConstructionShape_Tube:
-        return std::make_shared<_TubeGenerator>();
-    case ConstructionShape_Lolli:
-        return std::make_shared<_LolliGenerator>();
-    case ConstructionShape_SmallLolli:
-        return std::make_shared<_SmallLolliGenerator>();
+    if (shape == ConstructionShape_Custom || shape < 0 || shape >= ConstructionShape_Count) {
+        return nullptr;
     }
-    return nullptr;
+    return std::make_shared<_TableShapeGenerator>(shape);
 }
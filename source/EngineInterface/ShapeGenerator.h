@@ -5,6 +5,8 @@
 
 #include "CellFunctionConstants.h"
 #include "Definitions.h"
+#include "FundamentalConstants.h"
+#include "GenomeConstants.h"
 
 struct ShapeGeneratorResult
 {
@@ -12,6 +14,26 @@ struct ShapeGeneratorResult
     std::optional<int> numRequiredAdditionalConnections;
 };
 
+struct ShapeTableEntry
+{
+    float angle = 0;
+    int numRequiredAdditionalConnections = 0;
+};
+
+//precomputed construction data for the predefined shapes indexed by node number
+class ShapeTables
+{
+public:
+    static auto constexpr NumEntries = (MAX_GENOME_BYTES - Const::GenomeHeaderSize) / Const::CellBasicBytes + 1;
+
+    //prerequisite: shape != ConstructionShape_Custom and nodeIndex < NumEntries
+    static ShapeTableEntry const& getEntry(ConstructionShape shape, int nodeIndex);
+
+    //prerequisite: shape != ConstructionShape_Custom, nodeIndex may exceed the table (slow path)
+    static ShapeGeneratorResult getConstructionData(ConstructionShape shape, int nodeIndex);
+    static ConstructorAngleAlignment getConstructorAngleAlignment(ConstructionShape shape);
+};
+
 class _ShapeGenerator
 {
 public:
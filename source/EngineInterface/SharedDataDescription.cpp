@@ -0,0 +1,103 @@
+#include "SharedDataDescription.h"
+
+#include <algorithm>
+#include <iterator>
+
+SharedDataDescription::SharedDataDescription(DataDescription data)
+    : _numCells(toInt(data.cells.size()))
+    , _numParticles(toInt(data.particles.size()))
+{
+    _cellBlocks = createBlocks(std::move(data.cells));
+    _particleBlocks = createBlocks(std::move(data.particles));
+}
+
+bool SharedDataDescription::isEmpty() const
+{
+    return _numCells == 0 && _numParticles == 0;
+}
+
+int SharedDataDescription::getNumCells() const
+{
+    return _numCells;
+}
+
+int SharedDataDescription::getNumParticles() const
+{
+    return _numParticles;
+}
+
+CellDescription const& SharedDataDescription::getCell(int index) const
+{
+    return (*_cellBlocks[index / BlockSize])[index % BlockSize];
+}
+
+ParticleDescription const& SharedDataDescription::getParticle(int index) const
+{
+    return (*_particleBlocks[index / BlockSize])[index % BlockSize];
+}
+
+CellDescription& SharedDataDescription::getCellRef(int index)
+{
+    return getMutableEntity(_cellBlocks, index);
+}
+
+ParticleDescription& SharedDataDescription::getParticleRef(int index)
+{
+    return getMutableEntity(_particleBlocks, index);
+}
+
+std::unordered_set<uint64_t> SharedDataDescription::getCellIds() const
+{
+    std::unordered_set<uint64_t> result;
+    result.reserve(_numCells);
+    for (auto const& block : _cellBlocks) {
+        for (auto const& cell : *block) {
+            result.insert(cell.id);
+        }
+    }
+    return result;
+}
+
+DataDescription SharedDataDescription::toDataDescription() const
+{
+    DataDescription result;
+    appendTo(result);
+    return result;
+}
+
+void SharedDataDescription::appendTo(DataDescription& data) const
+{
+    data.cells.reserve(data.cells.size() + _numCells);
+    for (auto const& block : _cellBlocks) {
+        data.cells.insert(data.cells.end(), block->begin(), block->end());
+    }
+    data.particles.reserve(data.particles.size() + _numParticles);
+    for (auto const& block : _particleBlocks) {
+        data.particles.insert(data.particles.end(), block->begin(), block->end());
+    }
+}
+
+template <typename T>
+std::vector<SharedDataDescription::Block<T>> SharedDataDescription::createBlocks(std::vector<T>&& entities)
+{
+    std::vector<Block<T>> result;
+    result.reserve((entities.size() + BlockSize - 1) / BlockSize);
+    for (size_t startIndex = 0; startIndex < entities.size(); startIndex += BlockSize) {
+        auto endIndex = std::min(entities.size(), startIndex + BlockSize);
+        result.emplace_back(std::make_shared<std::vector<T>>(
+            std::make_move_iterator(entities.begin() + startIndex), std::make_move_iterator(entities.begin() + endIndex)));
+    }
+    return result;
+}
+
+template <typename T>
+T& SharedDataDescription::getMutableEntity(std::vector<Block<T>>& blocks, int index)
+{
+    auto& block = blocks[index / BlockSize];
+    if (block.use_count() > 1) {
+        block = std::make_shared<std::vector<T>>(*block);
+    }
+
+    //the block is exclusively owned at this point and has been allocated as non-const vector
+    return const_cast<std::vector<T>&>(*block)[index % BlockSize];
+}
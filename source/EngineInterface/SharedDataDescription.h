@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "Descriptions.h"
+
+//copy-on-write representation of a DataDescription: cells and particles are held in immutable blocks which are shared between copies
+//a block is only cloned when one of its entities is accessed for modification
+class SharedDataDescription
+{
+public:
+    static auto constexpr BlockSize = 4096;
+
+    SharedDataDescription() = default;
+    explicit SharedDataDescription(DataDescription data);
+
+    bool isEmpty() const;
+    int getNumCells() const;
+    int getNumParticles() const;
+
+    CellDescription const& getCell(int index) const;
+    ParticleDescription const& getParticle(int index) const;
+
+    //block containing the entity is cloned if it is shared with other copies
+    CellDescription& getCellRef(int index);
+    ParticleDescription& getParticleRef(int index);
+
+    std::unordered_set<uint64_t> getCellIds() const;
+
+    DataDescription toDataDescription() const;
+    void appendTo(DataDescription& data) const;
+
+private:
+    template <typename T>
+    using Block = std::shared_ptr<std::vector<T> const>;
+
+    template <typename T>
+    static std::vector<Block<T>> createBlocks(std::vector<T>&& entities);
+
+    template <typename T>
+    static T& getMutableEntity(std::vector<Block<T>>& blocks, int index);
+
+    std::vector<Block<CellDescription>> _cellBlocks;
+    std::vector<Block<ParticleDescription>> _particleBlocks;
+    int _numCells = 0;
+    int _numParticles = 0;
+};
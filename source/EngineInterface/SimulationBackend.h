@@ -0,0 +1,14 @@
+#pragma once
+
+using SimulationBackend = int;
+enum SimulationBackend_
+{
+    SimulationBackend_Cuda,  //only available if built with the CUDA toolkit (ALIEN_CUDA)
+    SimulationBackend_Cpu  //partial: constructors, the other cell functions besides neurons, nerves and sensors, spots and rendering are not ported yet
+};
+
+#ifdef ALIEN_CUDA
+SimulationBackend constexpr DefaultSimulationBackend = SimulationBackend_Cuda;
+#else
+SimulationBackend constexpr DefaultSimulationBackend = SimulationBackend_Cpu;
+#endif
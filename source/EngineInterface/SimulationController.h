@@ -1,5 +1,6 @@
 #pragma once
 #include "Definitions.h"
+#include "GenomeAnalytics.h"
 #include "OverlayDescriptions.h"
 #include "SelectionShallowData.h"
 #include "Settings.h"
@@ -86,6 +87,9 @@ public:
     virtual IntVector2D getWorldSize() const = 0;
     virtual StatisticsData getStatistics() const = 0;
 
+    //groups all cells by their genomes and determines genome sizes, depths and near-identical genomes
+    virtual GenomeAnalyticsData getGenomeAnalytics() = 0;
+
     virtual std::optional<int> getTpsRestriction() const = 0;
     virtual void setTpsRestriction(std::optional<int> const& value) = 0;
 
@@ -1,10 +1,10 @@
 #pragma once
 
-#include <cuda_runtime.h>
 #include <stdint.h>
 
-#include "EngineInterface/FundamentalConstants.h"
-#include "EngineInterface/CellFunctionConstants.h"
+#include "FundamentalConstants.h"
+#include "CellFunctionConstants.h"
+#include "VectorTypes.h"
 
 struct ParticleTO
 {
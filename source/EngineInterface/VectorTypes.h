@@ -0,0 +1,18 @@
+#pragma once
+
+//float2 and int2 of the transfer objects: host-only code does not need the CUDA toolkit, the own definitions have the same layout
+#if __has_include(<vector_types.h>)
+#include <vector_types.h>
+#else
+struct alignas(8) float2
+{
+    float x;
+    float y;
+};
+
+struct alignas(8) int2
+{
+    int x;
+    int y;
+};
+#endif
@@ -0,0 +1,229 @@
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuCellProcessor.h"
+
+#include "CpuTestData.h"
+
+class CpuConnectionSolverTests : public ::testing::Test
+{
+public:
+    virtual ~CpuConnectionSolverTests() = default;
+
+protected:
+    std::mt19937 _randomEngine{42};
+
+    //square lattice on the whole torus with horizontal, vertical and some diagonal (triangular) connections
+    std::shared_ptr<CpuSimulationData> createData(int latticeSize, int numThreads = 0)
+    {
+        _randomEngine.seed(42);
+        auto result = std::make_shared<CpuSimulationData>(int2{latticeSize, latticeSize}, 0, numThreads);
+        result->parameters.cellMinDistance = 0.3f;
+
+        std::uniform_real_distribution<float> posDistribution(-0.2f, 0.2f);
+        std::uniform_real_distribution<float> velDistribution(-0.1f, 0.1f);
+        std::uniform_real_distribution<float> stiffnessDistribution(0.5f, 1.0f);
+        std::uniform_int_distribution<int> flagDistribution(0, 9);
+        for (int y = 0; y < latticeSize; ++y) {
+            for (int x = 0; x < latticeSize; ++x) {
+                CellTO cell{};
+                cell.id = y * latticeSize + x + 1;
+                cell.pos = {toFloat(x) + posDistribution(_randomEngine), toFloat(y) + posDistribution(_randomEngine)};
+                result->cellMap.correctPosition(cell.pos);
+                cell.vel = {velDistribution(_randomEngine), velDistribution(_randomEngine)};
+                cell.energy = 100;
+                cell.stiffness = stiffnessDistribution(_randomEngine);
+                cell.maxConnections = MAX_CELL_BONDS;
+                cell.barrier = flagDistribution(_randomEngine) == 0;
+                result->addCell(cell);
+            }
+        }
+
+        std::uniform_real_distribution<float> distanceDistribution(0.8f, 1.2f);
+        std::uniform_real_distribution<float> angleDistribution(60.0f, 120.0f);
+        auto connect = [&](int index1, int index2) {
+            auto& cell1 = result->cells[index1];
+            auto& cell2 = result->cells[index2];
+            auto distance = distanceDistribution(_randomEngine);
+            cell1.connections[cell1.numConnections++] = {index2, distance, angleDistribution(_randomEngine)};
+            cell2.connections[cell2.numConnections++] = {index1, distance, angleDistribution(_randomEngine)};
+        };
+        auto toIndex = [&](int x, int y) { return ((y + latticeSize) % latticeSize) * latticeSize + (x + latticeSize) % latticeSize; };
+        for (int y = 0; y < latticeSize; ++y) {
+            for (int x = 0; x < latticeSize; ++x) {
+                if (flagDistribution(_randomEngine) != 0) {
+                    connect(toIndex(x, y), toIndex(x + 1, y));
+                }
+                if (flagDistribution(_randomEngine) != 0) {
+                    connect(toIndex(x, y), toIndex(x, y + 1));
+                }
+                if (flagDistribution(_randomEngine) < 3) {
+                    connect(toIndex(x, y), toIndex(x + 1, y + 1));
+                }
+            }
+        }
+        result->prepareForNextTimestep();
+        return result;
+    }
+
+    //straightforward evaluation as in CellProcessor::calcConnectionForces with per-connection slots for the angle forces
+    std::vector<float2> calcExpectedForces(CpuSimulationData const& data, bool considerAngles) const
+    {
+        auto isConnectedTo = [](CellTO const& cell, int otherIndex) {
+            for (int i = 0; i < cell.numConnections; ++i) {
+                if (cell.connections[i].cellIndex == otherIndex) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        auto numCells = data.getNumCells();
+        std::vector<float2> result(data.cellForces.begin(), data.cellForces.end());
+        std::vector<float2> connectionForces(numCells * MAX_CELL_BONDS, float2{0, 0});
+        for (int index = 0; index < numCells; ++index) {
+            auto const& cell = data.cells[index];
+            if (0 == cell.numConnections || cell.barrier) {
+                continue;
+            }
+            float2 force{0, 0};
+            auto prevDisplacement = data.cellMap.getCorrectedDirection(data.cells[cell.connections[cell.numConnections - 1].cellIndex].pos - cell.pos);
+            auto cellStiffnessSquared = cell.stiffness * cell.stiffness;
+            auto numConnections = cell.numConnections;
+            for (int i = 0; i < numConnections; ++i) {
+                auto const& connectedCell = data.cells[cell.connections[i].cellIndex];
+                auto connectedCellStiffnessSquared = connectedCell.stiffness * connectedCell.stiffness;
+                auto displacement = data.cellMap.getCorrectedDirection(connectedCell.pos - cell.pos);
+                auto deviation = CpuMath::length(displacement) - cell.connections[i].distance;
+                force += CpuMath::normalized(displacement) * deviation * (cellStiffnessSquared + connectedCellStiffnessSquared) / 6;
+
+                auto lastIndex = (i + numConnections - 1) % numConnections;
+                if (considerAngles && (numConnections > 2 || (numConnections == 2 && i == 0))
+                    && !isConnectedTo(connectedCell, cell.connections[lastIndex].cellIndex)) {
+                    auto actualAngleFromPrevious =
+                        CpuMath::subtractAngle(CpuMath::angleOfVector(displacement), CpuMath::angleOfVector(prevDisplacement));
+                    auto referenceAngleFromPrevious = cell.connections[i].angleFromPrevious;
+                    auto strength = std::abs(referenceAngleFromPrevious - actualAngleFromPrevious) / 2000 * cellStiffnessSquared;
+                    auto force1 = CpuMath::rotateQuarterClockwise(
+                        CpuMath::normalized(displacement) / std::max(CpuMath::length(displacement), data.parameters.cellMinDistance) * strength);
+                    auto force2 = CpuMath::rotateQuarterCounterClockwise(
+                        CpuMath::normalized(prevDisplacement) / std::max(CpuMath::length(prevDisplacement), data.parameters.cellMinDistance) * strength);
+                    if (referenceAngleFromPrevious < actualAngleFromPrevious) {
+                        force1 = force1 * (-1);
+                        force2 = force2 * (-1);
+                    }
+                    connectionForces[index * MAX_CELL_BONDS + i] += force1;
+                    connectionForces[index * MAX_CELL_BONDS + lastIndex] += force2;
+                    force -= force1 + force2;
+                }
+                prevDisplacement = displacement;
+            }
+            result[index] += force;
+        }
+        for (int index = 0; index < numCells; ++index) {
+            auto const& cell = data.cells[index];
+            if (cell.barrier) {
+                continue;
+            }
+            for (int i = 0; i < cell.numConnections; ++i) {
+                auto connectedCellIndex = cell.connections[i].cellIndex;
+                auto const& connectedCell = data.cells[connectedCellIndex];
+                for (int j = 0; j < connectedCell.numConnections; ++j) {
+                    if (connectedCell.connections[j].cellIndex == index) {
+                        result[index] += connectionForces[connectedCellIndex * MAX_CELL_BONDS + j];
+                        break;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    bool approxCompare(float expected, float actual) const
+    {
+        return std::abs(expected - actual) <= 1.0e-4f + std::abs(expected) * 1.0e-4f;
+    }
+};
+
+TEST_F(CpuConnectionSolverTests, sameForcesAsStraightforwardEvaluation)
+{
+    for (auto considerAngles : {false, true}) {
+        auto data = createData(100);
+        auto expectedForces = calcExpectedForces(*data, considerAngles);
+
+        CpuCellProcessor::calcConnectionForces(*data, considerAngles);
+
+        for (int index = 0; index < data->getNumCells(); ++index) {
+            EXPECT_TRUE(approxCompare(expectedForces[index].x, data->cellForces[index].x));
+            EXPECT_TRUE(approxCompare(expectedForces[index].y, data->cellForces[index].y));
+        }
+    }
+}
+
+TEST_F(CpuConnectionSolverTests, sameIntegrationAsStraightforwardEvaluation)
+{
+    auto data = createData(100);
+    auto const& timestepSize = data->parameters.timestepSize;
+    auto expectedCells = data->cells;
+    auto forces = calcExpectedForces(*data, true);
+    std::vector<float2> prevForces(data->getNumCells(), float2{0, 0});
+    for (int index = 0; index < data->getNumCells(); ++index) {
+        auto& cell = expectedCells[index];
+        if (cell.barrier) {
+            cell.pos += cell.vel * timestepSize;
+        } else {
+            cell.pos += cell.vel * timestepSize + forces[index] * timestepSize * timestepSize / 2;
+        }
+        data->cellMap.correctPosition(cell.pos);
+    }
+
+    CpuCellProcessor::calcConnectionForces(*data, true);
+    CpuCellProcessor::verletPositionUpdate(*data);
+
+    for (int index = 0; index < data->getNumCells(); ++index) {
+        auto const& cell = data->cells[index];
+        EXPECT_TRUE(approxCompare(expectedCells[index].pos.x, cell.pos.x));
+        EXPECT_TRUE(approxCompare(expectedCells[index].pos.y, cell.pos.y));
+        if (!cell.barrier) {
+            EXPECT_TRUE(approxCompare(forces[index].x, data->cellPrevForces[index].x));
+            EXPECT_TRUE(approxCompare(forces[index].y, data->cellPrevForces[index].y));
+            prevForces[index] = data->cellPrevForces[index];
+        }
+    }
+
+    //the second force calculation of a time step works on the positions updated by the solver
+    auto newForces = calcExpectedForces(*data, true);
+    CpuCellProcessor::calcConnectionForces(*data, true);
+    CpuCellProcessor::verletVelocityUpdate(*data);
+
+    for (int index = 0; index < data->getNumCells(); ++index) {
+        auto const& cell = data->cells[index];
+        auto expectedVel = expectedCells[index].vel;
+        if (!cell.barrier) {
+            expectedVel += (newForces[index] + prevForces[index]) / 2 * timestepSize;
+        }
+        EXPECT_TRUE(approxCompare(expectedVel.x, cell.vel.x));
+        EXPECT_TRUE(approxCompare(expectedVel.y, cell.vel.y));
+    }
+    EXPECT_FALSE(data->connectionSolver.isPacked());
+}
+
+TEST_F(CpuConnectionSolverTests, independentOfNumberOfThreads)
+{
+    auto data1 = createData(150, 1);
+    auto data2 = createData(150, 4);
+
+    for (auto data : {data1, data2}) {
+        for (int i = 0; i < 3; ++i) {
+            data->prepareForNextTimestep();
+            CpuCellProcessor::calcConnectionForces(*data, true);
+            CpuCellProcessor::verletPositionUpdate(*data);
+            CpuCellProcessor::calcConnectionForces(*data, true);
+            CpuCellProcessor::verletVelocityUpdate(*data);
+        }
+    }
+
+    CpuTestData::checkSameCells(*data1, *data2);
+}
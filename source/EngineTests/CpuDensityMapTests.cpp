@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuDensityMap.h"
+#include "EngineCpuKernels/CpuMath.h"
+#include "EngineInterface/Colors.h"
+
+class CpuDensityMapTests : public ::testing::Test
+{
+public:
+    virtual ~CpuDensityMapTests() = default;
+
+protected:
+    static auto constexpr WorldSizeX = 300;  //not a multiple of the top level blocks
+    static auto constexpr WorldSizeY = 200;
+    static auto constexpr SlotSize = CpuDensityMap::DefaultSlotSize;
+
+    std::mt19937 _randomEngine{42};
+    ThreadPool _threadPool{4};
+
+    //clusters of cells with random colors, color 0 does not occur
+    std::vector<CellTO> createCells(int numClusters)
+    {
+        std::uniform_real_distribution<float> posXDistribution(0, toFloat(WorldSizeX));
+        std::uniform_real_distribution<float> posYDistribution(0, toFloat(WorldSizeY));
+        std::normal_distribution<float> clusterDistribution(0, 4.0f);
+        std::uniform_int_distribution<int> colorDistribution(1, MAX_COLORS - 1);
+        std::vector<CellTO> result;
+        for (int cluster = 0; cluster < numClusters; ++cluster) {
+            float2 center{posXDistribution(_randomEngine), posYDistribution(_randomEngine)};
+            auto color = colorDistribution(_randomEngine);
+            for (int i = 0; i < 100; ++i) {
+                CellTO cell{};
+                cell.pos = center + float2{clusterDistribution(_randomEngine), clusterDistribution(_randomEngine)};
+                cell.pos.x -= std::floor(cell.pos.x / WorldSizeX) * WorldSizeX;
+                cell.pos.y -= std::floor(cell.pos.y / WorldSizeY) * WorldSizeY;
+                cell.color = color;
+                result.emplace_back(cell);
+            }
+        }
+        return result;
+    }
+
+    CpuDensityMap createDensityMap(std::vector<CellTO> const& cells)
+    {
+        CpuDensityMap result;
+        result.init({WorldSizeX, WorldSizeY});
+        result.update(cells, std::vector<uint8_t>(cells.size(), 0), _threadPool);
+        return result;
+    }
+
+    static float2 getSlotCenter(int x, int y) { return {toFloat(x * SlotSize + SlotSize / 2), toFloat(y * SlotSize + SlotSize / 2)}; }
+
+    static float calcPeriodicDistance(float value, float start, float end, float period)
+    {
+        auto result = std::numeric_limits<float>::max();
+        for (auto shift : {-period, 0.0f, period}) {
+            result = std::min(result, std::max({start + shift - value, value - end - shift, 0.0f}));
+        }
+        return result;
+    }
+
+    static float calcDistance(float2 const& pos, float2 const& regionStart, float2 const& regionEnd)
+    {
+        auto distanceX = calcPeriodicDistance(pos.x, regionStart.x, regionEnd.x, toFloat(WorldSizeX));
+        auto distanceY = calcPeriodicDistance(pos.y, regionStart.y, regionEnd.y, toFloat(WorldSizeY));
+        return std::sqrt(distanceX * distanceX + distanceY * distanceY);
+    }
+};
+
+TEST_F(CpuDensityMapTests, countsSaturatePerColor)
+{
+    std::vector<CellTO> cells;
+    for (int i = 0; i < 300; ++i) {
+        CellTO cell{};
+        cell.pos = {10.5f, 20.5f};
+        cell.color = 2;
+        cells.emplace_back(cell);
+    }
+    for (int i = 0; i < 5; ++i) {
+        CellTO cell{};
+        cell.pos = {10.5f, 20.5f};
+        cell.color = 3;
+        cells.emplace_back(cell);
+    }
+    auto densityMap = createDensityMap(cells);
+
+    EXPECT_EQ(CpuDensityMap::MaxDensity, densityMap.getDensity({10.5f, 20.5f}, 2));
+    EXPECT_EQ(5, densityMap.getDensity({10.5f, 20.5f}, 3));
+    EXPECT_EQ(0, densityMap.getDensity({10.5f, 20.5f}, 1));
+    EXPECT_EQ(0, densityMap.getDensity({10.5f, 20.5f}, 4));
+    for (int levelIndex = 0; levelIndex < CpuDensityMap::NumLevels; ++levelIndex) {
+        EXPECT_EQ(CpuDensityMap::MaxDensity, densityMap.getBlockDensity({10.5f, 20.5f}, 2, levelIndex));
+        EXPECT_EQ(5, densityMap.getBlockDensity({10.5f, 20.5f}, 3, levelIndex));
+    }
+}
+
+TEST_F(CpuDensityMapTests, levelsContainSaturatedSumsOfSlots)
+{
+    auto densityMap = createDensityMap(createCells(30));
+    auto numSlotsX = WorldSizeX / SlotSize;
+    auto numSlotsY = WorldSizeY / SlotSize;
+    for (int levelIndex = 0; levelIndex < CpuDensityMap::NumLevels; ++levelIndex) {
+        auto blockSize = 1 << levelIndex;
+        for (int y = 0; y < numSlotsY; y += blockSize) {
+            for (int x = 0; x < numSlotsX; x += blockSize) {
+                for (int color = 0; color < MAX_COLORS; ++color) {
+                    uint32_t sum = 0;
+                    for (int slotY = y; slotY < std::min(y + blockSize, numSlotsY); ++slotY) {
+                        for (int slotX = x; slotX < std::min(x + blockSize, numSlotsX); ++slotX) {
+                            sum += densityMap.getDensity(getSlotCenter(slotX, slotY), color);
+                        }
+                    }
+                    auto expectedDensity = std::min(sum, static_cast<uint32_t>(CpuDensityMap::MaxDensity));
+                    ASSERT_EQ(expectedDensity, densityMap.getBlockDensity(getSlotCenter(x, y), color, levelIndex));
+                }
+            }
+        }
+    }
+}
+
+TEST_F(CpuDensityMapTests, nearestNonEmptyRegionMatchesSlotSearch)
+{
+    auto densityMap = createDensityMap(createCells(10));
+    auto numSlotsX = WorldSizeX / SlotSize;
+    auto numSlotsY = WorldSizeY / SlotSize;
+    std::uniform_real_distribution<float> posXDistribution(0, toFloat(WorldSizeX));
+    std::uniform_real_distribution<float> posYDistribution(0, toFloat(WorldSizeY));
+    int numFound = 0;
+    for (int i = 0; i < 2000; ++i) {
+        float2 pos{posXDistribution(_randomEngine), posYDistribution(_randomEngine)};
+        for (int color = 0; color < MAX_COLORS; ++color) {
+            for (auto maxDistance : {30.0f, 100.0f, 1000.0f}) {
+                auto minDistance = std::numeric_limits<float>::max();
+                for (int y = 0; y < numSlotsY; ++y) {
+                    for (int x = 0; x < numSlotsX; ++x) {
+                        if (densityMap.getDensity(getSlotCenter(x, y), color) > 0) {
+                            float2 slotStart{toFloat(x * SlotSize), toFloat(y * SlotSize)};
+                            float2 slotEnd = slotStart + float2{toFloat(SlotSize), toFloat(SlotSize)};
+                            minDistance = std::min(minDistance, calcDistance(pos, slotStart, slotEnd));
+                        }
+                    }
+                }
+
+                float2 regionStart;
+                float2 regionEnd;
+                auto found = densityMap.findNearestNonEmptyRegion(pos, color, maxDistance, regionStart, regionEnd);
+                ASSERT_EQ(minDistance <= maxDistance, found);
+                if (found) {
+                    ASSERT_EQ(toFloat(SlotSize), regionEnd.x - regionStart.x);
+                    ASSERT_EQ(toFloat(SlotSize), regionEnd.y - regionStart.y);
+                    ASSERT_LT(0, densityMap.getDensity(regionStart + float2{SlotSize / 2.0f, SlotSize / 2.0f}, color));
+                    ASSERT_NEAR(minDistance, calcDistance(pos, regionStart, regionEnd), 1e-3f);
+                    ++numFound;
+                }
+            }
+        }
+    }
+    EXPECT_LT(0, numFound);
+
+    float2 regionStart;
+    float2 regionEnd;
+    EXPECT_FALSE(densityMap.findNearestNonEmptyRegion({10.0f, 10.0f}, 0, 1000.0f, regionStart, regionEnd));
+}
+
+TEST_F(CpuDensityMapTests, nearestNonEmptyRegionAcrossWorldBoundary)
+{
+    CellTO cell{};
+    cell.pos = {WorldSizeX - 10.0f, 100.0f};
+    cell.color = 1;
+    auto densityMap = createDensityMap({cell});
+
+    float2 regionStart;
+    float2 regionEnd;
+    ASSERT_TRUE(densityMap.findNearestNonEmptyRegion({2.0f, 100.0f}, 1, 20.0f, regionStart, regionEnd));
+    EXPECT_EQ(toFloat((WorldSizeX / SlotSize - 1) * SlotSize), regionStart.x);
+    EXPECT_FALSE(densityMap.findNearestNonEmptyRegion({150.0f, 100.0f}, 1, 20.0f, regionStart, regionEnd));
+}
@@ -0,0 +1,202 @@
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuCellProcessor.h"
+
+#include "CpuTestData.h"
+
+class CpuFluidForcesTests : public ::testing::Test
+{
+public:
+    virtual ~CpuFluidForcesTests() = default;
+
+protected:
+    struct ExpectedResult
+    {
+        std::vector<float2> forces;
+        std::vector<float2> posCorrections;
+        std::vector<float> densities;
+    };
+
+    std::mt19937 _randomEngine{42};
+
+    std::shared_ptr<CpuSimulationData> createData(int numCells, int worldSize, float smoothingLength, int numThreads = 0)
+    {
+        std::uniform_real_distribution<float> velDistribution(-0.5f, 0.5f);
+        std::uniform_real_distribution<float> densityDistribution(0.2f, 2.0f);
+        std::uniform_int_distribution<int> flagDistribution(0, 9);
+        auto cells = CpuTestData::createCells(_randomEngine, {worldSize, worldSize}, numCells, [&](CellTO& cell) {
+            cell.vel = {velDistribution(_randomEngine), velDistribution(_randomEngine)};
+            cell.maxConnections = 6;
+            cell.barrier = flagDistribution(_randomEngine) == 0;
+        });
+        auto result = CpuTestData::createData({worldSize, worldSize}, cells, numThreads);
+        result->parameters.motionType = MotionType_Fluid;
+        result->parameters.motionData.fluidMotion = FluidMotion();
+        result->parameters.motionData.fluidMotion.smoothingLength = smoothingLength;
+        for (int index = 0; index < numCells; ++index) {
+            result->cellDetached[index] = flagDistribution(_randomEngine) == 0 ? 1 : 0;
+            result->cellDensities[index] = densityDistribution(_randomEngine);
+        }
+
+        //connect some neighboring cells
+        result->cellMap.update(result->cells, result->cellDetached, result->cellRemoved);
+        for (int index = 0; index < numCells; index += 3) {
+            auto& cell = result->cells[index];
+            result->cellMap.executeForEach(cell.pos, 1.0f, result->cellDetached[index], [&](int otherIndex) {
+                auto& otherCell = result->cells[otherIndex];
+                if (otherIndex != index && cell.numConnections < 2 && otherCell.numConnections < 2) {
+                    cell.connections[cell.numConnections++] = {otherIndex, 1.0f, 180.0f};
+                    otherCell.connections[otherCell.numConnections++] = {index, 1.0f, 180.0f};
+                }
+            });
+        }
+        return result;
+    }
+
+    //straightforward evaluation as in CellProcessor::calcFluidForces_reconnectCells_correctOverlap
+    ExpectedResult calcExpectedResult(CpuSimulationData const& data) const
+    {
+        auto const& parameters = data.parameters;
+        auto const& fluidMotion = parameters.motionData.fluidMotion;
+        auto h = fluidMotion.smoothingLength;
+        auto calcKernel = [](float q) {
+            auto result = q < 1 ? 2.0f / 3.0f - q * q + 0.5f * q * q * q : (q < 2 ? (2.0f - q) * (2.0f - q) * (2.0f - q) / 6 : 0.0f);
+            return result * 3.0f / (2.0f * Const::Pi);
+        };
+        auto calcKernel_d = [](float q) {
+            auto result = q < 1 ? -2 * q + 3.0f / 2.0f * q * q : (q < 2 ? -0.5f * (2.0f - q) * (2.0f - q) : 0.0f);
+            return result * 3.0f / (2.0f * Const::Pi);
+        };
+
+        ExpectedResult result;
+        for (int index = 0; index < data.getNumCells(); ++index) {
+            auto const& cell = data.cells[index];
+            float2 F_pressure{0, 0};
+            float2 F_viscosity{0, 0};
+            float2 F_boundary{0, 0};
+            float2 cellPosDelta{0, 0};
+            float density = 0;
+            for (int otherIndex = 0; otherIndex < data.getNumCells(); ++otherIndex) {
+                auto const& otherCell = data.cells[otherIndex];
+                auto posDelta = data.cellMap.getCorrectedDirection(cell.pos - otherCell.pos);
+                auto distance = CpuMath::length(posDelta);
+                if (distance > h * 2 || data.cellDetached[index] + data.cellDetached[otherIndex] == 1) {
+                    continue;
+                }
+                density += calcKernel(distance / h) / (h * h);
+                if (index == otherIndex) {
+                    continue;
+                }
+                if (!cell.barrier && distance < parameters.cellMinDistance) {
+                    cellPosDelta += posDelta * parameters.cellMinDistance / 5;
+                }
+                bool isConnected = false;
+                for (int i = 0; i < cell.numConnections; ++i) {
+                    isConnected |= cell.connections[i].cellIndex == otherIndex;
+                }
+                if (isConnected) {
+                    continue;
+                }
+                auto velDelta = cell.vel - otherCell.vel;
+                auto cellDensity = data.cellDensities[index];
+                auto otherCellDensity = data.cellDensities[otherIndex];
+                if (!otherCell.barrier) {
+                    auto factor = cellDensity / (cellDensity * cellDensity) + otherCellDensity / (otherCellDensity * otherCellDensity);
+                    if (std::abs(distance) > NEAR_ZERO) {
+                        auto kernel_d = calcKernel_d(distance / h) / (h * h * h);
+                        F_pressure += posDelta / (-distance) * factor * kernel_d;
+                        F_viscosity += velDelta / otherCellDensity * distance * kernel_d / (distance * distance + 0.25f);
+                    }
+                } else {
+                    F_boundary += posDelta * CpuMath::dot(velDelta, posDelta) / (-distance * distance - 0.5f) * 2;
+                }
+            }
+            result.forces.emplace_back(F_pressure * fluidMotion.pressureStrength + F_viscosity * fluidMotion.viscosityStrength + F_boundary);
+            result.posCorrections.emplace_back(cellPosDelta);
+            result.densities.emplace_back(density);
+        }
+        return result;
+    }
+
+    void calcFluidForces(CpuSimulationData& data) const
+    {
+        data.prepareForNextTimestep();
+        CpuCellProcessor::updateMap(data);
+        CpuCellProcessor::fluidForces(data);
+    }
+
+    bool approxCompare(float expected, float actual) const
+    {
+        return std::abs(expected - actual) <= 1.0e-4f + std::abs(expected) * 1.0e-4f;
+    }
+};
+
+TEST_F(CpuFluidForcesTests, sameForcesAsStraightforwardEvaluation)
+{
+    for (auto smoothingLength : {0.5f, 0.8f, 1.5f}) {
+        auto data = createData(2000, 50, smoothingLength);
+        data->cellMap.update(data->cells, data->cellDetached, data->cellRemoved);
+        auto expected = calcExpectedResult(*data);
+        auto origPositions = std::vector<float2>();
+        for (auto const& cell : data->cells) {
+            origPositions.emplace_back(cell.pos);
+        }
+
+        calcFluidForces(*data);
+
+        for (int index = 0; index < data->getNumCells(); ++index) {
+            EXPECT_TRUE(approxCompare(expected.forces[index].x, data->cellForces[index].x));
+            EXPECT_TRUE(approxCompare(expected.forces[index].y, data->cellForces[index].y));
+            EXPECT_TRUE(approxCompare(expected.densities[index], data->cellDensities[index]));
+
+            auto posDelta = data->cellMap.getCorrectedDirection(data->cells[index].pos - origPositions[index]);
+            EXPECT_TRUE(approxCompare(expected.posCorrections[index].x, posDelta.x));
+            EXPECT_TRUE(approxCompare(expected.posCorrections[index].y, posDelta.y));
+        }
+    }
+}
+
+TEST_F(CpuFluidForcesTests, fusionScheduledOncePerPair)
+{
+    auto data = std::make_shared<CpuSimulationData>(int2{20, 20}, 0);
+    data->parameters.motionType = MotionType_Fluid;
+    data->parameters.motionData.fluidMotion = FluidMotion();
+    data->parameters.baseValues.cellFusionVelocity = 0.2f;
+    CellTO cell{};
+    cell.energy = 100;
+    cell.maxConnections = 6;
+    cell.pos = {10.0f, 10.0f};
+    cell.vel = {0.2f, 0};
+    data->addCell(cell);
+    cell.pos = {11.0f, 10.0f};
+    cell.vel = {-0.2f, 0};
+    data->addCell(cell);
+
+    calcFluidForces(*data);
+
+    //counted before merging since the merge would also remove a second scheduling of the pair
+    ASSERT_EQ(1, data->structuralOperations.getNumScheduledOperations());
+    auto const& operations = data->structuralOperations.merge();
+    ASSERT_EQ(1, operations.size());
+    EXPECT_EQ(CpuStructuralOperation::Type::AddConnectionPair, operations.front().type);
+}
+
+TEST_F(CpuFluidForcesTests, independentOfNumberOfThreads)
+{
+    auto data1 = createData(5000, 60, 0.8f, 1);
+    _randomEngine.seed(42);
+    auto data2 = createData(5000, 60, 0.8f, 4);
+
+    calcFluidForces(*data1);
+    calcFluidForces(*data2);
+
+    CpuTestData::checkSameCells(*data1, *data2);
+    for (int index = 0; index < data1->getNumCells(); ++index) {
+        EXPECT_EQ(data1->cellForces[index].x, data2->cellForces[index].x);
+        EXPECT_EQ(data1->cellForces[index].y, data2->cellForces[index].y);
+        EXPECT_EQ(data1->cellDensities[index], data2->cellDensities[index]);
+    }
+}
@@ -0,0 +1,236 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuGarbageCollector.h"
+
+#include "CpuTestData.h"
+
+class CpuGarbageCollectorTests : public ::testing::Test
+{
+public:
+    virtual ~CpuGarbageCollectorTests() = default;
+
+protected:
+    static auto constexpr WorldSize = 100;
+
+    std::mt19937 _randomEngine{42};
+
+    //chain of constructor cells where each cell carries a genome of its own id
+    std::shared_ptr<CpuSimulationData> createData(int numCells, int numThreads)
+    {
+        _randomEngine.seed(42);
+        auto result = CpuTestData::createData({WorldSize, WorldSize}, CpuTestData::createCells(_randomEngine, {WorldSize, WorldSize}, numCells), numThreads);
+        for (int index = 0; index < numCells; ++index) {
+            auto& cell = result->cells[index];
+            cell.cellFunction = CellFunction_Constructor;
+            auto genome = createGenome(cell.id);
+            cell.cellFunctionData.constructor.genomeDataIndex = result->addAuxiliaryData(genome.data(), genome.size());
+            cell.cellFunctionData.constructor.genomeSize = genome.size();
+            if (index > 0) {
+                cell.connections[cell.numConnections++] = ConnectionTO{index - 1, 1.0f, 0};
+            }
+            if (index < numCells - 1) {
+                cell.connections[cell.numConnections++] = ConnectionTO{index + 1, 1.0f, 180.0f};
+            }
+        }
+        //the genomes of the first quarter are moved such that their original data becomes garbage
+        for (int i = 0; i < numCells / 4; ++i) {
+            CpuSimulationData::forEachAuxiliaryDataReference(result->cells[i], [&](uint64_t& dataIndex, uint64_t size) {
+                dataIndex = result->addAuxiliaryData(result->auxiliaryData.data() + dataIndex, size);
+            });
+        }
+        return result;
+    }
+
+    std::vector<uint8_t> createGenome(uint64_t id) const
+    {
+        std::vector<uint8_t> result(id % 7 + 1);
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = static_cast<uint8_t>(id + i);
+        }
+        return result;
+    }
+
+    //removes every third cell together with its connections
+    void removeCells(CpuSimulationData& data) const
+    {
+        for (int index = 0; index < data.getNumCells(); index += 3) {
+            data.cellRemoved[index] = 1;
+        }
+        removeConnectionsToRemovedCells(data);
+    }
+
+    void removeConnectionsToRemovedCells(CpuSimulationData& data) const
+    {
+        for (int index = 0; index < data.getNumCells(); ++index) {
+            auto& cell = data.cells[index];
+            int numConnections = 0;
+            for (int i = 0; i < cell.numConnections; ++i) {
+                if (!data.cellRemoved[cell.connections[i].cellIndex]) {
+                    cell.connections[numConnections++] = cell.connections[i];
+                }
+            }
+            cell.numConnections = numConnections;
+        }
+    }
+
+    void checkConnections(CpuSimulationData const& data) const
+    {
+        for (auto const& cell : data.cells) {
+            for (int i = 0; i < cell.numConnections; ++i) {
+                auto const& otherCell = data.cells[cell.connections[i].cellIndex];
+                EXPECT_EQ(1, std::abs(static_cast<int64_t>(cell.id) - static_cast<int64_t>(otherCell.id)));
+            }
+        }
+    }
+
+    void checkGenomes(CpuSimulationData const& data) const
+    {
+        for (auto const& cell : data.cells) {
+            auto const& constructor = cell.cellFunctionData.constructor;
+            auto expectedGenome = createGenome(cell.id);
+            ASSERT_EQ(expectedGenome.size(), constructor.genomeSize);
+            ASSERT_LE(constructor.genomeDataIndex + constructor.genomeSize, data.auxiliaryData.size());
+            for (size_t i = 0; i < expectedGenome.size(); ++i) {
+                EXPECT_EQ(expectedGenome[i], data.auxiliaryData[constructor.genomeDataIndex + i]);
+            }
+        }
+    }
+};
+
+TEST_F(CpuGarbageCollectorTests, compactionPreservesOrderAndConnections)
+{
+    auto data = createData(10000, 4);
+    data->spatialOrderInterval = 0;
+    removeCells(*data);
+    ASSERT_FALSE(CpuGarbageCollector::isFullCleanupNecessary(*data));
+    auto numAuxiliaryDataBytes = data->auxiliaryData.size();
+
+    CpuGarbageCollector::cleanupAfterTimestep(*data);
+
+    ASSERT_EQ(6666, data->getNumCells());
+    EXPECT_EQ(6666, data->cellRemoved.size());
+    EXPECT_EQ(6666, data->cellDetached.size());
+    for (int index = 0; index < data->getNumCells(); ++index) {
+        EXPECT_EQ(index / 2 * 3 + index % 2 + 2, data->cells[index].id);
+    }
+    checkConnections(*data);
+    checkGenomes(*data);
+    EXPECT_EQ(numAuxiliaryDataBytes, data->auxiliaryData.size());
+}
+
+TEST_F(CpuGarbageCollectorTests, fullCleanupRelocatesAuxiliaryData)
+{
+    auto data = createData(10000, 4);
+    uint64_t numUsedBytes = 0;
+    for (auto const& cell : data->cells) {
+        numUsedBytes += cell.cellFunctionData.constructor.genomeSize;
+    }
+    EXPECT_FALSE(CpuGarbageCollector::isFullCleanupNecessary(*data));
+    removeCells(*data);
+
+    CpuGarbageCollector::cleanupAfterDataManipulation(*data);
+
+    uint64_t numRemainingBytes = 0;
+    for (auto const& cell : data->cells) {
+        numRemainingBytes += cell.cellFunctionData.constructor.genomeSize;
+    }
+    EXPECT_LT(numRemainingBytes, numUsedBytes);
+    EXPECT_EQ(numRemainingBytes, data->auxiliaryData.size());
+    checkConnections(*data);
+    checkGenomes(*data);
+}
+
+TEST_F(CpuGarbageCollectorTests, fullCleanupTriggeredByFragmentation)
+{
+    auto data = createData(1000, 1);
+    for (int index = 0; index < data->getNumCells(); ++index) {
+        data->cellRemoved[index] = index % 10 != 0 ? 1 : 0;
+    }
+    removeConnectionsToRemovedCells(*data);
+    EXPECT_TRUE(CpuGarbageCollector::isFullCleanupNecessary(*data));
+
+    CpuGarbageCollector::cleanupAfterTimestep(*data);
+
+    EXPECT_EQ(100, data->getNumCells());
+    EXPECT_FALSE(CpuGarbageCollector::isFullCleanupNecessary(*data));
+    checkGenomes(*data);
+}
+
+TEST_F(CpuGarbageCollectorTests, fullCleanupSortsAlongMortonCurve)
+{
+    auto data = createData(10000, 4);
+
+    CpuGarbageCollector::cleanupAfterDataManipulation(*data);
+
+    for (int index = 1; index < data->getNumCells(); ++index) {
+        EXPECT_LE(CpuGarbageCollector::getMortonCode(data->cells[index - 1].pos), CpuGarbageCollector::getMortonCode(data->cells[index].pos));
+    }
+    checkConnections(*data);
+    checkGenomes(*data);
+}
+
+TEST_F(CpuGarbageCollectorTests, scheduledSpatialOrderIncludesParticles)
+{
+    auto data = createData(1000, 4);
+    data->spatialOrderInterval = 10;
+    data->timestep = 20;
+    std::uniform_real_distribution<float> posDistribution(0, toFloat(WorldSize));
+    for (int i = 0; i < 5000; ++i) {
+        ParticleTO particle{};
+        particle.id = i + 1;
+        particle.pos = {posDistribution(_randomEngine), posDistribution(_randomEngine)};
+        data->addParticle(particle);
+        data->particleLastAbsorbedCellIds.back() = particle.id;
+        data->particleRemoved.back() = i % 4 == 0 ? 1 : 0;
+    }
+    ASSERT_FALSE(CpuGarbageCollector::isFullCleanupNecessary(*data));
+    ASSERT_TRUE(CpuGarbageCollector::isSpatialOrderScheduled(*data));
+
+    CpuGarbageCollector::cleanupAfterTimestep(*data);
+
+    ASSERT_EQ(3750, data->getNumParticles());
+    for (int index = 0; index < data->getNumParticles(); ++index) {
+        auto const& particle = data->particles[index];
+        EXPECT_NE(0, (particle.id - 1) % 4);
+        EXPECT_EQ(particle.id, data->particleLastAbsorbedCellIds[index]);
+        if (index > 0) {
+            EXPECT_LE(CpuGarbageCollector::getMortonCode(data->particles[index - 1].pos), CpuGarbageCollector::getMortonCode(particle.pos));
+        }
+    }
+    for (int index = 1; index < data->getNumCells(); ++index) {
+        EXPECT_LE(CpuGarbageCollector::getMortonCode(data->cells[index - 1].pos), CpuGarbageCollector::getMortonCode(data->cells[index].pos));
+    }
+    checkConnections(*data);
+    checkGenomes(*data);
+
+    ++data->timestep;
+    EXPECT_FALSE(CpuGarbageCollector::isSpatialOrderScheduled(*data));
+}
+
+TEST_F(CpuGarbageCollectorTests, mortonCodeInterleavesCoordinates)
+{
+    EXPECT_EQ(0, CpuGarbageCollector::getMortonCode({0.5f, 0.5f}));
+    EXPECT_EQ(1, CpuGarbageCollector::getMortonCode({1.5f, 0.5f}));
+    EXPECT_EQ(2, CpuGarbageCollector::getMortonCode({0.5f, 1.5f}));
+    EXPECT_EQ(3, CpuGarbageCollector::getMortonCode({1.5f, 1.5f}));
+    EXPECT_EQ(0b110000, CpuGarbageCollector::getMortonCode({4.0f, 4.0f}));
+}
+
+TEST_F(CpuGarbageCollectorTests, independentOfNumberOfThreads)
+{
+    auto data1 = createData(20000, 1);
+    auto data2 = createData(20000, 8);
+    removeCells(*data1);
+    removeCells(*data2);
+
+    CpuGarbageCollector::cleanupAfterDataManipulation(*data1);
+    CpuGarbageCollector::cleanupAfterDataManipulation(*data2);
+
+    CpuTestData::checkSameCells(*data1, *data2);
+    for (int index = 0; index < data1->getNumCells(); ++index) {
+        EXPECT_EQ(data1->cells[index].cellFunctionData.constructor.genomeDataIndex, data2->cells[index].cellFunctionData.constructor.genomeDataIndex);
+    }
+    EXPECT_EQ(data1->auxiliaryData, data2->auxiliaryData);
+}
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuMap.h"
+
+//compares the map queries with a brute-force scan over all entities, the parameter is the bucket size
+class CpuMapTests
+    : public ::testing::Test
+    , public ::testing::WithParamInterface<int>
+{
+public:
+    virtual ~CpuMapTests() = default;
+
+protected:
+    //non-square and not divisible by the bucket sizes such that the last buckets only partially cover the world
+    static auto constexpr WorldSizeX = 37;
+    static auto constexpr WorldSizeY = 23;
+
+    //distances closer than this to the radius may be decided either way due to rounding
+    static auto constexpr DistanceTolerance = 1e-4f;
+
+    std::mt19937 _randomEngine{42};
+
+    std::vector<float2> createPositions(int numEntities)
+    {
+        std::uniform_real_distribution<float> xDistribution(0, toFloat(WorldSizeX));
+        std::uniform_real_distribution<float> yDistribution(0, toFloat(WorldSizeY));
+        std::vector<float2> result;
+        for (int i = 0; i < numEntities; ++i) {
+            result.emplace_back(float2{xDistribution(_randomEngine), yDistribution(_randomEngine)});
+        }
+
+        //entities at the world edges
+        result.emplace_back(float2{0, 0});
+        result.emplace_back(float2{toFloat(WorldSizeX) - 0.001f, toFloat(WorldSizeY) - 0.001f});
+        result.emplace_back(float2{0.2f, toFloat(WorldSizeY) - 0.3f});
+        result.emplace_back(float2{toFloat(WorldSizeX) - 0.3f, 0.2f});
+        return result;
+    }
+
+    std::vector<uint8_t> createFlags(int numEntities, int oneInN)
+    {
+        std::uniform_int_distribution<int> distribution(0, oneInN - 1);
+        std::vector<uint8_t> result;
+        for (int i = 0; i < numEntities; ++i) {
+            result.emplace_back(distribution(_randomEngine) == 0 ? 1 : 0);
+        }
+        return result;
+    }
+
+    //query positions include the world edges and positions outside the world
+    std::vector<float2> createQueryPositions(int numPositions)
+    {
+        auto result = createPositions(numPositions);
+        result.emplace_back(float2{-0.5f, -0.5f});
+        result.emplace_back(float2{toFloat(WorldSizeX) + 0.5f, 3.5f});
+        result.emplace_back(float2{5.5f, -toFloat(WorldSizeY) + 0.5f});
+        return result;
+    }
+
+    static float getTorusDistance(float2 const& p, float2 const& q)
+    {
+        auto dx = std::fmod(std::abs(p.x - q.x), toFloat(WorldSizeX));
+        auto dy = std::fmod(std::abs(p.y - q.y), toFloat(WorldSizeY));
+        dx = std::min(dx, toFloat(WorldSizeX) - dx);
+        dy = std::min(dy, toFloat(WorldSizeY) - dy);
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    static int2 getUnitSquare(float2 const& pos)
+    {
+        auto x = static_cast<int>(std::floor(pos.x));
+        auto y = static_cast<int>(std::floor(pos.y));
+        return {((x % WorldSizeX) + WorldSizeX) % WorldSizeX, ((y % WorldSizeY) + WorldSizeY) % WorldSizeY};
+    }
+
+    //smallest (first = true) or largest index of the included entities in the unit square of pos or -1
+    static int getInUnitSquareBruteForce(std::vector<float2> const& positions, std::vector<uint8_t> const& removed, float2 const& pos, bool first)
+    {
+        auto unitSquare = getUnitSquare(pos);
+        int result = -1;
+        for (int index = 0; index < toInt(positions.size()); ++index) {
+            auto entityUnitSquare = getUnitSquare(positions[index]);
+            if (removed[index] || entityUnitSquare.x != unitSquare.x || entityUnitSquare.y != unitSquare.y) {
+                continue;
+            }
+            result = index;
+            if (first) {
+                break;
+            }
+        }
+        return result;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(BucketSizes, CpuMapTests, ::testing::Values(1, 2, 4));
+
+TEST_P(CpuMapTests, cellMap_getFirst)
+{
+    auto positions = createPositions(3000);
+    auto numCells = toInt(positions.size());
+    std::vector<CellTO> cells(numCells);
+    for (int index = 0; index < numCells; ++index) {
+        cells[index].pos = positions[index];
+    }
+    auto cellDetached = createFlags(numCells, 5);
+    auto cellRemoved = createFlags(numCells, 4);
+
+    CpuCellMap map;
+    map.init({WorldSizeX, WorldSizeY}, GetParam());
+    map.update(cells, cellDetached, cellRemoved);
+
+    for (int x = -1; x <= WorldSizeX; ++x) {
+        for (int y = -1; y <= WorldSizeY; ++y) {
+            float2 pos{toFloat(x) + 0.5f, toFloat(y) + 0.5f};
+            EXPECT_EQ(getInUnitSquareBruteForce(positions, cellRemoved, pos, true), map.getFirst(pos));
+        }
+    }
+}
+
+TEST_P(CpuMapTests, cellMap_executeForEach)
+{
+    auto positions = createPositions(1000);
+    auto numCells = toInt(positions.size());
+    std::vector<CellTO> cells(numCells);
+    for (int index = 0; index < numCells; ++index) {
+        cells[index].pos = positions[index];
+    }
+    auto cellDetached = createFlags(numCells, 5);
+    auto cellRemoved = createFlags(numCells, 4);
+
+    CpuCellMap map;
+    map.init({WorldSizeX, WorldSizeY}, GetParam());
+    map.update(cells, cellDetached, cellRemoved);
+
+    for (auto const& pos : createQueryPositions(100)) {
+        for (auto radius : {0.5f, 1.3f, 3.7f, 12.0f}) {
+            for (int detached = 0; detached <= 1; ++detached) {
+                std::vector<int> foundIndices;
+                map.executeForEach(pos, radius, detached, [&](int index) { foundIndices.emplace_back(index); });
+                std::sort(foundIndices.begin(), foundIndices.end());
+                EXPECT_TRUE(std::adjacent_find(foundIndices.begin(), foundIndices.end()) == foundIndices.end());
+
+                for (int index = 0; index < numCells; ++index) {
+                    if (cellRemoved[index] || cellDetached[index] != detached) {
+                        EXPECT_FALSE(std::binary_search(foundIndices.begin(), foundIndices.end(), index));
+                        continue;
+                    }
+                    auto distance = getTorusDistance(positions[index], pos);
+                    if (std::abs(distance - radius) < DistanceTolerance) {
+                        continue;
+                    }
+                    EXPECT_EQ(distance < radius, std::binary_search(foundIndices.begin(), foundIndices.end(), index));
+                }
+            }
+        }
+    }
+}
+
+TEST_P(CpuMapTests, particleMap_get)
+{
+    auto positions = createPositions(3000);
+    auto numParticles = toInt(positions.size());
+    std::vector<ParticleTO> particles(numParticles);
+    for (int index = 0; index < numParticles; ++index) {
+        particles[index].pos = positions[index];
+    }
+    auto particleRemoved = createFlags(numParticles, 4);
+
+    CpuParticleMap map;
+    map.init({WorldSizeX, WorldSizeY}, GetParam());
+
+    //the second update checks that the map is correctly reused
+    for (int i = 0; i < 2; ++i) {
+        map.update(particles, particleRemoved);
+        for (int x = -1; x <= WorldSizeX; ++x) {
+            for (int y = -1; y <= WorldSizeY; ++y) {
+                float2 pos{toFloat(x) + 0.5f, toFloat(y) + 0.5f};
+                EXPECT_EQ(getInUnitSquareBruteForce(positions, particleRemoved, pos, false), map.get(pos));
+            }
+        }
+
+        std::shuffle(positions.begin(), positions.end(), _randomEngine);
+        for (int index = 0; index < numParticles; ++index) {
+            particles[index].pos = positions[index];
+        }
+    }
+}
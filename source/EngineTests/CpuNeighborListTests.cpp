@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuEditOperations.h"
+#include "EngineCpuKernels/CpuNeighborList.h"
+
+class CpuNeighborListTests : public ::testing::Test
+{
+public:
+    CpuNeighborListTests() { _neighborList.init(); }
+    virtual ~CpuNeighborListTests() = default;
+
+protected:
+    static auto constexpr WorldSize = 50;
+    static auto constexpr Radius = 1.3f;
+
+    std::mt19937 _randomEngine{42};
+    ThreadPool _threadPool{4};
+    CpuCellMap _map;
+    CpuNeighborList _neighborList;
+    std::vector<CellTO> _cells;
+    std::vector<uint8_t> _cellDetached;
+    std::vector<uint8_t> _cellRemoved;
+
+    void createCells(int numCells)
+    {
+        _map.init({WorldSize, WorldSize});
+        std::uniform_real_distribution<float> posDistribution(0, toFloat(WorldSize));
+        std::uniform_int_distribution<int> flagDistribution(0, 9);
+        for (int i = 0; i < numCells; ++i) {
+            CellTO cell{};
+            cell.id = i + 1;
+            cell.pos = {posDistribution(_randomEngine), posDistribution(_randomEngine)};
+            _cells.emplace_back(cell);
+            _cellDetached.emplace_back(flagDistribution(_randomEngine) == 0 ? 1 : 0);
+            _cellRemoved.emplace_back(flagDistribution(_randomEngine) == 0 ? 1 : 0);
+        }
+    }
+
+    void moveCells(float maxDisplacement)
+    {
+        std::uniform_real_distribution<float> distribution(-maxDisplacement, maxDisplacement);
+        for (auto& cell : _cells) {
+            cell.pos += float2{distribution(_randomEngine), distribution(_randomEngine)};
+            _map.correctPosition(cell.pos);
+        }
+    }
+
+    bool update()
+    {
+        _map.update(_cells, _cellDetached, _cellRemoved);
+        return _neighborList.update(_cells, _cellDetached, _cellRemoved, _map, Radius, _threadPool);
+    }
+
+    void checkNeighbors()
+    {
+        for (int index = 0; index < toInt(_cells.size()); ++index) {
+            if (_cellRemoved[index]) {
+                continue;
+            }
+            std::vector<int> candidates;
+            _neighborList.executeForEach(index, [&](int otherIndex) { candidates.emplace_back(otherIndex); });
+            for (int otherIndex = 0; otherIndex < toInt(_cells.size()); ++otherIndex) {
+                if (otherIndex == index || _cellRemoved[otherIndex] || _cellDetached[index] != _cellDetached[otherIndex]
+                    || _map.getDistance(_cells[index].pos, _cells[otherIndex].pos) > Radius) {
+                    continue;
+                }
+                EXPECT_TRUE(std::find(candidates.begin(), candidates.end(), otherIndex) != candidates.end());
+            }
+        }
+    }
+};
+
+TEST_F(CpuNeighborListTests, containsAllNeighborsWhileReused)
+{
+    createCells(3000);
+    EXPECT_TRUE(update());
+    checkNeighbors();
+
+    for (int i = 0; i < 5; ++i) {
+        moveCells(CpuNeighborList::DefaultSkin / 15);
+        EXPECT_FALSE(update());
+        checkNeighbors();
+    }
+    EXPECT_EQ(1, _neighborList.getNumRebuilds());
+}
+
+TEST_F(CpuNeighborListTests, containsAllNeighborsAfterRebuilds)
+{
+    createCells(3000);
+    for (int i = 0; i < 10; ++i) {
+        moveCells(CpuNeighborList::DefaultSkin / 2);
+        update();
+        checkNeighbors();
+    }
+    EXPECT_LT(1, _neighborList.getNumRebuilds());
+}
+
+TEST_F(CpuNeighborListTests, rebuildAfterLargeDisplacement)
+{
+    createCells(100);
+    update();
+
+    _cells.at(17).pos += float2{CpuNeighborList::DefaultSkin, 0};
+    _map.correctPosition(_cells.at(17).pos);
+    EXPECT_TRUE(update());
+}
+
+TEST_F(CpuNeighborListTests, rebuildAfterChangedCells)
+{
+    createCells(100);
+    update();
+
+    std::swap(_cells.at(3).id, _cells.at(4).id);
+    EXPECT_TRUE(update());
+
+    _cells.pop_back();
+    _cellDetached.pop_back();
+    _cellRemoved.pop_back();
+    EXPECT_TRUE(update());
+}
+
+TEST_F(CpuNeighborListTests, rebuildAfterChangedRadius)
+{
+    createCells(100);
+    update();
+
+    _map.update(_cells, _cellDetached, _cellRemoved);
+    EXPECT_TRUE(_neighborList.update(_cells, _cellDetached, _cellRemoved, _map, Radius * 2, _threadPool));
+    EXPECT_FALSE(_neighborList.update(_cells, _cellDetached, _cellRemoved, _map, Radius * 2, _threadPool));
+}
+
+TEST_F(CpuNeighborListTests, rebuildAfterSetDetached)
+{
+    createCells(100);
+    CpuSimulationData data({WorldSize, WorldSize}, 0);
+    for (int index = 0; index < toInt(_cells.size()); ++index) {
+        auto cell = _cells.at(index);
+        cell.selected = index % 2;
+        data.addCell(cell);
+    }
+    data.cellMap.update(data.cells, data.cellDetached, data.cellRemoved);
+    data.cellNeighbors.update(data.cells, data.cellDetached, data.cellRemoved, data.cellMap, Radius, data.threadPool);
+
+    CpuEditOperations::setDetached(data, true);
+    data.cellMap.update(data.cells, data.cellDetached, data.cellRemoved);
+    EXPECT_TRUE(data.cellNeighbors.update(data.cells, data.cellDetached, data.cellRemoved, data.cellMap, Radius, data.threadPool));
+}
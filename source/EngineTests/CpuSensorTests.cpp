@@ -0,0 +1,357 @@
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuCellFunctionProcessor.h"
+#include "EngineCpuKernels/CpuCellProcessor.h"
+
+#include "CpuTestData.h"
+
+class CpuSensorTests : public ::testing::Test
+{
+public:
+    virtual ~CpuSensorTests() = default;
+
+protected:
+    static auto constexpr WorldSizeX = 250;
+    static auto constexpr WorldSizeY = 200;
+
+    std::mt19937 _randomEngine{42};
+
+    //clusters of cells with random colors and sensors with random settings which are activated by a connected input cell
+    std::shared_ptr<CpuSimulationData> createData(int numSensors, int numThreads, int2 const& worldSize = {WorldSizeX, WorldSizeY})
+    {
+        _randomEngine.seed(42);
+        std::uniform_real_distribution<float> posXDistribution(0, toFloat(worldSize.x));
+        std::uniform_real_distribution<float> posYDistribution(0, toFloat(worldSize.y));
+        std::uniform_int_distribution<int> colorDistribution(0, MAX_COLORS - 1);
+        std::vector<int> clusterColors(20);
+        for (auto& color : clusterColors) {
+            color = colorDistribution(_randomEngine);
+        }
+        auto cells = CpuTestData::createClusters(_randomEngine, worldSize, 20, 200, 5.0f, [&](CellTO& cell, int cluster) {
+            cell.color = clusterColors[cluster];
+            cell.creatureId = cluster + 1;
+        });
+        auto result = CpuTestData::createData(worldSize, cells, numThreads);
+        result->parameters.cellFunctionAttackerSensorDetectionFactor[1] = 0.5f;
+        result->parameters.cellFunctionSensorRange[2] = 100.0f;
+
+        std::uniform_real_distribution<float> realDistribution(0, 1.0f);
+        std::vector<int> sensorIndices;
+        for (int i = 0; i < numSensors; ++i) {
+            float2 pos{posXDistribution(_randomEngine), posYDistribution(_randomEngine)};
+            auto color = colorDistribution(_randomEngine);
+            auto inputAngle = realDistribution(_randomEngine) * 360.0f;
+            SensorTO sensor{};
+            sensor.mode = realDistribution(_randomEngine) < 0.5f ? SensorMode_Neighborhood : SensorMode_FixedAngle;
+            sensor.angle = realDistribution(_randomEngine) * 360.0f - 180.0f;
+            sensor.minDensity = realDistribution(_randomEngine) < 0.2f ? 0.0f : realDistribution(_randomEngine) * 0.1f;
+            sensor.color = colorDistribution(_randomEngine);
+            sensorIndices.emplace_back(addSensor(*result, pos, inputAngle, sensor, color));
+        }
+        prepareSensors(*result, sensorIndices);
+        return result;
+    }
+
+    //adds an activated sensor cell at pos whose input cell lies in the direction of inputAngle, returns the index of the sensor cell
+    int addSensor(CpuSimulationData& data, float2 const& pos, float inputAngle, SensorTO sensor, int color) const
+    {
+        auto inputCell = CpuTestData::createCell(pos + CpuMath::unitVectorOfAngle(inputAngle), color);
+        inputCell.activity.channels[0] = 1.0f;
+        auto inputIndex = data.addCell(inputCell);
+
+        auto sensorCell = CpuTestData::createCell(pos, color);
+        sensorCell.executionOrderNumber = 1;
+        sensorCell.inputExecutionOrderNumber = 0;
+        sensorCell.cellFunction = CellFunction_Sensor;
+        sensor.targetedCreatureId = -1;
+        sensorCell.cellFunctionData.sensor = sensor;
+        sensorCell.connections[sensorCell.numConnections++] = ConnectionTO{inputIndex, 1.0f, 0};
+        auto result = data.addCell(sensorCell);
+        data.cells[inputIndex].connections[data.cells[inputIndex].numConnections++] = ConnectionTO{result, 1.0f, 0};
+        return result;
+    }
+
+    void prepareSensors(CpuSimulationData& data, std::vector<int> const& sensorIndices) const
+    {
+        data.prepareForNextTimestep();
+        data.cellFunctionOperations[CellFunction_Sensor] = sensorIndices;
+        CpuCellProcessor::updateMap(data);
+        CpuCellProcessor::fillDensityMap(data);
+    }
+
+    //a square of cells of color 1 with a cell distance of 0.5
+    static std::vector<CellTO> createMass(float2 const& center, int size)
+    {
+        std::vector<CellTO> result;
+        for (int x = 0; x < size; ++x) {
+            for (int y = 0; y < size; ++y) {
+                result.emplace_back(CpuTestData::createCell(center + float2{toFloat(x - size / 2) * 0.5f, toFloat(y - size / 2) * 0.5f}, 1));
+            }
+        }
+        return result;
+    }
+
+    static SensorTO createNeighborhoodSensor()
+    {
+        SensorTO result{};
+        result.mode = SensorMode_Neighborhood;
+        result.minDensity = 0.05f;
+        result.color = 1;
+        return result;
+    }
+
+    //straight port of SensorProcessor::searchNeighborhood and SensorProcessor::searchByAngle without ray tables and pyramid
+    void calcReferenceSensorResult(CpuSimulationData const& data, CellTO& cell) const
+    {
+        auto const& parameters = data.parameters;
+        auto& sensor = cell.cellFunctionData.sensor;
+        auto signalDirection = CpuCellFunctionProcessor::calcSignalDirection(data, cell);
+        auto findCreatureId = [&](float2 const& scanPos) {
+            if (parameters.cellFunctionAttackerSensorDetectionFactor[cell.color] > NEAR_ZERO) {
+                for (float dx = -3.0f; dx < 3.0f + NEAR_ZERO; dx += 1.0f) {
+                    for (float dy = -3.0f; dy < 3.0f + NEAR_ZERO; dy += 1.0f) {
+                        auto otherIndex = data.cellMap.getFirst(scanPos + float2{dx, dy});
+                        if (otherIndex != -1 && data.cells[otherIndex].color == sensor.color) {
+                            return static_cast<uint32_t>(data.cells[otherIndex].creatureId);
+                        }
+                    }
+                }
+            }
+            return 0xffffffffu;
+        };
+
+        uint64_t lookupResult = 0xffffffffffffffff;
+        if (sensor.mode == SensorMode_Neighborhood) {
+            auto refScanAngle = CpuMath::angleOfVector(signalDirection);
+            auto minDensity = toInt(sensor.minDensity * 100);
+            auto startRadius = sensor.color == cell.color ? 14.0f : 0.0f;
+            for (float radius = startRadius; radius <= parameters.cellFunctionSensorRange[cell.color]; radius += 8.0f) {
+                for (int angleIndex = 0; angleIndex < 32; ++angleIndex) {
+                    float angle = 360.0f / 32 * angleIndex;
+                    auto scanPos = cell.pos + CpuMath::unitVectorOfAngle(angle) * radius;
+                    data.cellMap.correctPosition(scanPos);
+                    auto density = static_cast<unsigned char>(data.densityMap.getDensity(scanPos, sensor.color));
+                    if (density >= minDensity) {
+                        auto relAngle = CpuMath::subtractAngle(angle, refScanAngle);
+                        auto relAngleData = static_cast<uint8_t>(static_cast<int>(toReferenceAngle(relAngle) * 128.0f / 180.0f));
+                        uint64_t combined = static_cast<uint64_t>(radius) << 48 | static_cast<uint64_t>(density) << 40
+                            | static_cast<uint64_t>(relAngleData) << 32 | findCreatureId(scanPos);
+                        lookupResult = std::min(lookupResult, combined);
+                    }
+                }
+            }
+        } else {
+            auto minDensity = toInt(sensor.minDensity * 255);
+            auto searchDelta = CpuMath::rotateClockwise(signalDirection, sensor.angle);
+            for (int distanceIndex = 0; distanceIndex < 64; ++distanceIndex) {
+                auto distance = 14.0f + parameters.cellFunctionSensorRange[cell.color] / 64 * distanceIndex;
+                auto scanPos = cell.pos + searchDelta * distance;
+                data.cellMap.correctPosition(scanPos);
+                auto density = static_cast<unsigned char>(data.densityMap.getDensity(scanPos, sensor.color));
+                if (density >= minDensity) {
+                    uint64_t combined = static_cast<uint64_t>(distance) << 48 | static_cast<uint64_t>(density) << 40 | findCreatureId(scanPos);
+                    lookupResult = std::min(lookupResult, combined);
+                }
+            }
+        }
+
+        if (lookupResult != 0xffffffffffffffff) {
+            cell.activity.channels[0] = 1;
+            cell.activity.channels[1] = static_cast<float>((lookupResult >> 40) & 0xff) / 256;
+            cell.activity.channels[2] = static_cast<float>(lookupResult >> 48) / 256;
+            if (sensor.mode == SensorMode_Neighborhood) {
+                auto b = static_cast<uint8_t>((lookupResult >> 32) & 0xff);
+                cell.activity.channels[3] = (b < 128 ? 0.5f + static_cast<float>(b) : -256.0f - 0.5f + static_cast<float>(b)) * (180.0f / 128.0f) / 360.0f;
+            }
+            if ((lookupResult & 0xffffffff) != 0xffffffff) {
+                sensor.targetedCreatureId = toInt(lookupResult & 0xffffffff);
+            }
+        } else {
+            cell.activity.channels[0] = 0;
+        }
+    }
+
+    static float toReferenceAngle(float angle)
+    {
+        angle = std::remainder(std::remainder(angle, 360.0f) + 360.0f, 360.0f);
+        return angle > 180.0f ? angle - 360.0f : angle;
+    }
+};
+
+TEST_F(CpuSensorTests, densityPyramidConsistentWithSlots)
+{
+    auto data = createData(0, 4);
+    std::uniform_real_distribution<float> posXDistribution(0, toFloat(WorldSizeX));
+    std::uniform_real_distribution<float> posYDistribution(0, toFloat(WorldSizeY));
+    std::uniform_real_distribution<float> realDistribution(0, 1.0f);
+    int numNonEmpty = 0;
+    int numBlocks = 0;
+    for (int i = 0; i < 100000; ++i) {
+        float2 pos{posXDistribution(_randomEngine), posYDistribution(_randomEngine)};
+        for (int color = 0; color < MAX_COLORS; ++color) {
+            auto isEmpty = data->densityMap.getDensity(pos, color) == 0;
+            float2 blockStart;
+            float2 blockEnd;
+            ASSERT_EQ(isEmpty, data->densityMap.isEmpty(pos, color, blockStart, blockEnd));
+            numNonEmpty += isEmpty ? 0 : 1;
+
+            //the empty block contains the position and no cells of the color
+            if (isEmpty && blockStart.x < blockEnd.x) {
+                ASSERT_LE(blockStart.x, pos.x);
+                ASSERT_LE(blockStart.y, pos.y);
+                ASSERT_GT(blockEnd.x, pos.x);
+                ASSERT_GT(blockEnd.y, pos.y);
+                float2 samplePos{
+                    blockStart.x + (blockEnd.x - blockStart.x) * realDistribution(_randomEngine),
+                    blockStart.y + (blockEnd.y - blockStart.y) * realDistribution(_randomEngine)};
+                ASSERT_EQ(0, data->densityMap.getDensity(samplePos, color));
+                ++numBlocks;
+            }
+        }
+    }
+    EXPECT_LT(0, numNonEmpty);
+    EXPECT_LT(0, numBlocks);
+}
+
+TEST_F(CpuSensorTests, sameResultsAsReference)
+{
+    auto data = createData(500, 4);
+    auto referenceCells = data->cells;
+    for (auto const& cellIndex : data->cellFunctionOperations[CellFunction_Sensor]) {
+        calcReferenceSensorResult(*data, referenceCells[cellIndex]);
+    }
+
+    CpuSimulationStatistics statistics;
+    CpuCellFunctionProcessor::processSensors(*data, statistics);
+
+    int numMatches = 0;
+    int numTargets = 0;
+    for (auto const& cellIndex : data->cellFunctionOperations[CellFunction_Sensor]) {
+        auto const& cell = data->cells[cellIndex];
+        auto const& referenceCell = referenceCells[cellIndex];
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(referenceCell.activity.channels[i], cell.activity.channels[i]);
+        }
+        EXPECT_EQ(referenceCell.cellFunctionData.sensor.targetedCreatureId, cell.cellFunctionData.sensor.targetedCreatureId);
+        numMatches += cell.activity.channels[0] > 0.5f ? 1 : 0;
+        numTargets += cell.cellFunctionData.sensor.targetedCreatureId != -1 ? 1 : 0;
+    }
+    EXPECT_LT(0, numMatches);
+    EXPECT_GT(500, numMatches);
+    EXPECT_LT(0, numTargets);
+
+    auto statisticsData = statistics.calcStatistics(*data);
+    uint64_t numActivities = 0;
+    uint64_t numSensorMatches = 0;
+    for (int color = 0; color < MAX_COLORS; ++color) {
+        numActivities += statisticsData.timeline.accumulated.numSensorActivities[color];
+        numSensorMatches += statisticsData.timeline.accumulated.numSensorMatches[color];
+    }
+    EXPECT_EQ(500, numActivities);
+    EXPECT_EQ(numMatches, numSensorMatches);
+}
+
+TEST_F(CpuSensorTests, sameResultsAsReferenceWithShortRanges)
+{
+    //the slots cover the whole world, hence sensors without cells of their color in range are skipped
+    auto data = createData(500, 4, {256, 200});
+    for (auto& range : data->parameters.cellFunctionSensorRange) {
+        range = 30.0f;
+    }
+    auto referenceCells = data->cells;
+    for (auto const& cellIndex : data->cellFunctionOperations[CellFunction_Sensor]) {
+        calcReferenceSensorResult(*data, referenceCells[cellIndex]);
+    }
+
+    CpuSimulationStatistics statistics;
+    CpuCellFunctionProcessor::processSensors(*data, statistics);
+
+    int numMatches = 0;
+    for (auto const& cellIndex : data->cellFunctionOperations[CellFunction_Sensor]) {
+        auto const& cell = data->cells[cellIndex];
+        auto const& referenceCell = referenceCells[cellIndex];
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(referenceCell.activity.channels[i], cell.activity.channels[i]);
+        }
+        EXPECT_EQ(referenceCell.cellFunctionData.sensor.targetedCreatureId, cell.cellFunctionData.sensor.targetedCreatureId);
+        numMatches += cell.activity.channels[0] > 0.5f ? 1 : 0;
+    }
+    EXPECT_LT(0, numMatches);
+    EXPECT_GT(500, numMatches);
+}
+
+TEST_F(CpuSensorTests, independentOfNumberOfThreads)
+{
+    auto data1 = createData(500, 1);
+    auto data2 = createData(500, 8);
+    CpuSimulationStatistics statistics1;
+    CpuSimulationStatistics statistics2;
+
+    CpuCellFunctionProcessor::processSensors(*data1, statistics1);
+    CpuCellFunctionProcessor::processSensors(*data2, statistics2);
+
+    CpuTestData::checkSameCells(*data1, *data2);
+    for (auto const& cellIndex : data1->cellFunctionOperations[CellFunction_Sensor]) {
+        EXPECT_EQ(data1->cells[cellIndex].cellFunctionData.sensor.targetedCreatureId, data2->cells[cellIndex].cellFunctionData.sensor.targetedCreatureId);
+    }
+    for (int y = 0; y < WorldSizeY; ++y) {
+        for (int x = 0; x < WorldSizeX; ++x) {
+            for (int color = 0; color < MAX_COLORS; ++color) {
+                float2 pos{toFloat(x), toFloat(y)};
+                ASSERT_EQ(data1->densityMap.getDensity(pos, color), data2->densityMap.getDensity(pos, color));
+            }
+        }
+    }
+}
+
+TEST_F(CpuSensorTests, foundAcrossWorldBoundary)
+{
+    auto data = CpuTestData::createData({WorldSizeX, WorldSizeY}, createMass({0, 100.0f}, 10));
+    auto sensorIndex = addSensor(*data, {WorldSizeX - 30.0f, 100.0f}, 180.0f, createNeighborhoodSensor(), 0);
+    prepareSensors(*data, {sensorIndex});
+    auto referenceCell = data->cells[sensorIndex];
+    calcReferenceSensorResult(*data, referenceCell);
+
+    CpuSimulationStatistics statistics;
+    CpuCellFunctionProcessor::processSensors(*data, statistics);
+
+    auto const& cell = data->cells[sensorIndex];
+    EXPECT_EQ(1.0f, cell.activity.channels[0]);
+    EXPECT_GT(40.0f / 256, cell.activity.channels[2]);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(referenceCell.activity.channels[i], cell.activity.channels[i]);
+    }
+}
+
+TEST_F(CpuSensorTests, removedCellsNotFound)
+{
+    auto data = CpuTestData::createData({WorldSizeX, WorldSizeY}, createMass({100.0f, 100.0f}, 10));
+    for (int index = 0; index < data->getNumCells(); ++index) {
+        data->cellRemoved[index] = 1;
+    }
+    auto sensorIndex = addSensor(*data, {130.0f, 100.0f}, 0, createNeighborhoodSensor(), 0);
+    prepareSensors(*data, {sensorIndex});
+
+    CpuSimulationStatistics statistics;
+    CpuCellFunctionProcessor::processSensors(*data, statistics);
+
+    EXPECT_EQ(0.0f, data->cells[sensorIndex].activity.channels[0]);
+}
+
+TEST_F(CpuSensorTests, densitySaturates)
+{
+    std::vector<CellTO> cells(300, CpuTestData::createCell({100.5f, 100.5f}, 1));
+    auto data = CpuTestData::createData({WorldSizeX, WorldSizeY}, cells);
+    auto sensorIndex = addSensor(*data, {130.5f, 100.5f}, 0, createNeighborhoodSensor(), 0);
+    prepareSensors(*data, {sensorIndex});
+
+    CpuSimulationStatistics statistics;
+    CpuCellFunctionProcessor::processSensors(*data, statistics);
+
+    auto const& cell = data->cells[sensorIndex];
+    EXPECT_EQ(1.0f, cell.activity.channels[0]);
+    EXPECT_EQ(toFloat(CpuDensityMap::MaxDensity) / 256, cell.activity.channels[1]);
+}
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuCellConnectionProcessor.h"
+#include "EngineCpuKernels/CpuCellProcessor.h"
+
+#include "CpuTestData.h"
+
+class CpuStructuralOperationQueueTests : public ::testing::Test
+{
+public:
+    virtual ~CpuStructuralOperationQueueTests() = default;
+
+protected:
+    std::mt19937 _randomEngine{42};
+
+    std::vector<CpuStructuralOperation> createRandomOperations(int numOperations, int numCells)
+    {
+        std::uniform_int_distribution<int> typeDistribution(0, 3);
+        std::uniform_int_distribution<int> cellDistribution(0, numCells - 1);
+        std::vector<CpuStructuralOperation> result;
+        for (int i = 0; i < numOperations; ++i) {
+            auto type = static_cast<CpuStructuralOperation::Type>(typeDistribution(_randomEngine));
+            auto hasOtherCell = type == CpuStructuralOperation::Type::AddConnectionPair || type == CpuStructuralOperation::Type::DelConnectionPair;
+            result.emplace_back(CpuStructuralOperation{type, cellDistribution(_randomEngine), hasOtherCell ? cellDistribution(_randomEngine) : -1});
+        }
+        return result;
+    }
+
+    //one cell surrounded by candidates in increasing distances
+    std::shared_ptr<CpuSimulationData> createStarData(int numCandidates, int maxConnections)
+    {
+        auto result = std::make_shared<CpuSimulationData>(int2{100, 100}, 0);
+        CellTO cell{};
+        cell.energy = 100;
+        cell.maxConnections = maxConnections;
+        cell.pos = {50.0f, 50.0f};
+        result->addCell(cell);
+        for (int i = 0; i < numCandidates; ++i) {
+            cell.id = i + 1;
+            cell.maxConnections = MAX_CELL_BONDS;
+            cell.pos = float2{50.0f, 50.0f} + CpuMath::unitVectorOfAngle(toFloat(i) * 360.0f / toFloat(numCandidates)) * (1.0f + toFloat(i) * 0.01f);
+            result->addCell(cell);
+        }
+        return result;
+    }
+};
+
+TEST_F(CpuStructuralOperationQueueTests, mergeIndependentOfThreadBuffers)
+{
+    auto operations = createRandomOperations(1000, 50);
+
+    CpuStructuralOperationQueue queue1;
+    queue1.init(1);
+    for (auto const& operation : operations) {
+        queue1.schedule(0, operation);
+    }
+
+    CpuStructuralOperationQueue queue2;
+    queue2.init(4);
+    std::shuffle(operations.begin(), operations.end(), _randomEngine);
+    std::uniform_int_distribution<int> threadDistribution(0, 3);
+    for (auto const& operation : operations) {
+        queue2.schedule(threadDistribution(_randomEngine), operation);
+    }
+    EXPECT_EQ(1000, queue2.getNumScheduledOperations());
+
+    auto const& merged1 = queue1.merge();
+    auto const& merged2 = queue2.merge();
+    ASSERT_EQ(merged1.size(), merged2.size());
+    for (size_t i = 0; i < merged1.size(); ++i) {
+        EXPECT_EQ(merged1[i].type, merged2[i].type);
+        EXPECT_EQ(merged1[i].cellIndex, merged2[i].cellIndex);
+        EXPECT_EQ(merged1[i].otherCellIndex, merged2[i].otherCellIndex);
+    }
+    EXPECT_EQ(0, queue1.getNumScheduledOperations());
+}
+
+TEST_F(CpuStructuralOperationQueueTests, mergeInPhaseOrderWithoutDuplicates)
+{
+    CpuStructuralOperationQueue queue;
+    queue.init(2);
+    queue.schedule(0, {CpuStructuralOperation::Type::DelConnectionPair, 5, 3});
+    queue.schedule(1, {CpuStructuralOperation::Type::DelCell, 4, -1});
+    queue.schedule(1, {CpuStructuralOperation::Type::AddConnectionPair, 2, 1});
+    queue.schedule(0, {CpuStructuralOperation::Type::AddConnectionPair, 1, 2});
+    queue.schedule(0, {CpuStructuralOperation::Type::DelCell, 4, -1});
+    queue.schedule(1, {CpuStructuralOperation::Type::DelConnectionPair, 3, 5});
+
+    auto const& operations = queue.merge();
+
+    ASSERT_EQ(3, operations.size());
+    EXPECT_EQ(CpuStructuralOperation::Type::AddConnectionPair, operations[0].type);
+    EXPECT_EQ(1, operations[0].cellIndex);
+    EXPECT_EQ(2, operations[0].otherCellIndex);
+    EXPECT_EQ(CpuStructuralOperation::Type::DelCell, operations[1].type);
+    EXPECT_EQ(CpuStructuralOperation::Type::DelConnectionPair, operations[2].type);
+    EXPECT_EQ(3, operations[2].cellIndex);
+    EXPECT_EQ(5, operations[2].otherCellIndex);
+}
+
+TEST_F(CpuStructuralOperationQueueTests, shortestConnectionsWinFreeSlots)
+{
+    auto data = createStarData(5, 3);
+    for (int index = 5; index >= 1; --index) {
+        CpuCellConnectionProcessor::scheduleAddConnectionPair(*data, 0, index, 0);
+    }
+    CpuCellConnectionProcessor::processOperations(*data);
+
+    auto const& cell = data->cells[0];
+    ASSERT_EQ(3, cell.numConnections);
+    for (int index = 1; index <= 3; ++index) {
+        EXPECT_TRUE(CpuCellConnectionProcessor::isConnected(*data, 0, index));
+        EXPECT_TRUE(CpuCellConnectionProcessor::isConnected(*data, index, 0));
+    }
+    EXPECT_EQ(0, data->cells[4].numConnections);
+    EXPECT_EQ(0, data->cells[5].numConnections);
+}
+
+TEST_F(CpuStructuralOperationQueueTests, bondLimitRespected)
+{
+    auto data = createStarData(MAX_CELL_BONDS + 3, MAX_CELL_BONDS + 3);
+    for (int index = 1; index < data->getNumCells(); ++index) {
+        CpuCellConnectionProcessor::scheduleAddConnectionPair(*data, 0, 0, index);
+    }
+    CpuCellConnectionProcessor::processOperations(*data);
+
+    EXPECT_EQ(MAX_CELL_BONDS, data->cells[0].numConnections);
+}
+
+TEST_F(CpuStructuralOperationQueueTests, invalidAdditionsDoNotOccupySlots)
+{
+    auto data = createStarData(3, 2);
+    data->cellRemoved[1] = 1;
+    CpuCellConnectionProcessor::tryAddConnections(*data, 0, 2);
+    CpuCellConnectionProcessor::scheduleAddConnectionPair(*data, 0, 0, 1);
+    CpuCellConnectionProcessor::scheduleAddConnectionPair(*data, 0, 2, 0);
+    CpuCellConnectionProcessor::scheduleAddConnectionPair(*data, 0, 0, 3);
+    CpuCellConnectionProcessor::processOperations(*data);
+
+    EXPECT_EQ(2, data->cells[0].numConnections);
+    EXPECT_TRUE(CpuCellConnectionProcessor::isConnected(*data, 0, 3));
+    EXPECT_FALSE(CpuCellConnectionProcessor::isConnected(*data, 0, 1));
+}
+
+TEST_F(CpuStructuralOperationQueueTests, parallelSchedulingIndependentOfNumberOfThreads)
+{
+    auto createData = [&](int numThreads) {
+        _randomEngine.seed(42);
+        auto cells = CpuTestData::createCells(_randomEngine, {40, 40}, 3000, [](CellTO& cell) { cell.maxConnections = 3; });
+        auto result = CpuTestData::createData({40, 40}, cells, numThreads);
+        CpuCellProcessor::updateMap(*result);
+        return result;
+    };
+    auto scheduleAdditions = [](CpuSimulationData& data) {
+        data.forEachCell([&](int threadIndex, int index) {
+            data.cellMap.executeForEach(data.cells[index].pos, 1.0f, data.cellDetached[index], [&](int otherIndex) {
+                if (otherIndex != index) {
+                    CpuCellConnectionProcessor::scheduleAddConnectionPair(data, threadIndex, index, otherIndex);
+                }
+            });
+        });
+        CpuCellConnectionProcessor::processOperations(data);
+    };
+    auto data1 = createData(1);
+    auto data2 = createData(4);
+    scheduleAdditions(*data1);
+    scheduleAdditions(*data2);
+
+    CpuTestData::checkSameCells(*data1, *data2);
+    for (auto const& cell : data1->cells) {
+        EXPECT_GE(3, cell.numConnections);
+    }
+}
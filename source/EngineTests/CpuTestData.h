@@ -0,0 +1,113 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "EngineCpuKernels/CpuSimulationData.h"
+
+//worlds for the host-side tests of the cpu backend
+class CpuTestData
+{
+public:
+    //cells with ids from 1 at uniformly distributed positions, initCell adapts the further properties of each cell
+    static std::vector<CellTO> createCells(
+        std::mt19937& randomEngine,
+        int2 const& worldSize,
+        int numCells,
+        std::function<void(CellTO&)> const& initCell = {})
+    {
+        std::uniform_real_distribution<float> posXDistribution(0, toFloat(worldSize.x));
+        std::uniform_real_distribution<float> posYDistribution(0, toFloat(worldSize.y));
+        std::vector<CellTO> result;
+        for (int i = 0; i < numCells; ++i) {
+            auto cell = createCell({posXDistribution(randomEngine), posYDistribution(randomEngine)});
+            cell.id = i + 1;
+            if (initCell) {
+                initCell(cell);
+            }
+            result.emplace_back(cell);
+        }
+        return result;
+    }
+
+    //clusters of cells around uniformly distributed centers, the clusters may wrap around the world boundaries
+    //initCell(cell, clusterIndex) adapts the further properties of each cell
+    static std::vector<CellTO> createClusters(
+        std::mt19937& randomEngine,
+        int2 const& worldSize,
+        int numClusters,
+        int clusterSize,
+        float clusterRadius,
+        std::function<void(CellTO&, int)> const& initCell = {})
+    {
+        std::uniform_real_distribution<float> posXDistribution(0, toFloat(worldSize.x));
+        std::uniform_real_distribution<float> posYDistribution(0, toFloat(worldSize.y));
+        std::normal_distribution<float> clusterDistribution(0, clusterRadius);
+        std::vector<CellTO> result;
+        for (int cluster = 0; cluster < numClusters; ++cluster) {
+            float2 center{posXDistribution(randomEngine), posYDistribution(randomEngine)};
+            for (int i = 0; i < clusterSize; ++i) {
+                auto cell = createCell(center + float2{clusterDistribution(randomEngine), clusterDistribution(randomEngine)});
+                cell.id = result.size() + 1;
+                if (initCell) {
+                    initCell(cell, cluster);
+                }
+                result.emplace_back(cell);
+            }
+        }
+        return result;
+    }
+
+    static CellTO createCell(float2 const& pos, int color = 0)
+    {
+        CellTO result{};
+        result.pos = pos;
+        result.energy = 100;
+        result.color = color;
+        result.maxConnections = 2;
+        result.livingState = LivingState_Ready;
+        result.inputExecutionOrderNumber = -1;
+        result.cellFunction = CellFunction_None;
+        return result;
+    }
+
+    //the positions are corrected to the torus
+    static std::shared_ptr<CpuSimulationData> createData(int2 const& worldSize, std::vector<CellTO> const& cells, int numThreads = 0)
+    {
+        auto result = std::make_shared<CpuSimulationData>(worldSize, 0, numThreads);
+        for (auto const& cell : cells) {
+            result->addCell(cell);
+        }
+        return result;
+    }
+
+    //the cell kernels must yield bitwise identical results for any number of threads
+    static void checkSameCells(CpuSimulationData const& data1, CpuSimulationData const& data2)
+    {
+        ASSERT_EQ(data1.getNumCells(), data2.getNumCells());
+        for (int index = 0; index < data1.getNumCells(); ++index) {
+            auto const& cell1 = data1.cells[index];
+            auto const& cell2 = data2.cells[index];
+            EXPECT_EQ(cell1.id, cell2.id);
+            EXPECT_EQ(cell1.pos.x, cell2.pos.x);
+            EXPECT_EQ(cell1.pos.y, cell2.pos.y);
+            EXPECT_EQ(cell1.vel.x, cell2.vel.x);
+            EXPECT_EQ(cell1.vel.y, cell2.vel.y);
+            EXPECT_EQ(cell1.energy, cell2.energy);
+            for (int i = 0; i < MAX_CHANNELS; ++i) {
+                EXPECT_EQ(cell1.activity.channels[i], cell2.activity.channels[i]);
+            }
+            ASSERT_EQ(cell1.numConnections, cell2.numConnections);
+            for (int i = 0; i < cell1.numConnections; ++i) {
+                EXPECT_EQ(cell1.connections[i].cellIndex, cell2.connections[i].cellIndex);
+                EXPECT_EQ(cell1.connections[i].distance, cell2.connections[i].distance);
+                EXPECT_EQ(cell1.connections[i].angleFromPrevious, cell2.connections[i].angleFromPrevious);
+            }
+            EXPECT_EQ(data1.cellRemoved[index], data2.cellRemoved[index]);
+        }
+    }
+};
@@ -1,17 +1,20 @@
 #include <gtest/gtest.h>
 
 #include "Base/Definitions.h"
+#include "Base/Math.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
 #include "EngineInterface/SimulationController.h"
 #include "IntegrationTestFramework.h"
 
-class DescriptionHelperTests 
-    : public IntegrationTestFramework
+class DescriptionHelperTests
+    : public ::testing::WithParamInterface<SimulationBackend>
+    , public IntegrationTestFramework
 {
 public:
     DescriptionHelperTests()
-        : IntegrationTestFramework(std::nullopt, {100, 100})
+        : IntegrationTestFramework(std::nullopt, {100, 100}, GetParam())
     {}
     virtual ~DescriptionHelperTests() = default;
 
@@ -35,14 +38,110 @@ protected:
     }
 };
 
+INSTANTIATE_TEST_SUITE_P(Backends, DescriptionHelperTests, ::testing::ValuesIn(IntegrationTestFramework::getBackends()), IntegrationTestFramework::getBackendName);
 
-TEST_F(DescriptionHelperTests, correctConnections)
+TEST_P(DescriptionHelperTests, correctConnections)
 {
     auto data = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(10).height(10).center({50.0f, 99.0f}));
     _simController->setSimulationData(data);
     auto clusteredData = _simController->getClusteredSimulationData();
 
-    DescriptionHelper::correctConnections(clusteredData, {100, 100});
+    DescriptionHelper::correctConnections(clusteredData, {100, 100}, _parameters.cellMaxBindingDistance);
 
     EXPECT_TRUE(areAngelsCorrect(clusteredData));
 }
+
+TEST_P(DescriptionHelperTests, correctConnections_keepConnectionsAcrossWorldBoundary)
+{
+    auto data = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(10).height(10).center({50.0f, 99.0f}));
+    _simController->setSimulationData(data);
+    auto clusteredData = _simController->getClusteredSimulationData();
+    auto origClusteredData = clusteredData;
+
+    DescriptionHelper::correctConnections(clusteredData, {100, 100}, _parameters.cellMaxBindingDistance);
+
+    EXPECT_EQ(origClusteredData, clusteredData);
+}
+
+TEST_P(DescriptionHelperTests, correctConnections_removeConnectionsAfterResizing)
+{
+    auto data = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(10).height(10).center({50.0f, 99.0f}));
+    _simController->setSimulationData(data);
+    auto clusteredData = _simController->getClusteredSimulationData();
+
+    DescriptionHelper::correctConnections(clusteredData, {150, 150}, _parameters.cellMaxBindingDistance);
+
+    EXPECT_TRUE(areAngelsCorrect(clusteredData));
+    std::unordered_map<uint64_t, RealVector2D> cellPosById;
+    for (auto const& cell : DataDescription(clusteredData).cells) {
+        cellPosById.emplace(cell.id, cell.pos);
+    }
+    auto numConnections = 0;
+    for (auto const& cell : DataDescription(clusteredData).cells) {
+        for (auto const& connection : cell.connections) {
+            EXPECT_TRUE(Math::length(cellPosById.at(connection.cellId) - cell.pos) <= _parameters.cellMaxBindingDistance);
+            ++numConnections;
+        }
+    }
+    EXPECT_EQ(2 * (9 * 10 + 10 * 8), numConnections);
+}
+
+TEST_P(DescriptionHelperTests, randomizeGenomeColors)
+{
+    auto subGenome = GenomeDescriptionConverter::convertDescriptionToBytes(
+        GenomeDescription().setCells({CellGenomeDescription().setColor(1), CellGenomeDescription().setCellFunction(NeuronGenomeDescription()).setColor(2)}));
+    auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+        CellGenomeDescription().setColor(3),
+        CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)).setColor(4),
+        CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setMakeGenomeCopy()).setColor(5),
+    }));
+
+    ClusteredDataDescription data;
+    for (int i = 0; i < 1000; ++i) {
+        data.addCluster(ClusterDescription().addCell(CellDescription().setId(i + 1).setCellFunction(ConstructorDescription().setGenome(genome))));
+    }
+    DescriptionHelper::randomizeGenomeColors(data, {6});
+
+    for (auto const& cluster : data.clusters) {
+        auto const& actualGenome = std::get<ConstructorDescription>(*cluster.cells.front().cellFunction).genome;
+        EXPECT_EQ(genome.size(), actualGenome.size());
+
+        auto actualGenomeDesc = GenomeDescriptionConverter::convertBytesToDescription(actualGenome);
+        for (auto const& node : actualGenomeDesc.cells) {
+            EXPECT_EQ(6, node.color);
+        }
+        auto actualSubGenomeDesc = GenomeDescriptionConverter::convertBytesToDescription(*actualGenomeDesc.cells.at(1).getGenome());
+        for (auto const& node : actualSubGenomeDesc.cells) {
+            EXPECT_EQ(6, node.color);
+        }
+    }
+}
+
+TEST_P(DescriptionHelperTests, randomizeColors_noColorCodes)
+{
+    ClusteredDataDescription data;
+    for (int i = 0; i < 1000; ++i) {
+        data.addCluster(ClusterDescription().addCell(CellDescription().setId(i + 1).setColor(2)));
+    }
+    auto origData = data;
+
+    DescriptionHelper::randomizeCellColors(data, {});
+    DescriptionHelper::randomizeGenomeColors(data, {});
+
+    EXPECT_EQ(origData, data);
+}
+
+TEST_P(DescriptionHelperTests, generateExecutionOrderNumbers)
+{
+    auto data = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(10).height(1));
+    auto otherData = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(10).height(1).center({0, 10.0f}));
+    data.add(otherData);
+
+    auto maxBranchNumbers = _parameters.cellNumExecutionOrderNumbers;
+    DescriptionHelper::generateExecutionOrderNumbers(data, {data.cells.at(0).id, data.cells.at(10).id}, maxBranchNumbers);
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(i % maxBranchNumbers, data.cells.at(i).executionOrderNumber);
+        EXPECT_EQ(i % maxBranchNumbers, data.cells.at(i + 10).executionOrderNumber);
+    }
+}
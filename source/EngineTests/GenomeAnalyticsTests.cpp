@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeAnalytics.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+
+#include "GenomeTestData.h"
+
+class GenomeAnalyticsTests : public ::testing::Test
+{
+public:
+    virtual ~GenomeAnalyticsTests() = default;
+
+protected:
+    CellDescription createConstructorCell(uint64_t id, std::vector<uint8_t> const& genome) const
+    {
+        return CellDescription().setId(id).setCellFunction(ConstructorDescription().setGenome(genome));
+    }
+};
+
+TEST_F(GenomeAnalyticsTests, groupCellsByGenome)
+{
+    auto genome1 = GenomeTestData::createNeuronGenome(5);
+    auto genome2 = GenomeTestData::createNeuronGenome(2);
+    auto data = DataDescription().addCells({
+        createConstructorCell(1, genome1),
+        createConstructorCell(2, genome2),
+        createConstructorCell(3, genome1),
+        CellDescription().setId(4),
+        createConstructorCell(5, genome1),
+    });
+
+    auto analytics = GenomeAnalytics::analyze(data);
+
+    EXPECT_EQ(4, analytics.numCellsWithGenome);
+    ASSERT_EQ(2, analytics.genomes.size());
+    EXPECT_EQ(std::vector<uint64_t>({1, 3, 5}), analytics.genomes.at(0).cellIds);
+    EXPECT_EQ(GenomeAnalytics::calcHash(genome1), analytics.genomes.at(0).hash);
+    EXPECT_EQ(5, analytics.genomes.at(0).numNodes);
+    EXPECT_EQ(toInt(genome1.size()), analytics.genomes.at(0).numBytes);
+    EXPECT_EQ(std::vector<uint64_t>({2}), analytics.genomes.at(1).cellIds);
+    EXPECT_EQ(2, analytics.genomes.at(1).numNodes);
+}
+
+TEST_F(GenomeAnalyticsTests, nodeCountsAndDepth)
+{
+    auto subGenome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+        CellGenomeDescription(),
+        CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setGenome(GenomeTestData::createNeuronGenome(3))),
+    }));
+    auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+        CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)),
+        CellGenomeDescription(),
+    }));
+
+    auto analytics = GenomeAnalytics::analyze(DataDescription().addCell(createConstructorCell(1, genome)));
+
+    ASSERT_EQ(1, analytics.genomes.size());
+    EXPECT_EQ(2, analytics.genomes.at(0).numNodes);
+    EXPECT_EQ(7, analytics.genomes.at(0).numNodesRecursively);
+    EXPECT_EQ(2, analytics.genomes.at(0).depth);
+}
+
+TEST_F(GenomeAnalyticsTests, similarityGroups)
+{
+    auto genome = GenomeTestData::createNeuronGenome(20);
+    auto mutatedGenome = genome;
+    mutatedGenome.at(mutatedGenome.size() / 2) ^= 0x55;
+    auto differentGenome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells(
+        std::vector<CellGenomeDescription>(20, CellGenomeDescription().setCellFunction(SensorGenomeDescription()).setColor(3))));
+
+    auto data = DataDescription().addCells({
+        createConstructorCell(1, genome),
+        createConstructorCell(2, genome),
+        createConstructorCell(3, mutatedGenome),
+        createConstructorCell(4, differentGenome),
+    });
+    auto analytics = GenomeAnalytics::analyze(data);
+
+    ASSERT_EQ(3, analytics.genomes.size());
+    EXPECT_EQ(2, analytics.numSimilarityGroups);
+    EXPECT_EQ(std::vector<uint64_t>({1, 2}), analytics.genomes.at(0).cellIds);
+    EXPECT_EQ(analytics.genomes.at(0).similarityGroup, analytics.genomes.at(1).similarityGroup);
+    EXPECT_NE(analytics.genomes.at(0).similarityGroup, analytics.genomes.at(2).similarityGroup);
+}
+
+TEST_F(GenomeAnalyticsTests, similarityGroups_similarSketchesBehindDissimilarBucketMember)
+{
+    //all sketches share the first band, b and c are similar but a is similar to neither of them
+    GenomeSketch a;
+    GenomeSketch b;
+    GenomeSketch c;
+    for (uint32_t i = 0; i < a.size(); ++i) {
+        a[i] = i < 4 ? i : 100 + i;
+        b[i] = i < 4 ? i : 200 + i;
+        c[i] = i < 4 ? i : 200 + i;
+    }
+    c[5] = 300;
+    c[9] = 300;
+    c[13] = 300;
+    ASSERT_LT(GenomeAnalytics::estimateSimilarity(a, b), 0.8f);
+    ASSERT_LT(GenomeAnalytics::estimateSimilarity(a, c), 0.8f);
+    ASSERT_GE(GenomeAnalytics::estimateSimilarity(b, c), 0.8f);
+
+    EXPECT_EQ(std::vector<int>({0, 1, 1}), GenomeAnalytics::calcSimilarityGroups({a, b, c}, 0.8f));
+    EXPECT_EQ(std::vector<int>({0, 0, 1}), GenomeAnalytics::calcSimilarityGroups({b, c, a}, 0.8f));
+}
+
+TEST_F(GenomeAnalyticsTests, estimateSimilarity)
+{
+    auto genome = GenomeTestData::createNeuronGenome(20);
+    auto sketch = GenomeAnalytics::calcSketch(genome);
+    EXPECT_EQ(1.0f, GenomeAnalytics::estimateSimilarity(sketch, sketch));
+
+    auto differentGenome = GenomeDescriptionConverter::convertDescriptionToBytes(
+        GenomeDescription().setCells(std::vector<CellGenomeDescription>(20, CellGenomeDescription().setCellFunction(NerveGenomeDescription()).setColor(3))));
+    EXPECT_LT(GenomeAnalytics::estimateSimilarity(sketch, GenomeAnalytics::calcSketch(differentGenome)), 0.5f);
+}
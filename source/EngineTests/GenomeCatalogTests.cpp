@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/GenomeCatalog.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/Serializer.h"
+
+#include "GenomeTestData.h"
+
+class GenomeCatalogTests : public ::testing::Test
+{
+public:
+    GenomeCatalogTests()
+        : _filename((std::filesystem::temp_directory_path() / "alien_genome_catalog_test.genomes").string())
+        , _directory(std::filesystem::temp_directory_path() / "alien_genome_catalog_test")
+    {}
+    virtual ~GenomeCatalogTests()
+    {
+        std::filesystem::remove(_filename);
+        std::filesystem::remove_all(_directory);
+    }
+
+protected:
+    std::string _filename;
+    std::filesystem::path _directory;
+
+    std::vector<NamedGenome> createGenomes() const
+    {
+        std::vector<NamedGenome> result;
+        for (int i = 0; i < 20; ++i) {
+            result.emplace_back(NamedGenome{.name = "genome " + std::to_string(i), .genome = GenomeTestData::createGenome(i % 4)});
+        }
+        return result;
+    }
+};
+
+TEST_F(GenomeCatalogTests, serializeAndDeserialize)
+{
+    auto genomes = createGenomes();
+    ASSERT_TRUE(GenomeCatalog::serializeCatalogToFile(_filename, genomes));
+
+    std::vector<GenomeCatalogEntry> entries;
+    ASSERT_TRUE(GenomeCatalog::deserializeIndexFromFile(entries, _filename));
+    ASSERT_EQ(genomes.size(), entries.size());
+
+    //random access in reverse order
+    for (int i = toInt(entries.size()) - 1; i >= 0; --i) {
+        auto const& entry = entries.at(i);
+        EXPECT_EQ(genomes.at(i).name, entry.name);
+        std::vector<uint8_t> genome;
+        ASSERT_TRUE(GenomeCatalog::deserializeGenomeFromFile(genome, _filename, entry));
+        EXPECT_EQ(genomes.at(i).genome, genome);
+    }
+}
+
+TEST_F(GenomeCatalogTests, metadata)
+{
+    auto entry = GenomeCatalog::createEntry("test", GenomeTestData::createGenome(2));
+    EXPECT_EQ(8, entry.numNodes);
+    EXPECT_EQ(56, entry.numNodesRecursively);
+    EXPECT_EQ(2, entry.depth);
+    EXPECT_EQ((1u << 7) - 1, entry.colors);
+    EXPECT_TRUE(entry.hasColor(4));
+    EXPECT_FALSE(entry.hasColor(7));
+}
+
+TEST_F(GenomeCatalogTests, identicalGenomesAreStoredOnce)
+{
+    auto genome = GenomeTestData::createGenome(3);
+    ASSERT_TRUE(GenomeCatalog::serializeCatalogToFile(_filename, {{"a", genome}, {"b", GenomeTestData::createGenome(0)}, {"c", genome}}));
+
+    std::vector<GenomeCatalogEntry> entries;
+    ASSERT_TRUE(GenomeCatalog::deserializeIndexFromFile(entries, _filename));
+    ASSERT_EQ(3, entries.size());
+    EXPECT_EQ(entries.at(0).offset, entries.at(2).offset);
+    EXPECT_NE(entries.at(0).offset, entries.at(1).offset);
+
+    std::vector<uint8_t> readGenome;
+    ASSERT_TRUE(GenomeCatalog::deserializeGenomeFromFile(readGenome, _filename, entries.at(2)));
+    EXPECT_EQ(genome, readGenome);
+}
+
+TEST_F(GenomeCatalogTests, corruptedGenomeIsDetected)
+{
+    ASSERT_TRUE(GenomeCatalog::serializeCatalogToFile(_filename, createGenomes()));
+    std::vector<GenomeCatalogEntry> entries;
+    ASSERT_TRUE(GenomeCatalog::deserializeIndexFromFile(entries, _filename));
+
+    auto const& entry = entries.at(5);
+    {
+        std::fstream stream(_filename, std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekp(entry.offset + entry.numBytes / 2);
+        stream.put(static_cast<char>(0xaa));
+    }
+    std::vector<uint8_t> genome;
+    EXPECT_FALSE(GenomeCatalog::deserializeGenomeFromFile(genome, _filename, entry));
+    EXPECT_TRUE(GenomeCatalog::deserializeGenomeFromFile(genome, _filename, entries.at(6)));
+}
+
+TEST_F(GenomeCatalogTests, invalidFile)
+{
+    {
+        std::ofstream stream(_filename, std::ios::binary);
+        stream << "no genome catalog";
+    }
+    std::vector<GenomeCatalogEntry> entries;
+    EXPECT_FALSE(GenomeCatalog::deserializeIndexFromFile(entries, _filename));
+    EXPECT_FALSE(GenomeCatalog::deserializeIndexFromFile(entries, _filename + ".missing"));
+}
+
+TEST_F(GenomeCatalogTests, convertGenomeDirectory)
+{
+    std::filesystem::create_directories(_directory);
+    auto genomes = createGenomes();
+    for (auto const& [name, genome] : genomes) {
+        ASSERT_TRUE(Serializer::serializeGenomeToFile((_directory / (name + ".genome")).string(), genome));
+    }
+    {
+        std::ofstream stream(_directory / "no genome.txt");
+        stream << "no genome";
+    }
+    ASSERT_TRUE(GenomeCatalog::convertGenomeDirectoryToCatalog(_filename, _directory.string()));
+
+    std::vector<GenomeCatalogEntry> entries;
+    ASSERT_TRUE(GenomeCatalog::deserializeIndexFromFile(entries, _filename));
+    ASSERT_EQ(genomes.size(), entries.size());
+
+    std::sort(genomes.begin(), genomes.end(), [](auto const& left, auto const& right) { return left.name < right.name; });
+    for (int i = 0; i < toInt(entries.size()); ++i) {
+        EXPECT_EQ(genomes.at(i).name, entries.at(i).name);
+        std::vector<uint8_t> genome;
+        ASSERT_TRUE(GenomeCatalog::deserializeGenomeFromFile(genome, _filename, entries.at(i)));
+        EXPECT_EQ(genomes.at(i).genome, genome);
+    }
+}
+
+TEST_F(GenomeCatalogTests, appendGenome)
+{
+    auto genomes = createGenomes();
+    ASSERT_TRUE(GenomeCatalog::serializeCatalogToFile(_filename, genomes));
+    std::vector<GenomeCatalogEntry> origEntries;
+    ASSERT_TRUE(GenomeCatalog::deserializeIndexFromFile(origEntries, _filename));
+
+    auto newGenome = GenomeTestData::createGenome(4);
+    ASSERT_TRUE(GenomeCatalog::appendGenomeToCatalog(_filename, {"new", newGenome}));
+    ASSERT_TRUE(GenomeCatalog::appendGenomeToCatalog(_filename, {"copy", genomes.at(1).genome}));
+
+    std::vector<GenomeCatalogEntry> entries;
+    ASSERT_TRUE(GenomeCatalog::deserializeIndexFromFile(entries, _filename));
+    ASSERT_EQ(genomes.size() + 2, entries.size());
+    EXPECT_EQ("new", entries.at(genomes.size()).name);
+    EXPECT_EQ("copy", entries.back().name);
+    EXPECT_EQ(origEntries.at(1).offset, entries.back().offset);
+
+    genomes.emplace_back(NamedGenome{.name = "new", .genome = newGenome});
+    genomes.emplace_back(NamedGenome{.name = "copy", .genome = genomes.at(1).genome});
+    for (int i = 0; i < toInt(entries.size()); ++i) {
+        std::vector<uint8_t> genome;
+        ASSERT_TRUE(GenomeCatalog::deserializeGenomeFromFile(genome, _filename, entries.at(i)));
+        EXPECT_EQ(genomes.at(i).genome, genome);
+    }
+}
+
+TEST_F(GenomeCatalogTests, negativeSizeIsRejected)
+{
+    ASSERT_TRUE(GenomeCatalog::serializeCatalogToFile(_filename, createGenomes()));
+    {
+        //numBytes of the first index entry follows its hash and offset
+        std::fstream stream(_filename, std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekg(16);
+        uint64_t indexOffset = 0;
+        for (int i = 0; i < 8; ++i) {
+            indexOffset |= static_cast<uint64_t>(static_cast<uint8_t>(stream.get())) << (8 * i);
+        }
+        stream.seekp(indexOffset + 16);
+        for (int i = 0; i < 4; ++i) {
+            stream.put(static_cast<char>(0xff));
+        }
+    }
+    std::vector<GenomeCatalogEntry> entries;
+    EXPECT_FALSE(GenomeCatalog::deserializeIndexFromFile(entries, _filename));
+
+    GenomeCatalogEntry entry;
+    entry.offset = 24;
+    entry.numBytes = -1;
+    std::vector<uint8_t> genome;
+    EXPECT_FALSE(GenomeCatalog::deserializeGenomeFromFile(genome, _filename, entry));
+}
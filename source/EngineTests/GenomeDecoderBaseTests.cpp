@@ -0,0 +1,168 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/GenomeDecoderBase.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/GenomeScanner.h"
+
+#include "GenomeTestData.h"
+
+class GenomeDecoderBaseTests : public ::testing::Test
+{
+public:
+    virtual ~GenomeDecoderBaseTests() = default;
+
+protected:
+    static auto constexpr NumFuzzedGenomes = 2000;
+
+    struct RandomGenerator
+    {
+        std::mt19937& engine;
+
+        int random(int maxValue) { return std::uniform_int_distribution<int>(0, maxValue)(engine); }
+        bool randomBool() { return random(1) == 0; }
+    };
+
+    std::mt19937 _engine{42};
+
+    std::vector<uint8_t> createRandomGenome(int depth)
+    {
+        auto numNodes = toInt(_engine() % 10);
+        std::vector<CellGenomeDescription> nodes;
+        for (int i = 0; i < numNodes; ++i) {
+            CellGenomeDescription node;
+            node.color = toInt(_engine() % MAX_COLORS);
+            switch (_engine() % 10) {
+            case 0:
+                node.setCellFunction(NeuronGenomeDescription());
+                break;
+            case 1:
+                node.setCellFunction(TransmitterGenomeDescription());
+                break;
+            case 2: {
+                ConstructorGenomeDescription constructor;
+                if (_engine() % 3 == 0) {
+                    constructor.setMakeGenomeCopy();
+                } else {
+                    constructor.setGenome(depth > 0 ? createRandomGenome(depth - 1) : std::vector<uint8_t>());
+                }
+                node.setCellFunction(constructor);
+            } break;
+            case 3:
+                node.setCellFunction(SensorGenomeDescription());
+                break;
+            case 4:
+                node.setCellFunction(NerveGenomeDescription());
+                break;
+            case 5:
+                node.setCellFunction(AttackerGenomeDescription());
+                break;
+            case 6: {
+                InjectorGenomeDescription injector;
+                if (_engine() % 3 == 0) {
+                    injector.setMakeGenomeCopy();
+                } else if (depth > 0) {
+                    injector.setGenome(createRandomGenome(depth - 1));
+                }
+                node.setCellFunction(injector);
+            } break;
+            case 7:
+                node.setCellFunction(MuscleGenomeDescription());
+                break;
+            case 8:
+                node.setCellFunction(DefenderGenomeDescription());
+                break;
+            default:
+                break;
+            }
+            nodes.emplace_back(node);
+        }
+        return GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells(nodes));
+    }
+
+    std::vector<std::pair<int, int>> getDepthsAndAddressesFromScanner(std::vector<uint8_t> const& genome) const
+    {
+        std::vector<std::pair<int, int>> result;
+        GenomeScanner::forEachNodeRecursively(genome, [&](GenomeNodeInfo const& node) { result.emplace_back(node.depth, node.address); });
+        return result;
+    }
+
+    std::vector<std::pair<int, int>> getDepthsAndAddressesFromDecoder(std::vector<uint8_t> const& genome) const
+    {
+        std::vector<std::pair<int, int>> result;
+        GenomeDecoderBase::executeForEachNodeRecursively(
+            genome.data(), toInt(genome.size()), [&](int depth, int nodeAddress) { result.emplace_back(depth, nodeAddress); });
+        return result;
+    }
+};
+
+TEST_F(GenomeDecoderBaseTests, nodesOfFuzzedGenomes)
+{
+    for (int i = 0; i < NumFuzzedGenomes; ++i) {
+        auto genome = createRandomGenome(2);
+        auto genomeSize = toInt(genome.size());
+        auto description = GenomeDescriptionConverter::convertBytesToDescription(genome);
+
+        ASSERT_EQ(toInt(description.cells.size()), GenomeDecoderBase::getNumNodes(genome.data(), genomeSize));
+        for (int nodeIndex = 0; nodeIndex < toInt(description.cells.size()); ++nodeIndex) {
+            auto const& node = description.cells.at(nodeIndex);
+            auto nodeAddress = GenomeDecoderBase::getNodeAddress(genome.data(), genomeSize, nodeIndex);
+            auto nextNodeAddress = GenomeDecoderBase::getNodeAddress(genome.data(), genomeSize, nodeIndex + 1);
+
+            EXPECT_EQ(GenomeDescriptionConverter::convertNodeIndexToNodeAddress(genome, nodeIndex), nodeAddress);
+            EXPECT_EQ(node.getCellFunctionType(), GenomeDecoderBase::getNextCellFunctionType(genome.data(), nodeAddress));
+            EXPECT_EQ(node.color, GenomeDecoderBase::getNextCellColor(genome.data(), nodeAddress));
+            EXPECT_EQ(node.isMakeGenomeCopy().value_or(false), GenomeDecoderBase::isNextCellSelfCopy(genome.data(), nodeAddress));
+            EXPECT_EQ(nodeAddress, GenomeDecoderBase::findStartNodeAddress(genome.data(), genomeSize, nodeAddress));
+            EXPECT_EQ(nodeAddress, GenomeDecoderBase::findStartNodeAddress(genome.data(), genomeSize, nextNodeAddress - 1));
+        }
+    }
+}
+
+TEST_F(GenomeDecoderBaseTests, recursiveTraversalOfFuzzedGenomes)
+{
+    for (int i = 0; i < NumFuzzedGenomes; ++i) {
+        auto genome = i % 2 == 0 ? createRandomGenome(3) : GenomeTestData::createRandomBytes(_engine);
+        auto genomeSize = toInt(genome.size());
+
+        EXPECT_EQ(getDepthsAndAddressesFromScanner(genome), getDepthsAndAddressesFromDecoder(genome));
+        EXPECT_EQ(GenomeDescriptionConverter::getNumNodesRecursively(genome), GenomeDecoderBase::getNumNodesRecursively(genome.data(), genomeSize));
+        EXPECT_EQ(GenomeNodeIndex(genome).getMaxDepth(), GenomeDecoderBase::getGenomeDepth(genome.data(), genomeSize));
+    }
+}
+
+TEST_F(GenomeDecoderBaseTests, truncatedGenomes)
+{
+    for (int i = 0; i < NumFuzzedGenomes / 10; ++i) {
+        auto genome = createRandomGenome(2);
+        for (int size = Const::GenomeHeaderSize; size <= toInt(genome.size()); ++size) {
+            std::vector<uint8_t> truncatedGenome(genome.begin(), genome.begin() + size);
+            EXPECT_EQ(GenomeScanner::getNumNodes(truncatedGenome), GenomeDecoderBase::getNumNodes(truncatedGenome.data(), size));
+            EXPECT_EQ(GenomeDescriptionConverter::getNumNodesRecursively(truncatedGenome), GenomeDecoderBase::getNumNodesRecursively(truncatedGenome.data(), size));
+        }
+    }
+}
+
+TEST_F(GenomeDecoderBaseTests, randomGenomeNodeAddress)
+{
+    RandomGenerator randomGenerator{_engine};
+    for (int i = 0; i < NumFuzzedGenomes; ++i) {
+        auto genome = createRandomGenome(3);
+        auto genomeSize = toInt(genome.size());
+        auto depthsAndAddresses = getDepthsAndAddressesFromScanner(genome);
+
+        int subGenomesSizeIndices[GenomeDecoderBase::MAX_SUBGENOME_RECURSION_DEPTH];
+        int numSubGenomesSizeIndices = 0;
+        auto nodeAddress =
+            GenomeDecoderBase::getRandomGenomeNodeAddress(randomGenerator, genome.data(), genomeSize, false, subGenomesSizeIndices, &numSubGenomesSizeIndices);
+
+        if (depthsAndAddresses.empty()) {
+            EXPECT_EQ(Const::GenomeHeaderSize, nodeAddress);
+            continue;
+        }
+        auto findResult = std::ranges::find_if(depthsAndAddresses, [&](auto const& depthAndAddress) { return depthAndAddress.second == nodeAddress; });
+        ASSERT_TRUE(findResult != depthsAndAddresses.end());
+        EXPECT_EQ(findResult->first, numSubGenomesSizeIndices);
+    }
+}
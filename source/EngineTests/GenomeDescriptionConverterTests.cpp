@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/GenomeDecoderBase.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+
+#include "GenomeTestData.h"
+
+class GenomeDescriptionConverterTests : public ::testing::Test
+{
+public:
+    virtual ~GenomeDescriptionConverterTests() = default;
+};
+
+TEST_F(GenomeDescriptionConverterTests, roundTrip)
+{
+    for (int depth = 0; depth <= 3; ++depth) {
+        auto genome = GenomeTestData::createGenomeDescription(depth);
+        auto data = GenomeDescriptionConverter::convertDescriptionToBytes(genome);
+        auto convertedGenome = GenomeDescriptionConverter::convertBytesToDescription(data);
+        ASSERT_EQ(genome.cells.size(), convertedGenome.cells.size());
+        for (size_t i = 0; i < genome.cells.size(); ++i) {
+            EXPECT_EQ(genome.cells.at(i).getGenome(), convertedGenome.cells.at(i).getGenome());
+        }
+        EXPECT_EQ(data, GenomeDescriptionConverter::convertDescriptionToBytes(convertedGenome));
+    }
+}
+
+TEST_F(GenomeDescriptionConverterTests, encodedSizeMatchesDecoder)
+{
+    auto data = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeTestData::createGenomeDescription(3));
+    auto genomeSize = toInt(data.size());
+
+    auto nodeAddress = Const::GenomeHeaderSize;
+    GenomeDecoderBase::executeForEachNode(data.data(), genomeSize, [&](int address) {
+        EXPECT_EQ(nodeAddress, address);
+        nodeAddress += Const::CellBasicBytes + GenomeDecoderBase::getNextCellFunctionDataSize(data.data(), genomeSize, address);
+    });
+    EXPECT_EQ(genomeSize, nodeAddress);
+}
+
+TEST_F(GenomeDescriptionConverterTests, truncatedSubGenome)
+{
+    auto data = GenomeDescriptionConverter::convertDescriptionToBytes(
+        GenomeDescription().setCells({CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(std::vector<uint8_t>(100, 1)))}));
+    data.resize(data.size() - 40);
+
+    auto genome = GenomeDescriptionConverter::convertBytesToDescription(data);
+    ASSERT_EQ(1, genome.cells.size());
+    EXPECT_EQ(60, genome.cells.front().getGenome()->size());
+}
+
+TEST_F(GenomeDescriptionConverterTests, truncatedNode)
+{
+    auto data = GenomeDescriptionConverter::convertDescriptionToBytes(
+        GenomeDescription().setCells({CellGenomeDescription().setCellFunction(NeuronGenomeDescription()).setColor(3)}));
+    data.resize(Const::GenomeHeaderSize + Const::CellBasicBytes + 10);
+
+    auto genome = GenomeDescriptionConverter::convertBytesToDescription(data);
+    ASSERT_EQ(1, genome.cells.size());
+    EXPECT_EQ(3, genome.cells.front().color);
+    auto const& neuron = std::get<NeuronGenomeDescription>(*genome.cells.front().cellFunction);
+    EXPECT_EQ(0.0f, neuron.biases[MAX_CHANNELS - 1]);
+}
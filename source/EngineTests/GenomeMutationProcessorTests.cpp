@@ -0,0 +1,131 @@
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+#include "Base/Parallel.h"
+#include "EngineInterface/GenomeDecoderBase.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/GenomeMutationProcessor.h"
+
+#include "GenomeTestData.h"
+
+class GenomeMutationProcessorTests : public ::testing::Test
+{
+public:
+    GenomeMutationProcessorTests()
+    {
+        _parameters.cellFunctionConstructorMutationSelfReplication = true;
+    }
+    virtual ~GenomeMutationProcessorTests() = default;
+
+protected:
+    static auto constexpr NumMutationTypes = static_cast<int>(MutationType::UniformColor) + 1;
+
+    SimulationParameters _parameters;
+
+    void allowOnlyColorTransitionsTo(int color)
+    {
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            for (int j = 0; j < MAX_COLORS; ++j) {
+                _parameters.cellFunctionConstructorMutationColorTransitions[i][j] = j == color;
+            }
+        }
+    }
+
+    bool isValid(std::vector<uint8_t> const& genome) const
+    {
+        return genome.size() >= Const::GenomeHeaderSize && genome.size() <= MAX_GENOME_BYTES && GenomeTestData::isConsistent(genome)
+            && GenomeDescriptionConverter::getNumNodesRecursively(genome) == GenomeDecoderBase::getNumNodesRecursively(genome.data(), toInt(genome.size()));
+    }
+};
+
+TEST_F(GenomeMutationProcessorTests, fuzzedMutationsKeepGenomesValid)
+{
+    auto constexpr NumGenomes = 16;
+    auto constexpr NumMutationsPerGenome = 300;
+
+    std::atomic<int> numInvalidGenomes = 0;
+    std::atomic<int> numInvalidReadPositions = 0;
+    Parallel::forEachChunk(NumGenomes, [&](int, int startIndex, int endIndex) {
+        for (int index = startIndex; index < endIndex; ++index) {
+            GenomeMutationRandomGenerator randomGenerator(index);
+            MutatedGenome target{.genome = GenomeTestData::createGenome(2), .color = 1};
+            for (int i = 0; i < NumMutationsPerGenome; ++i) {
+                auto type = static_cast<MutationType>(randomGenerator.random(NumMutationTypes - 1));
+                GenomeMutationProcessor::applyMutation(type, randomGenerator, _parameters, target);
+                if (!isValid(target.genome)) {
+                    ++numInvalidGenomes;
+                    break;
+                }
+                if (target.genomeReadPosition < 0 || target.genomeReadPosition > toInt(target.genome.size())) {
+                    ++numInvalidReadPositions;
+                    break;
+                }
+            }
+        }
+    });
+    EXPECT_EQ(0, numInvalidGenomes.load());
+    EXPECT_EQ(0, numInvalidReadPositions.load());
+}
+
+TEST_F(GenomeMutationProcessorTests, sameSeedGivesSameMutations)
+{
+    auto applyMutations = [&](uint64_t seed) {
+        GenomeMutationRandomGenerator randomGenerator(seed);
+        MutatedGenome target{.genome = GenomeTestData::createGenome(2)};
+        for (int i = 0; i < 1000; ++i) {
+            GenomeMutationProcessor::applyMutation(static_cast<MutationType>(i % NumMutationTypes), randomGenerator, _parameters, target);
+        }
+        return target.genome;
+    };
+    EXPECT_EQ(applyMutations(7), applyMutations(7));
+    EXPECT_NE(applyMutations(7), applyMutations(8));
+}
+
+TEST_F(GenomeMutationProcessorTests, insertAndDeleteMutation)
+{
+    GenomeMutationRandomGenerator randomGenerator(1);
+    for (int i = 0; i < 100; ++i) {
+        MutatedGenome target{.genome = GenomeTestData::createGenome(1)};
+        auto origGenome = target.genome;
+        auto origNumNodes = GenomeDecoderBase::getNumNodesRecursively(origGenome.data(), toInt(origGenome.size()));
+
+        GenomeMutationProcessor::insertMutation(randomGenerator, _parameters, target);
+        if (target.genome != origGenome) {
+            EXPECT_EQ(origNumNodes + 1, GenomeDecoderBase::getNumNodesRecursively(target.genome.data(), toInt(target.genome.size())));
+        }
+
+        origGenome = target.genome;
+        origNumNodes = GenomeDecoderBase::getNumNodesRecursively(origGenome.data(), toInt(origGenome.size()));
+        GenomeMutationProcessor::deleteMutation(randomGenerator, _parameters, target);
+        EXPECT_GE(origNumNodes - 1, GenomeDecoderBase::getNumNodesRecursively(target.genome.data(), toInt(target.genome.size())));
+        EXPECT_LT(target.genome.size(), origGenome.size());
+    }
+}
+
+TEST_F(GenomeMutationProcessorTests, uniformColorMutation)
+{
+    allowOnlyColorTransitionsTo(3);
+    GenomeMutationRandomGenerator randomGenerator(1);
+    MutatedGenome target{.genome = GenomeTestData::createGenome(2)};
+    GenomeMutationProcessor::uniformColorMutation(randomGenerator, _parameters, target);
+
+    GenomeDecoderBase::executeForEachNodeRecursively(target.genome.data(), toInt(target.genome.size()), [&](int depth, int nodeAddress) {
+        EXPECT_EQ(3, GenomeDecoderBase::getNextCellColor(target.genome.data(), nodeAddress));
+    });
+    EXPECT_TRUE(isValid(target.genome));
+}
+
+TEST_F(GenomeMutationProcessorTests, mutationIdChangesOnlyForSelfReplicators)
+{
+    allowOnlyColorTransitionsTo(3);
+    GenomeMutationRandomGenerator randomGenerator(1);
+    MutatedGenome selfReplicator{.genome = GenomeTestData::createGenome(1), .offspringMutationId = -1};
+    GenomeMutationProcessor::uniformColorMutation(randomGenerator, _parameters, selfReplicator);
+    EXPECT_NE(-1, selfReplicator.offspringMutationId);
+
+    auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({CellGenomeDescription().setColor(2)}));
+    MutatedGenome other{.genome = genome, .offspringMutationId = -1};
+    GenomeMutationProcessor::uniformColorMutation(randomGenerator, _parameters, other);
+    EXPECT_EQ(-1, other.offspringMutationId);
+}
@@ -0,0 +1,183 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeDecoderBase.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/GenomeMutationProcessor.h"
+#include "EngineInterface/GenomeOptimizer.h"
+
+#include "GenomeTestData.h"
+
+class GenomeOptimizerTests : public ::testing::Test
+{
+public:
+    GenomeOptimizerTests()
+    {
+        _parameters.cellFunctionConstructorMutationSelfReplication = true;
+    }
+    virtual ~GenomeOptimizerTests() = default;
+
+protected:
+    static auto constexpr NumFuzzedGenomes = 500;
+    static auto constexpr NumMutationTypes = static_cast<int>(MutationType::UniformColor) + 1;
+
+    SimulationParameters _parameters;
+    std::mt19937 _engine{42};
+
+    std::vector<uint8_t> createMutatedGenome(uint64_t seed) const
+    {
+        GenomeMutationRandomGenerator randomGenerator(seed);
+        MutatedGenome target{.genome = GenomeTestData::createGenome(2)};
+        for (int i = 0; i < 30; ++i) {
+            GenomeMutationProcessor::applyMutation(static_cast<MutationType>(randomGenerator.random(NumMutationTypes - 1)), randomGenerator, _parameters, target);
+        }
+        return target.genome;
+    }
+
+    //compares the decoded nodes of both genomes including their subgenomes
+    bool isSemanticallyEqual(std::vector<uint8_t> const& genome1, std::vector<uint8_t> const& genome2) const
+    {
+        auto description1 = GenomeDescriptionConverter::convertBytesToDescription(genome1);
+        auto description2 = GenomeDescriptionConverter::convertBytesToDescription(genome2);
+        if (description1.cells.size() != description2.cells.size()) {
+            return false;
+        }
+        if (!description1.cells.empty() && description1.info != description2.info) {
+            return false;
+        }
+        for (size_t i = 0; i < description1.cells.size(); ++i) {
+            auto cell1 = description1.cells.at(i);
+            auto cell2 = description2.cells.at(i);
+            auto subGenome1 = cell1.getGenome();
+            auto subGenome2 = cell2.getGenome();
+            if (subGenome1.has_value() != subGenome2.has_value()) {
+                return false;
+            }
+            if (subGenome1) {
+                if (!isSemanticallyEqual(*subGenome1, *subGenome2)) {
+                    return false;
+                }
+                cell1.setGenome({});
+                cell2.setGenome({});
+            }
+            if (cell1 != cell2) {
+                return false;
+            }
+        }
+        return GenomeDecoderBase::getNumNodesRecursively(genome1.data(), toInt(genome1.size()))
+            == GenomeDecoderBase::getNumNodesRecursively(genome2.data(), toInt(genome2.size()));
+    }
+
+    void checkOptimization(std::vector<uint8_t> const& genome) const
+    {
+        auto optimizedGenome = GenomeOptimizer::optimize(genome);
+        EXPECT_TRUE(isSemanticallyEqual(genome, optimizedGenome));
+        EXPECT_LE(optimizedGenome.size(), genome.size());
+        auto validationResult = GenomeOptimizer::validate(optimizedGenome);
+        EXPECT_EQ(0, validationResult.numNonCanonicalBytes);
+        EXPECT_EQ(0, validationResult.numIncompleteHeaders);
+        EXPECT_EQ(optimizedGenome, GenomeOptimizer::optimize(optimizedGenome));
+        if (GenomeOptimizer::validate(genome).isCanonical()) {
+            EXPECT_EQ(genome, optimizedGenome);
+        }
+    }
+};
+
+TEST_F(GenomeOptimizerTests, convertedGenomesAreCanonical)
+{
+    auto genome = GenomeTestData::createGenome(3);
+    auto validationResult = GenomeOptimizer::validate(genome);
+    EXPECT_TRUE(validationResult.isCanonical());
+    EXPECT_EQ(genome, GenomeOptimizer::optimize(genome));
+}
+
+TEST_F(GenomeOptimizerTests, nonCanonicalBytes)
+{
+    auto genome = GenomeTestData::createGenome(0);
+    genome[Const::GenomeHeaderSize + Const::CellColorPos] += MAX_COLORS;
+    genome[Const::GenomeHeaderSize] += CellFunction_Count;
+
+    auto validationResult = GenomeOptimizer::validate(genome);
+    EXPECT_TRUE(validationResult.isValid());
+    EXPECT_EQ(2, validationResult.numNonCanonicalBytes);
+
+    auto optimizedGenome = GenomeOptimizer::optimize(genome);
+    EXPECT_EQ(GenomeTestData::createGenome(0), optimizedGenome);
+}
+
+TEST_F(GenomeOptimizerTests, truncatedGenomes)
+{
+    auto genome = GenomeTestData::createGenome(2);
+    for (int size = Const::GenomeHeaderSize; size <= toInt(genome.size()); ++size) {
+        std::vector<uint8_t> truncatedGenome(genome.begin(), genome.begin() + size);
+        auto isNodeBoundary = GenomeDecoderBase::findStartNodeAddress(genome.data(), toInt(genome.size()), size) == size || size == toInt(genome.size());
+        if (!isNodeBoundary) {
+            EXPECT_FALSE(GenomeOptimizer::validate(truncatedGenome).isValid());
+        }
+        checkOptimization(truncatedGenome);
+    }
+}
+
+TEST_F(GenomeOptimizerTests, incompleteSubGenomeHeader)
+{
+    auto incompleteSubGenome = std::vector<uint8_t>(Const::GenomeHeaderSize - 2, 1);
+    auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(
+        GenomeDescription().setCells({CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(incompleteSubGenome))}));
+
+    auto validationResult = GenomeOptimizer::validate(genome);
+    EXPECT_FALSE(validationResult.isValid());
+    EXPECT_EQ(1, validationResult.numIncompleteHeaders);
+    EXPECT_EQ(Const::GenomeHeaderSize - 2, validationResult.numUnreachableBytes);
+
+    auto optimizedGenome = GenomeOptimizer::optimize(genome);
+    EXPECT_EQ(genome.size() - incompleteSubGenome.size(), optimizedGenome.size());
+    checkOptimization(genome);
+}
+
+TEST_F(GenomeOptimizerTests, fuzzedGenomes)
+{
+    for (int i = 0; i < NumFuzzedGenomes; ++i) {
+        checkOptimization(i % 2 == 0 ? createMutatedGenome(i) : GenomeTestData::createRandomBytes(_engine));
+    }
+}
+
+TEST_F(GenomeOptimizerTests, massOperation)
+{
+    auto genome = GenomeTestData::createGenome(1);
+    auto nodeAddress = GenomeDescriptionConverter::convertNodeIndexToNodeAddress(genome, 3);
+    auto incompleteSubGenome = std::vector<uint8_t>(Const::GenomeHeaderSize - 2, 1);
+    auto genomeWithIncompleteHeader = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+        CellGenomeDescription().setCellFunction(NeuronGenomeDescription()),
+        CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setGenome(incompleteSubGenome)),
+        CellGenomeDescription().setCellFunction(SensorGenomeDescription()),
+        CellGenomeDescription().setCellFunction(MuscleGenomeDescription()),
+    }));
+    auto nodeAddressAfterIncompleteHeader = GenomeDescriptionConverter::convertNodeIndexToNodeAddress(genomeWithIncompleteHeader, 2);
+
+    ClusteredDataDescription data;
+    data.addCluster(ClusterDescription().addCells({
+        CellDescription().setId(1).setCellFunction(ConstructorDescription().setGenome(genome).setGenomeReadPosition(nodeAddress)),
+        CellDescription().setId(2).setCellFunction(ConstructorDescription().setGenome(genome)),
+        CellDescription()
+            .setId(3)
+            .setCellFunction(ConstructorDescription().setGenome(genomeWithIncompleteHeader).setGenomeReadPosition(nodeAddressAfterIncompleteHeader)),
+        CellDescription().setId(4).setCellFunction(NerveDescription()),
+    }));
+    auto statistics = GenomeOptimizer::optimize(data);
+
+    EXPECT_EQ(3, statistics.numGenomes);
+    EXPECT_EQ(2, statistics.numDistinctGenomes);
+    EXPECT_EQ(1, statistics.numInvalidGenomes);
+    EXPECT_EQ(1, statistics.numChangedGenomes);
+    EXPECT_EQ(statistics.numBytesBefore - incompleteSubGenome.size(), statistics.numBytesAfter);
+
+    auto const& cells = data.clusters.front().cells;
+    auto const& constructor1 = std::get<ConstructorDescription>(*cells.at(0).cellFunction);
+    auto const& constructor3 = std::get<ConstructorDescription>(*cells.at(2).cellFunction);
+    EXPECT_EQ(genome, constructor1.genome);
+    EXPECT_EQ(nodeAddress, constructor1.genomeReadPosition);
+    EXPECT_EQ(genomeWithIncompleteHeader.size() - incompleteSubGenome.size(), constructor3.genome.size());
+    EXPECT_EQ(GenomeDescriptionConverter::convertNodeIndexToNodeAddress(constructor3.genome, 2), constructor3.genomeReadPosition);
+}
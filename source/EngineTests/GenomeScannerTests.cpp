@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/GenomeScanner.h"
+
+class GenomeScannerTests : public ::testing::Test
+{
+public:
+    virtual ~GenomeScannerTests() = default;
+
+protected:
+    std::vector<uint8_t> createNestedGenome() const
+    {
+        auto subSubGenome = GenomeDescriptionConverter::convertDescriptionToBytes(
+            GenomeDescription().setCells({CellGenomeDescription(), CellGenomeDescription().setCellFunction(NeuronGenomeDescription())}));
+        auto subGenome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+            CellGenomeDescription().setCellFunction(SensorGenomeDescription()),
+            CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setGenome(subSubGenome)),
+            CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setMakeGenomeCopy()),
+        }));
+        return GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+            CellGenomeDescription().setCellFunction(NeuronGenomeDescription()),
+            CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)),
+            CellGenomeDescription().setCellFunction(NerveGenomeDescription()),
+            CellGenomeDescription(),
+        }));
+    }
+};
+
+TEST_F(GenomeScannerTests, numNodes)
+{
+    auto genome = createNestedGenome();
+
+    EXPECT_EQ(4, GenomeScanner::getNumNodes(genome));
+    EXPECT_EQ(9, GenomeScanner::getNumNodesRecursively(genome));
+    EXPECT_EQ(9, GenomeDescriptionConverter::getNumNodesRecursively(genome));
+}
+
+TEST_F(GenomeScannerTests, nodeAddressAndIndex)
+{
+    auto genome = createNestedGenome();
+    auto description = GenomeDescriptionConverter::convertBytesToDescription(genome);
+
+    auto expectedAddress = Const::GenomeHeaderSize;
+    for (int nodeIndex = 0; nodeIndex < toInt(description.cells.size()); ++nodeIndex) {
+        EXPECT_EQ(expectedAddress, GenomeScanner::getNodeAddress(genome, nodeIndex));
+        EXPECT_EQ(nodeIndex, GenomeScanner::getNodeIndex(genome, expectedAddress));
+        EXPECT_EQ(nodeIndex + 1, GenomeScanner::getNodeIndex(genome, expectedAddress + 1));
+
+        GenomeDescription singleNode;
+        singleNode.cells = {description.cells.at(nodeIndex)};
+        expectedAddress += toInt(GenomeDescriptionConverter::convertDescriptionToBytes(singleNode).size()) - Const::GenomeHeaderSize;
+    }
+    EXPECT_EQ(toInt(genome.size()), expectedAddress);
+    EXPECT_EQ(toInt(genome.size()), GenomeScanner::getNodeAddress(genome, 100));
+    EXPECT_EQ(4, GenomeScanner::getNodeIndex(genome, toInt(genome.size())));
+}
+
+TEST_F(GenomeScannerTests, nodeIndex)
+{
+    auto genome = createNestedGenome();
+    GenomeNodeIndex index(genome);
+
+    EXPECT_EQ(4, index.getNumNodes());
+    EXPECT_EQ(9, index.getNumNodesRecursively());
+    EXPECT_EQ(2, index.getMaxDepth());
+    for (int nodeIndex = 0; nodeIndex <= index.getNumNodes(); ++nodeIndex) {
+        auto nodeAddress = GenomeScanner::getNodeAddress(genome, nodeIndex);
+        EXPECT_EQ(nodeAddress, index.getNodeAddress(nodeIndex));
+        EXPECT_EQ(nodeIndex, index.getNodeIndex(nodeAddress));
+    }
+
+    auto const& nodes = index.getNodes();
+    EXPECT_EQ(CellFunction_Constructor, nodes.at(1).cellFunction);
+    EXPECT_TRUE(nodes.at(1).hasSubGenome());
+    EXPECT_EQ(CellFunction_Sensor, nodes.at(4).cellFunction);
+    EXPECT_EQ(nodes.at(1).subGenomeAddress + Const::GenomeHeaderSize, nodes.at(4).address);
+    EXPECT_EQ(1, nodes.at(4).depth);
+    EXPECT_EQ(2, nodes.at(6).depth);
+    EXPECT_FALSE(nodes.at(8).hasSubGenome());
+}
+
+TEST_F(GenomeScannerTests, truncatedGenome)
+{
+    auto genome = createNestedGenome();
+    for (int size = 0; size < toInt(genome.size()); ++size) {
+        std::vector<uint8_t> truncatedGenome(genome.begin(), genome.begin() + size);
+        auto description = GenomeDescriptionConverter::convertBytesToDescription(truncatedGenome);
+        EXPECT_EQ(toInt(description.cells.size()), GenomeScanner::getNumNodes(truncatedGenome));
+        EXPECT_EQ(size, GenomeScanner::getNodeAddress(truncatedGenome, 100));
+    }
+}
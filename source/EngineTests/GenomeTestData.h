@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "EngineInterface/GenomeDescriptionConverter.h"
+
+//genomes for the host-side genome tests and benchmarks
+class GenomeTestData
+{
+public:
+    //genome covering all kinds of subgenome references whose constructor and injector carry the genome of the next lower level
+    static GenomeDescription createGenomeDescription(int depth)
+    {
+        auto subGenome = depth > 0 ? GenomeDescriptionConverter::convertDescriptionToBytes(createGenomeDescription(depth - 1)) : std::vector<uint8_t>();
+        return GenomeDescription().setInfo(GenomeHeaderDescription().setSingleConstruction(true)).setCells({
+            CellGenomeDescription().setCellFunction(NeuronGenomeDescription()).setColor(1).setInputExecutionOrderNumber(2),
+            CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)).setColor(2),
+            CellGenomeDescription().setCellFunction(SensorGenomeDescription().setFixedAngle(90.0f)).setColor(3),
+            CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setMakeGenomeCopy()).setColor(4),
+            CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setGenome(subGenome)).setColor(5),
+            CellGenomeDescription().setCellFunction(NerveGenomeDescription()).setColor(6),
+            CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setMakeGenomeCopy()),
+            CellGenomeDescription(),
+        });
+    }
+
+    static std::vector<uint8_t> createGenome(int depth) { return GenomeDescriptionConverter::convertDescriptionToBytes(createGenomeDescription(depth)); }
+
+    static std::vector<uint8_t> createNeuronGenome(int numNodes)
+    {
+        return GenomeDescriptionConverter::convertDescriptionToBytes(
+            GenomeDescription().setCells(std::vector<CellGenomeDescription>(numNodes, CellGenomeDescription().setCellFunction(NeuronGenomeDescription()))));
+    }
+
+    static std::vector<uint8_t> createRandomBytes(std::mt19937& engine)
+    {
+        std::vector<uint8_t> result(engine() % 300);
+        for (auto& byte : result) {
+            byte = static_cast<uint8_t>(engine());
+        }
+        return result;
+    }
+
+    //a genome is consistent if each (sub)genome is encoded again with the same number of bytes after a round trip through the descriptions
+    static bool isConsistent(std::vector<uint8_t> const& genome)
+    {
+        auto description = GenomeDescriptionConverter::convertBytesToDescription(genome);
+        if (GenomeDescriptionConverter::convertDescriptionToBytes(description).size() != genome.size()) {
+            return false;
+        }
+        for (auto const& cell : description.cells) {
+            if (auto subGenome = cell.getGenome(); subGenome && !subGenome->empty() && !isConsistent(*subGenome)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
@@ -6,9 +6,12 @@
 #include "EngineInterface/SimulationParameters.h"
 #include "EngineImpl/SimulationControllerImpl.h"
 
-IntegrationTestFramework::IntegrationTestFramework(std::optional<SimulationParameters> const& parameters_, IntVector2D const& universeSize)
+IntegrationTestFramework::IntegrationTestFramework(
+    std::optional<SimulationParameters> const& parameters_,
+    IntVector2D const& universeSize,
+    SimulationBackend backend)
 {
-    _simController = std::make_shared<_SimulationControllerImpl>();
+    _simController = std::make_shared<_SimulationControllerImpl>(backend);
     GeneralSettings generalSettings{universeSize.x, universeSize.y};
     SimulationParameters parameters;
     if (parameters_) {
@@ -27,6 +30,20 @@ IntegrationTestFramework::~IntegrationTestFramework()
     _simController->closeSimulation();
 }
 
+std::vector<SimulationBackend> IntegrationTestFramework::getBackends()
+{
+#ifdef ALIEN_CUDA
+    return {SimulationBackend_Cuda, SimulationBackend_Cpu};
+#else
+    return {SimulationBackend_Cpu};
+#endif
+}
+
+std::string IntegrationTestFramework::getBackendName(::testing::TestParamInfo<SimulationBackend> const& info)
+{
+    return info.param == SimulationBackend_Cpu ? "Cpu" : "Cuda";
+}
+
 double IntegrationTestFramework::getEnergy(DataDescription const& data) const
 {
     double result = 0;
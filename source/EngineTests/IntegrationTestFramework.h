@@ -1,18 +1,29 @@
 #pragma once
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "Base/Definitions.h"
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SimulationBackend.h"
 #include "EngineInterface/SimulationParameters.h"
 
 class IntegrationTestFramework : public ::testing::Test
 {
 public:
-    IntegrationTestFramework(std::optional<SimulationParameters> const& parameters = std::nullopt, IntVector2D const& universeSize = IntVector2D{1000, 1000});
+    IntegrationTestFramework(
+        std::optional<SimulationParameters> const& parameters = std::nullopt,
+        IntVector2D const& universeSize = IntVector2D{1000, 1000},
+        SimulationBackend backend = DefaultSimulationBackend);
     virtual ~IntegrationTestFramework();
 
+    //suites which run on all backends derive from ::testing::WithParamInterface<SimulationBackend> as well, use TEST_P and
+    //INSTANTIATE_TEST_SUITE_P(Backends, <suite>, ::testing::ValuesIn(IntegrationTestFramework::getBackends()), IntegrationTestFramework::getBackendName)
+    static std::vector<SimulationBackend> getBackends();  //the CUDA backend is only included if the tests are built with the CUDA toolkit
+    static std::string getBackendName(::testing::TestParamInfo<SimulationBackend> const& info);
+
 protected:
     double getEnergy(DataDescription const& data) const;
 
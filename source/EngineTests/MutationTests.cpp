@@ -10,7 +10,9 @@
 #include "EngineInterface/DescriptionHelper.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/SimulationController.h"
+#include "EngineInterface/GenomeDecoderBase.h"
 #include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/ShapeGenerator.h"
 
 #include "IntegrationTestFramework.h"
 
@@ -115,6 +117,23 @@ protected:
         }));
     }
 
+    //subgenomes without complete header (as produced by the editor for empty injector genomes) contain no nodes
+    std::vector<uint8_t> createGenomeWithEmptySubGenomes() const
+    {
+        auto subGenome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+            CellGenomeDescription().setCellFunction(NeuronGenomeDescription()).setColor(genomeCellColors[1]),
+            CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setGenome({})).setColor(genomeCellColors[2]),
+            CellGenomeDescription().setCellFunction(NerveGenomeDescription()).setColor(genomeCellColors[1]),
+        }));
+        return GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+            CellGenomeDescription().setCellFunction(NeuronGenomeDescription()).setColor(genomeCellColors[0]),
+            CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setGenome({})).setColor(genomeCellColors[0]),
+            CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)).setColor(genomeCellColors[0]),
+            CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setGenome(std::vector<uint8_t>(3, 0))).setColor(genomeCellColors[2]),
+            CellGenomeDescription().setCellFunction(SensorGenomeDescription()).setColor(genomeCellColors[1]),
+        }));
+    }
+
     void rollout(GenomeDescription const& input, std::set<CellGenomeDescription>& result)
     {
         for (auto const& cell : input.cells) {
@@ -662,6 +681,45 @@ TEST_F(MutationTests, geometryMutation)
     EXPECT_EQ(byteIndex, actualConstructor.genomeReadPosition);
 }
 
+TEST_F(MutationTests, geometryMutation_toCustomShape)
+{
+    auto const numNodes = 12;
+    std::vector<CellGenomeDescription> cells(numNodes, CellGenomeDescription().setCellFunction(NeuronGenomeDescription()));
+    GenomeHeaderDescription header;
+    header.shape = ConstructionShape_Hexagon;
+    auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setInfo(header).setCells(cells));
+
+    auto data = DataDescription().addCells(
+        {CellDescription().setId(1).setCellFunction(ConstructorDescription().setGenome(genome).setGenomeReadPosition(0)).setExecutionOrderNumber(0)});
+
+    _simController->setSimulationData(data);
+    auto actualGenome = genome;
+    ConstructionShape origShape = ConstructionShape_Hexagon;
+    for (int i = 0; i < 10000; ++i) {
+        origShape = actualGenome[Const::GenomeHeaderShapePos] % ConstructionShape_Count;
+        _simController->testOnly_mutate(1, MutationType::Geometry);
+        auto actualCellById = getCellById(_simController->getSimulationData());
+        actualGenome = std::get<ConstructorDescription>(*actualCellById.at(1).cellFunction).genome;
+        if (actualGenome[Const::GenomeHeaderShapePos] % ConstructionShape_Count == ConstructionShape_Custom) {
+            break;
+        }
+    }
+    ASSERT_EQ(ConstructionShape_Custom, actualGenome[Const::GenomeHeaderShapePos] % ConstructionShape_Count);
+    ASSERT_NE(ConstructionShape_Custom, origShape);
+    ASSERT_EQ(genome.size(), actualGenome.size());
+
+    //all nodes including the first one continue the former shape
+    auto nodeAddress = Const::GenomeHeaderSize;
+    for (int i = 0; i < numNodes; ++i) {
+        auto generationResult = ShapeTables::getConstructionData(origShape, i);
+        EXPECT_EQ(GenomeDecoderBase::convertAngleToByte(generationResult.angle), actualGenome[nodeAddress + Const::CellAnglePos]);
+        EXPECT_EQ(
+            GenomeDecoderBase::convertOptionalByteToByte(generationResult.numRequiredAdditionalConnections.value_or(-1)),
+            actualGenome[nodeAddress + Const::CellRequiredConnectionsPos]);
+        nodeAddress += Const::CellBasicBytes + Const::NeuronBytes;
+    }
+}
+
 TEST_F(MutationTests, individualGeometryMutation)
 {
     auto genome = createGenomeWithMultipleCellsWithDifferentFunctions();
@@ -683,6 +741,44 @@ TEST_F(MutationTests, individualGeometryMutation)
     EXPECT_EQ(byteIndex, actualConstructor.genomeReadPosition);
 }
 
+TEST_F(MutationTests, propertiesMutation_emptySubGenomes)
+{
+    auto genome = createGenomeWithEmptySubGenomes();
+
+    auto data = DataDescription().addCells(
+        {CellDescription().setId(1).setCellFunction(ConstructorDescription().setGenome(genome).setGenomeReadPosition(0)).setExecutionOrderNumber(0)});
+
+    _simController->setSimulationData(data);
+    for (int i = 0; i < 10000; ++i) {
+        _simController->testOnly_mutate(1, MutationType::Properties);
+    }
+
+    auto actualData = _simController->getSimulationData();
+    auto actualCellById = getCellById(actualData);
+
+    auto actualConstructor = std::get<ConstructorDescription>(*actualCellById.at(1).cellFunction);
+    EXPECT_TRUE(comparePropertiesMutation(genome, actualConstructor.genome));
+}
+
+TEST_F(MutationTests, individualGeometryMutation_emptySubGenomes)
+{
+    auto genome = createGenomeWithEmptySubGenomes();
+
+    auto data = DataDescription().addCells(
+        {CellDescription().setId(1).setCellFunction(ConstructorDescription().setGenome(genome).setGenomeReadPosition(0)).setExecutionOrderNumber(0)});
+
+    _simController->setSimulationData(data);
+    for (int i = 0; i < 10000; ++i) {
+        _simController->testOnly_mutate(1, MutationType::CustomGeometry);
+    }
+
+    auto actualData = _simController->getSimulationData();
+    auto actualCellById = getCellById(actualData);
+
+    auto actualConstructor = std::get<ConstructorDescription>(*actualCellById.at(1).cellFunction);
+    EXPECT_TRUE(compareIndividualGeometryMutation(genome, actualConstructor.genome));
+}
+
 TEST_F(MutationTests, cellFunctionMutation)
 {
     auto genome = createGenomeWithMultipleCellsWithDifferentFunctions();
@@ -5,17 +5,21 @@
 #include "EngineInterface/SimulationController.h"
 #include "IntegrationTestFramework.h"
 
-class NerveTests : public IntegrationTestFramework
+class NerveTests
+    : public ::testing::WithParamInterface<SimulationBackend>
+    , public IntegrationTestFramework
 {
 public:
     NerveTests()
-        : IntegrationTestFramework()
+        : IntegrationTestFramework(std::nullopt, IntVector2D{1000, 1000}, GetParam())
     {}
 
     ~NerveTests() = default;
 };
 
-TEST_F(NerveTests, noInput_execution)
+INSTANTIATE_TEST_SUITE_P(Backends, NerveTests, ::testing::ValuesIn(IntegrationTestFramework::getBackends()), IntegrationTestFramework::getBackendName);
+
+TEST_P(NerveTests, noInput_execution)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -38,7 +42,7 @@ TEST_F(NerveTests, noInput_execution)
     EXPECT_EQ(ActivityDescription(), actualCellById.at(1).activity);
 }
 
-TEST_F(NerveTests, noInput_noExecution)
+TEST_P(NerveTests, noInput_noExecution)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -61,7 +65,7 @@ TEST_F(NerveTests, noInput_noExecution)
     EXPECT_EQ(activity, actualCellById.at(1).activity);
 }
 
-TEST_F(NerveTests, inputBlocked)
+TEST_P(NerveTests, inputBlocked)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -95,7 +99,7 @@ TEST_F(NerveTests, inputBlocked)
     }
 }
 
-TEST_F(NerveTests, outputBlocked)
+TEST_P(NerveTests, outputBlocked)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -131,7 +135,7 @@ TEST_F(NerveTests, outputBlocked)
     }
 }
 
-TEST_F(NerveTests, underConstruction1)
+TEST_P(NerveTests, underConstruction1)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -167,7 +171,7 @@ TEST_F(NerveTests, underConstruction1)
     }
 }
 
-TEST_F(NerveTests, underConstruction2)
+TEST_P(NerveTests, underConstruction2)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -203,7 +207,7 @@ TEST_F(NerveTests, underConstruction2)
     }
 }
 
-TEST_F(NerveTests, transfer)
+TEST_P(NerveTests, transfer)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -267,7 +271,7 @@ TEST_F(NerveTests, transfer)
 }
 
 
-TEST_F(NerveTests, cycle)
+TEST_P(NerveTests, cycle)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -367,7 +371,7 @@ TEST_F(NerveTests, cycle)
     }
 }
 
-TEST_F(NerveTests, fork)
+TEST_P(NerveTests, fork)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -411,7 +415,7 @@ TEST_F(NerveTests, fork)
     }
 }
 
-TEST_F(NerveTests, noFork)
+TEST_P(NerveTests, noFork)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -449,7 +453,7 @@ TEST_F(NerveTests, noFork)
     }
 }
 
-TEST_F(NerveTests, merge)
+TEST_P(NerveTests, merge)
 {
     ActivityDescription activity1, activity2, sumActivity;
     activity1.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -495,7 +499,7 @@ TEST_F(NerveTests, merge)
     }
 }
 
-TEST_F(NerveTests, sameExecutionOrderNumber)
+TEST_P(NerveTests, sameExecutionOrderNumber)
 {
     ActivityDescription activity;
     activity.channels = {1, 0, -1, 0, 0, 0, 0, 0};
@@ -530,7 +534,7 @@ TEST_F(NerveTests, sameExecutionOrderNumber)
     }
 }
 
-TEST_F(NerveTests, constantPulse)
+TEST_P(NerveTests, constantPulse)
 {
     auto data = DataDescription().addCells({
         CellDescription()
@@ -566,7 +570,7 @@ TEST_F(NerveTests, constantPulse)
     }
 }
 
-TEST_F(NerveTests, alternatingPulse)
+TEST_P(NerveTests, alternatingPulse)
 {
     auto data = DataDescription().addCells(
         {CellDescription()
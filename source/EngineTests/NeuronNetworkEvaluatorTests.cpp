@@ -0,0 +1,118 @@
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/NeuronNetworkEvaluator.h"
+
+class NeuronNetworkEvaluatorTests : public ::testing::Test
+{
+public:
+    virtual ~NeuronNetworkEvaluatorTests() = default;
+
+protected:
+    std::mt19937 _randomEngine{42};
+
+    NeuronDescription createRandomNeuron()
+    {
+        std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+        NeuronDescription result;
+        for (int row = 0; row < MAX_CHANNELS; ++row) {
+            for (int col = 0; col < MAX_CHANNELS; ++col) {
+                result.weights[row][col] = distribution(_randomEngine);
+            }
+            result.biases[row] = distribution(_randomEngine);
+        }
+        return result;
+    }
+
+    std::vector<float> createRandomInputs(int numNetworks)
+    {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        std::vector<float> result(numNetworks * MAX_CHANNELS);
+        for (auto& value : result) {
+            value = distribution(_randomEngine);
+        }
+        return result;
+    }
+
+    //straightforward evaluation as in NeuronProcessor
+    std::vector<float> evaluate(NeuronDescription const& neuron, float const* input) const
+    {
+        std::vector<float> result(MAX_CHANNELS);
+        for (int row = 0; row < MAX_CHANNELS; ++row) {
+            auto sum = neuron.biases[row];
+            for (int col = 0; col < MAX_CHANNELS; ++col) {
+                sum += neuron.weights[row][col] * input[col];
+            }
+            result[row] = 2.0f / (1.0f + std::exp(-sum)) - 1.0f;
+        }
+        return result;
+    }
+};
+
+TEST_F(NeuronNetworkEvaluatorTests, weight)
+{
+    NeuronDescription neuron;
+    neuron.weights[2][3] = 1;
+    neuron.weights[2][7] = 0.5f;
+    neuron.weights[5][3] = -3.5f;
+    neuron.biases[0] = 1;
+
+    NeuronNetworkEvaluator evaluator;
+    evaluator.addNetwork(neuron);
+    std::vector<float> inputs = {0, 0, 0, 1, 0, 0, 0, 0.5f};
+    std::vector<float> outputs(MAX_CHANNELS);
+    evaluator.evaluate(inputs, outputs);
+
+    auto scaledSigmoid = NeuronNetworkEvaluator::scaledSigmoid;
+    std::vector<float> expectedOutputs = {scaledSigmoid(1), 0, scaledSigmoid(1.0f + 0.5f * 0.5f), 0, 0, scaledSigmoid(-3.5f), 0, 0};
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        EXPECT_NEAR(expectedOutputs.at(i), outputs.at(i), 1e-6f);
+    }
+}
+
+TEST_F(NeuronNetworkEvaluatorTests, batchMatchesSingleEvaluation)
+{
+    //number of networks is not a multiple of the block size
+    auto numNetworks = NeuronNetworkEvaluator::BlockSize * 100 + 3;
+
+    NeuronNetworkEvaluator evaluator;
+    std::vector<NeuronDescription> neurons;
+    for (int i = 0; i < numNetworks; ++i) {
+        neurons.emplace_back(createRandomNeuron());
+        EXPECT_EQ(i, evaluator.addNetwork(neurons.back()));
+    }
+    auto inputs = createRandomInputs(numNetworks);
+    std::vector<float> outputs(numNetworks * MAX_CHANNELS);
+    evaluator.evaluate(inputs, outputs);
+
+    for (int i = 0; i < numNetworks; ++i) {
+        auto expectedOutputs = evaluate(neurons.at(i), inputs.data() + i * MAX_CHANNELS);
+        for (int j = 0; j < MAX_CHANNELS; ++j) {
+            ASSERT_NEAR(expectedOutputs.at(j), outputs.at(i * MAX_CHANNELS + j), 1e-5f);
+        }
+    }
+}
+
+TEST_F(NeuronNetworkEvaluatorTests, sequenceMatchesSingleEvaluation)
+{
+    NeuronNetworkEvaluator evaluator;
+    std::vector<NeuronDescription> neurons;
+    for (int i = 0; i < 10; ++i) {
+        neurons.emplace_back(createRandomNeuron());
+        evaluator.addNetwork(neurons.back());
+    }
+
+    auto numSteps = 1000;
+    auto inputs = createRandomInputs(numSteps);
+    std::vector<float> outputs(numSteps * MAX_CHANNELS);
+    evaluator.evaluateSequence(9, inputs, outputs);
+
+    for (int step = 0; step < numSteps; ++step) {
+        auto expectedOutputs = evaluate(neurons.at(9), inputs.data() + step * MAX_CHANNELS);
+        for (int j = 0; j < MAX_CHANNELS; ++j) {
+            ASSERT_NEAR(expectedOutputs.at(j), outputs.at(step * MAX_CHANNELS + j), 1e-5f);
+        }
+    }
+}
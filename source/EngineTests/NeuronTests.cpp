@@ -6,11 +6,13 @@
 #include "EngineInterface/SimulationController.h"
 #include "IntegrationTestFramework.h"
 
-class NeuronTests : public IntegrationTestFramework
+class NeuronTests
+    : public ::testing::WithParamInterface<SimulationBackend>
+    , public IntegrationTestFramework
 {
 public:
     NeuronTests()
-        : IntegrationTestFramework()
+        : IntegrationTestFramework(std::nullopt, IntVector2D{1000, 1000}, GetParam())
     {}
 
     ~NeuronTests() = default;
@@ -19,7 +21,9 @@ protected:
     float scaledSigmoid(float value) const { return 2.0f / (1.0f + std::exp(-value)) - 1.0f; }
 };
 
-TEST_F(NeuronTests, bias)
+INSTANTIATE_TEST_SUITE_P(Backends, NeuronTests, ::testing::ValuesIn(IntegrationTestFramework::getBackends()), IntegrationTestFramework::getBackendName);
+
+TEST_P(NeuronTests, bias)
 {
     NeuronDescription neuron;
     neuron.biases = {0, 0, 1, 0, 0, 0, 0, -1};
@@ -35,7 +39,7 @@ TEST_F(NeuronTests, bias)
     EXPECT_TRUE(approxCompare({0, 0, scaledSigmoid(1), 0, 0, 0, 0, scaledSigmoid(-1)}, actualCellById.at(1).activity.channels));
 }
 
-TEST_F(NeuronTests, weight)
+TEST_P(NeuronTests, weight)
 {
     NeuronDescription neuron;
     neuron.weights[2][3] = 1;
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/PreviewDescriptionConverter.h"
+
+class PreviewDescriptionConverterTests : public ::testing::Test
+{
+public:
+    virtual ~PreviewDescriptionConverterTests() = default;
+
+protected:
+    SimulationParameters _parameters;
+
+    GenomeDescription createGenome(std::vector<uint8_t> const& subGenome) const
+    {
+        auto rotatedConstructor = ConstructorGenomeDescription().setGenome(subGenome);
+        rotatedConstructor.constructionAngle2 = 30.0f;
+        return GenomeDescription().setCells({
+            CellGenomeDescription().setCellFunction(NeuronGenomeDescription()),
+            CellGenomeDescription().setCellFunction(rotatedConstructor),
+            CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)),
+            CellGenomeDescription(),
+        });
+    }
+
+    std::vector<uint8_t> createSubGenome(int numNodes) const
+    {
+        return GenomeDescriptionConverter::convertDescriptionToBytes(
+            GenomeDescription().setCells(std::vector<CellGenomeDescription>(numNodes, CellGenomeDescription().setCellFunction(SensorGenomeDescription()))));
+    }
+
+    //genome data is compared with the uncached preview of the decoded genome since angles are quantized in the byte representation
+    void checkCachedPreview(PreviewDescriptionCache& cache, std::vector<uint8_t> const& genomeData) const
+    {
+        auto expectedPreview =
+            PreviewDescriptionConverter::convert(GenomeDescriptionConverter::convertBytesToDescription(genomeData), std::nullopt, _parameters);
+        checkEqual(expectedPreview, cache.getPreview(genomeData, _parameters));
+    }
+
+    void checkEqual(PreviewDescription const& expected, PreviewDescription const& actual) const
+    {
+        ASSERT_EQ(expected.cells.size(), actual.cells.size());
+        for (int i = 0; i < toInt(expected.cells.size()); ++i) {
+            EXPECT_EQ(expected.cells.at(i).pos, actual.cells.at(i).pos);
+            EXPECT_EQ(expected.cells.at(i).nodeIndex, actual.cells.at(i).nodeIndex);
+            EXPECT_EQ(expected.cells.at(i).executionOrderNumber, actual.cells.at(i).executionOrderNumber);
+            EXPECT_EQ(expected.cells.at(i).color, actual.cells.at(i).color);
+        }
+        ASSERT_EQ(expected.connections.size(), actual.connections.size());
+        for (int i = 0; i < toInt(expected.connections.size()); ++i) {
+            EXPECT_EQ(expected.connections.at(i).cell1, actual.connections.at(i).cell1);
+            EXPECT_EQ(expected.connections.at(i).cell2, actual.connections.at(i).cell2);
+        }
+    }
+};
+
+TEST_F(PreviewDescriptionConverterTests, cachedPreview)
+{
+    auto genomeData = GenomeDescriptionConverter::convertDescriptionToBytes(createGenome(createSubGenome(5)));
+
+    PreviewDescriptionCache cache;
+    checkCachedPreview(cache, genomeData);
+    checkCachedPreview(cache, genomeData);
+    EXPECT_EQ(4 + 5 + 5, toInt(cache.getPreview(genomeData, _parameters).cells.size()));
+}
+
+TEST_F(PreviewDescriptionConverterTests, cachedPreviewAfterModification)
+{
+    PreviewDescriptionCache cache;
+    cache.getPreview(GenomeDescriptionConverter::convertDescriptionToBytes(createGenome(createSubGenome(5))), _parameters);
+
+    auto modifiedGenome = createGenome(createSubGenome(3));
+    modifiedGenome.cells.insert(modifiedGenome.cells.begin(), CellGenomeDescription().setColor(2));
+    checkCachedPreview(cache, GenomeDescriptionConverter::convertDescriptionToBytes(modifiedGenome));
+}
+
+TEST_F(PreviewDescriptionConverterTests, cachedPreviewAfterParameterChange)
+{
+    auto genomeData = GenomeDescriptionConverter::convertDescriptionToBytes(createGenome(createSubGenome(5)));
+    PreviewDescriptionCache cache;
+    cache.getPreview(genomeData, _parameters);
+
+    for (int i = 0; i < MAX_COLORS; ++i) {
+        _parameters.cellFunctionConstructorConnectingCellMaxDistance[i] = 3.0f;
+    }
+    checkCachedPreview(cache, genomeData);
+}
@@ -5,7 +5,9 @@
 #include "EngineInterface/SimulationController.h"
 #include "IntegrationTestFramework.h"
 
-class SensorTests : public IntegrationTestFramework
+class SensorTests
+    : public ::testing::WithParamInterface<SimulationBackend>
+    , public IntegrationTestFramework
 {
 public:
     static SimulationParameters getParameters()
@@ -19,13 +21,15 @@ public:
         return result;
     }
     SensorTests()
-        : IntegrationTestFramework(getParameters())
+        : IntegrationTestFramework(getParameters(), IntVector2D{1000, 1000}, GetParam())
     {}
 
     ~SensorTests() = default;
 };
 
-TEST_F(SensorTests, scanNeighborhood_noActivity)
+INSTANTIATE_TEST_SUITE_P(Backends, SensorTests, ::testing::ValuesIn(IntegrationTestFramework::getBackends()), IntegrationTestFramework::getBackendName);
+
+TEST_P(SensorTests, scanNeighborhood_noActivity)
 {
     DataDescription data;
     data.addCells(
@@ -55,7 +59,7 @@ TEST_F(SensorTests, scanNeighborhood_noActivity)
     EXPECT_TRUE(approxCompare(0.0f, actualAttackCell.activity.channels[0]));
 }
 
-TEST_F(SensorTests, scanNeighborhood_noOtherCell)
+TEST_P(SensorTests, scanNeighborhood_noOtherCell)
 {
     DataDescription data;
     data.addCells(
@@ -84,7 +88,7 @@ TEST_F(SensorTests, scanNeighborhood_noOtherCell)
     EXPECT_TRUE(approxCompare(0.0f, actualAttackCell.activity.channels[0]));
 }
 
-TEST_F(SensorTests, scanNeighborhood_densityTooLow)
+TEST_P(SensorTests, scanNeighborhood_densityTooLow)
 {
     DataDescription data;
     data.addCells(
@@ -94,7 +98,7 @@ TEST_F(SensorTests, scanNeighborhood_densityTooLow)
              .setMaxConnections(2)
              .setExecutionOrderNumber(0)
              .setInputExecutionOrderNumber(5)
-             .setCellFunction(SensorDescription()),
+             .setCellFunction(SensorDescription().setMinDensity(0.3f)),
          CellDescription()
              .setId(2)
              .setPos({101.0f, 100.0f})
@@ -115,7 +119,7 @@ TEST_F(SensorTests, scanNeighborhood_densityTooLow)
     EXPECT_TRUE(approxCompare(0.0f, actualAttackCell.activity.channels[0]));
 }
 
-TEST_F(SensorTests, scanNeighborhood_wrongColor)
+TEST_P(SensorTests, scanNeighborhood_wrongColor)
 {
     DataDescription data;
     data.addCells(
@@ -146,7 +150,7 @@ TEST_F(SensorTests, scanNeighborhood_wrongColor)
     EXPECT_TRUE(approxCompare(0.0f, actualAttackCell.activity.channels[0]));
 }
 
-TEST_F(SensorTests, scanNeighborhood_foundAtFront)
+TEST_P(SensorTests, scanNeighborhood_foundAtFront)
 {
     DataDescription data;
     data.addCells(
@@ -182,7 +186,7 @@ TEST_F(SensorTests, scanNeighborhood_foundAtFront)
     EXPECT_TRUE(actualAttackCell.activity.channels[3] < 15.0f / 365);
 }
 
-TEST_F(SensorTests, scanNeighborhood_foundAtRightHandSide)
+TEST_P(SensorTests, scanNeighborhood_foundAtRightHandSide)
 {
     DataDescription data;
     data.addCells(
@@ -218,7 +222,7 @@ TEST_F(SensorTests, scanNeighborhood_foundAtRightHandSide)
     EXPECT_TRUE(actualAttackCell.activity.channels[3] < 105.0f / 365);
 }
 
-TEST_F(SensorTests, scanNeighborhood_foundAtLeftHandSide)
+TEST_P(SensorTests, scanNeighborhood_foundAtLeftHandSide)
 {
     DataDescription data;
     data.addCells(
@@ -254,7 +258,7 @@ TEST_F(SensorTests, scanNeighborhood_foundAtLeftHandSide)
     EXPECT_TRUE(actualAttackCell.activity.channels[3] > -105.0f / 365);
 }
 
-TEST_F(SensorTests, scanNeighborhood_foundAtBack)
+TEST_P(SensorTests, scanNeighborhood_foundAtBack)
 {
     DataDescription data;
     data.addCells(
@@ -290,7 +294,7 @@ TEST_F(SensorTests, scanNeighborhood_foundAtBack)
 }
 
 
-TEST_F(SensorTests, scanNeighborhood_twoMasses)
+TEST_P(SensorTests, scanNeighborhood_twoMasses)
 {
     DataDescription data;
     data.addCells(
@@ -310,7 +314,7 @@ TEST_F(SensorTests, scanNeighborhood_twoMasses)
              .setActivity({1, 0, 0, 0, 0, 0, 0, 0})});
     data.addConnection(1, 2);
 
-    data.add(DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().center({100.0f, 10.0f}).width(16).height(16).cellDistance(0.8f)));
+    data.add(DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().center({100.0f, 9.5f}).width(16).height(16).cellDistance(0.8f)));
     data.add(DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().center({100.0f, 200.0f}).width(16).height(16).cellDistance(0.5f)));
 
     _simController->setSimulationData(data);
@@ -327,7 +331,7 @@ TEST_F(SensorTests, scanNeighborhood_twoMasses)
     EXPECT_TRUE(actualAttackCell.activity.channels[3] < 105.0f / 365);
 }
 
-TEST_F(SensorTests, scanByAngle_found)
+TEST_P(SensorTests, scanByAngle_found)
 {
     DataDescription data;
     data.addCells(
@@ -361,7 +365,7 @@ TEST_F(SensorTests, scanByAngle_found)
     EXPECT_TRUE(actualAttackCell.activity.channels[2] < 105.0f / 256);
 }
 
-TEST_F(SensorTests, scanByAngle_wrongAngle)
+TEST_P(SensorTests, scanByAngle_wrongAngle)
 {
     DataDescription data;
     data.addCells(
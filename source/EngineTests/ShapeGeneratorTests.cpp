@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/ShapeGenerator.h"
+
+class ShapeGeneratorTests : public ::testing::Test
+{
+public:
+    virtual ~ShapeGeneratorTests() = default;
+
+protected:
+    //expected values are taken from the former step-wise generator
+    bool checkSequence(ConstructionShape shape, std::vector<ShapeTableEntry> const& expectedEntries) const
+    {
+        auto shapeGenerator = ShapeGeneratorFactory::create(shape);
+        for (auto const& expectedEntry : expectedEntries) {
+            auto actualResult = shapeGenerator->generateNextConstructionData();
+            if (actualResult.angle != expectedEntry.angle || actualResult.numRequiredAdditionalConnections != expectedEntry.numRequiredAdditionalConnections) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(ShapeGeneratorTests, segment)
+{
+    EXPECT_TRUE(checkSequence(
+        ConstructionShape_Segment,
+        {{0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0},
+        {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0},
+        {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}}));
+}
+
+TEST_F(ShapeGeneratorTests, triangle)
+{
+    EXPECT_TRUE(checkSequence(
+        ConstructionShape_Triangle,
+        {{0.0f, 0}, {120.0f, 0}, {0.0f, 1}, {120.0f, 0}, {0.0f, 2}, {0.0f, 1}, {120.0f, 0}, {0.0f, 2},
+        {0.0f, 2}, {0.0f, 1}, {120.0f, 0}, {0.0f, 2}, {0.0f, 2}, {0.0f, 2}, {0.0f, 1}, {120.0f, 0},
+        {0.0f, 2}, {0.0f, 2}, {0.0f, 2}, {0.0f, 2}, {0.0f, 1}, {120.0f, 0}, {0.0f, 2}, {0.0f, 2}}));
+}
+
+TEST_F(ShapeGeneratorTests, rectangle)
+{
+    EXPECT_TRUE(checkSequence(
+        ConstructionShape_Rectangle,
+        {{0.0f, 0}, {90.0f, 0}, {90.0f, 0}, {0.0f, 1}, {90.0f, 0}, {0.0f, 1}, {90.0f, 0}, {0.0f, 1},
+        {0.0f, 1}, {90.0f, 0}, {0.0f, 1}, {0.0f, 1}, {90.0f, 0}, {0.0f, 1}, {0.0f, 1}, {0.0f, 1},
+        {90.0f, 0}, {0.0f, 1}, {0.0f, 1}, {0.0f, 1}, {90.0f, 0}, {0.0f, 1}, {0.0f, 1}, {0.0f, 1}}));
+}
+
+TEST_F(ShapeGeneratorTests, hexagon)
+{
+    EXPECT_TRUE(checkSequence(
+        ConstructionShape_Hexagon,
+        {{120.0f, 0}, {120.0f, 0}, {60.0f, 1}, {60.0f, 1}, {60.0f, 1}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1},
+        {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2},
+        {60.0f, 1}, {0.0f, 2}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {0.0f, 2}}));
+}
+
+TEST_F(ShapeGeneratorTests, loop)
+{
+    EXPECT_TRUE(checkSequence(
+        ConstructionShape_Loop,
+        {{60.0f, 0}, {60.0f, 0}, {60.0f, 0}, {60.0f, 0}, {60.0f, 0}, {0.0f, 1}, {60.0f, 1}, {60.0f, 1},
+        {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1},
+        {0.0f, 2}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {0.0f, 2}, {60.0f, 1}}));
+}
+
+TEST_F(ShapeGeneratorTests, tube)
+{
+    EXPECT_TRUE(checkSequence(
+        ConstructionShape_Tube,
+        {{0.0f, 2}, {60.0f, 0}, {120.0f, 0}, {0.0f, 2}, {-120.0f, 1}, {-60.0f, 1}, {0.0f, 2}, {60.0f, 1},
+        {120.0f, 0}, {0.0f, 2}, {-120.0f, 2}, {-60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {120.0f, 0}, {0.0f, 2},
+        {-120.0f, 2}, {-60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {120.0f, 0}, {0.0f, 2}, {-120.0f, 2}, {-60.0f, 1}}));
+}
+
+TEST_F(ShapeGeneratorTests, lolli)
+{
+    EXPECT_TRUE(checkSequence(
+        ConstructionShape_Lolli,
+        {{120.0f, 0}, {120.0f, 0}, {60.0f, 1}, {60.0f, 1}, {60.0f, 1}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1},
+        {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2}, {60.0f, 1}, {0.0f, 2},
+        {60.0f, 1}, {0.0f, 2}, {-60.0f, 2}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}}));
+}
+
+TEST_F(ShapeGeneratorTests, smallLolli)
+{
+    EXPECT_TRUE(checkSequence(
+        ConstructionShape_SmallLolli,
+        {{120.0f, 0}, {120.0f, 0}, {60.0f, 1}, {60.0f, 1}, {60.0f, 1}, {60.0f, 1}, {-60.0f, 2}, {0.0f, 0},
+        {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0},
+        {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}, {0.0f, 0}}));
+}
+
+TEST_F(ShapeGeneratorTests, angleAlignment)
+{
+    for (ConstructionShape shape = ConstructionShape_Segment; shape < ConstructionShape_Count; ++shape) {
+        auto expectedAlignment = shape == ConstructionShape_Rectangle ? ConstructorAngleAlignment_90 : ConstructorAngleAlignment_60;
+        EXPECT_EQ(expectedAlignment, ShapeGeneratorFactory::create(shape)->getConstructorAngleAlignment());
+    }
+}
+
+TEST_F(ShapeGeneratorTests, tableLookupBeyondTableSize)
+{
+    for (ConstructionShape shape = ConstructionShape_Segment; shape < ConstructionShape_Count; ++shape) {
+        auto shapeGenerator = ShapeGeneratorFactory::create(shape);
+        for (int nodeIndex = 0; nodeIndex < ShapeTables::NumEntries * 2; ++nodeIndex) {
+            auto expectedResult = shapeGenerator->generateNextConstructionData();
+            auto actualResult = ShapeTables::getConstructionData(shape, nodeIndex);
+            EXPECT_EQ(expectedResult.angle, actualResult.angle);
+            EXPECT_EQ(expectedResult.numRequiredAdditionalConnections, actualResult.numRequiredAdditionalConnections);
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "Base/NumberGenerator.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/SharedDataDescription.h"
+
+class SharedDataDescriptionTests : public ::testing::Test
+{
+public:
+    virtual ~SharedDataDescriptionTests() = default;
+
+protected:
+    DataDescription createData(int numCells) const
+    {
+        DataDescription result;
+        for (int i = 0; i < numCells; ++i) {
+            result.addCell(CellDescription().setId(NumberGenerator::getInstance().getId()).setPos({toFloat(i), 0}));
+        }
+        result.addParticle(ParticleDescription().setId(NumberGenerator::getInstance().getId()));
+        return result;
+    }
+};
+
+TEST_F(SharedDataDescriptionTests, conversion)
+{
+    auto data = createData(SharedDataDescription::BlockSize * 2 + 1);
+    SharedDataDescription sharedData(data);
+
+    EXPECT_EQ(toInt(data.cells.size()), sharedData.getNumCells());
+    EXPECT_EQ(toInt(data.particles.size()), sharedData.getNumParticles());
+    EXPECT_EQ(data.getCellIds(), sharedData.getCellIds());
+    EXPECT_EQ(data, sharedData.toDataDescription());
+}
+
+TEST_F(SharedDataDescriptionTests, copiesShareBlocks)
+{
+    SharedDataDescription sharedData(createData(SharedDataDescription::BlockSize * 2));
+    auto copy = sharedData;
+
+    EXPECT_EQ(&sharedData.getCell(0), &copy.getCell(0));
+    EXPECT_EQ(&sharedData.getCell(SharedDataDescription::BlockSize), &copy.getCell(SharedDataDescription::BlockSize));
+    EXPECT_EQ(&sharedData.getParticle(0), &copy.getParticle(0));
+}
+
+TEST_F(SharedDataDescriptionTests, modificationClonesOnlyAffectedBlock)
+{
+    SharedDataDescription sharedData(createData(SharedDataDescription::BlockSize * 2));
+    auto origData = sharedData.toDataDescription();
+    auto copy = sharedData;
+
+    copy.getCellRef(1).setEnergy(42.0f);
+
+    EXPECT_NE(&sharedData.getCell(0), &copy.getCell(0));
+    EXPECT_EQ(&sharedData.getCell(SharedDataDescription::BlockSize), &copy.getCell(SharedDataDescription::BlockSize));
+    EXPECT_EQ(42.0f, copy.getCell(1).energy);
+    EXPECT_EQ(origData, sharedData.toDataDescription());
+}
+
+TEST_F(SharedDataDescriptionTests, removeMetadata)
+{
+    auto data = createData(SharedDataDescription::BlockSize * 2);
+    data.cells.back().setMetadata(CellMetadataDescription().setName("test"));
+    SharedDataDescription sharedData(data);
+
+    auto copy = sharedData;
+    DescriptionHelper::removeMetadata(copy);
+
+    EXPECT_EQ(&sharedData.getCell(0), &copy.getCell(0));
+    EXPECT_TRUE(copy.getCell(copy.getNumCells() - 1).metadata.name.empty());
+    EXPECT_EQ("test", sharedData.getCell(sharedData.getNumCells() - 1).metadata.name);
+}
+
+TEST_F(SharedDataDescriptionTests, multiplicationKeepsTemplateShared)
+{
+    auto data = createData(SharedDataDescription::BlockSize * 2);
+    data.cells.front().setMetadata(CellMetadataDescription().setName("test"));
+    SharedDataDescription sharedData(data);
+    auto templateData = sharedData;
+
+    auto result = DescriptionHelper::gridMultiply(templateData, DescriptionHelper::GridMultiplyParameters().horizontalNumber(2).verticalNumber(3));
+
+    EXPECT_EQ(data.cells.size() * 6, result.cells.size());
+    EXPECT_EQ(&sharedData.getCell(0), &templateData.getCell(0));
+    EXPECT_EQ(&sharedData.getCell(SharedDataDescription::BlockSize), &templateData.getCell(SharedDataDescription::BlockSize));
+    EXPECT_EQ(data, templateData.toDataDescription());
+}
@@ -9,6 +9,8 @@
 
 #include "Base/StringHelper.h"
 #include "EngineInterface/SimulationController.h"
+#include "EngineInterface/GenomeCatalog.h"
+#include "EngineInterface/GenomeDecoderBase.h"
 #include "EngineInterface/GenomeDescriptionConverter.h"
 #include "EngineInterface/Colors.h"
 #include "EngineInterface/SimulationParameters.h"
@@ -99,6 +101,7 @@ void _GenomeEditorWindow::processIntern()
 {
     processToolbar();
     processEditor();
+    processGenomeCatalog();
 }
 
 void _GenomeEditorWindow::processToolbar()
@@ -113,6 +116,18 @@ void _GenomeEditorWindow::processToolbar()
     }
     AlienImGui::Tooltip("Open genome from file");
 
+    ImGui::SameLine();
+    if (AlienImGui::ToolbarButton(ICON_FA_BOOK)) {
+        onOpenGenomeCatalog();
+    }
+    AlienImGui::Tooltip("Open genome from catalog");
+
+    ImGui::SameLine();
+    if (AlienImGui::ToolbarButton(ICON_FA_FOLDER_PLUS)) {
+        onCreateGenomeCatalog();
+    }
+    AlienImGui::Tooltip("Create genome catalog from all genome files of a directory");
+
     ImGui::SameLine();
     if (AlienImGui::ToolbarButton(ICON_FA_SAVE)) {
         onSaveGenome();
@@ -771,6 +786,152 @@ void _GenomeEditorWindow::onOpenGenome()
     });
 }
 
+void _GenomeEditorWindow::onOpenGenomeCatalog()
+{
+    GenericFileDialogs::getInstance().showOpenFileDialog(
+        "Open genome catalog", "Genome catalog (*.genomes){.genomes},.*", _startingPath, [&](std::filesystem::path const& path) {
+            auto firstFilename = ifd::FileDialog::Instance().GetResult();
+            auto firstFilenameCopy = firstFilename;
+            _startingPath = firstFilenameCopy.remove_filename().string();
+
+            GenomeCatalogData catalog{.filename = firstFilename.string()};
+            if (!GenomeCatalog::deserializeIndexFromFile(catalog.entries, catalog.filename)) {
+                MessageDialog::getInstance().show("Open genome catalog", "The selected file could not be opened.");
+            } else {
+                _genomeCatalog = catalog;
+            }
+        });
+}
+
+void _GenomeEditorWindow::onCreateGenomeCatalog()
+{
+    GenericFileDialogs::getInstance().showOpenFileDialog("Select directory with genome files", "", _startingPath, [&](std::filesystem::path const& path) {
+        auto directory = ifd::FileDialog::Instance().GetResult();
+        if (!directory.has_filename()) {
+            directory = directory.parent_path();
+        }
+        _startingPath = directory.string();
+
+        //the catalog is placed next to the directory
+        GenomeCatalogData catalog{.filename = directory.string() + ".genomes"};
+        if (!GenomeCatalog::convertGenomeDirectoryToCatalog(catalog.filename, directory.string())
+            || !GenomeCatalog::deserializeIndexFromFile(catalog.entries, catalog.filename)) {
+            MessageDialog::getInstance().show("Create genome catalog", "The genome catalog could not be created.");
+        } else {
+            _genomeCatalog = catalog;
+        }
+    });
+}
+
+void _GenomeEditorWindow::processGenomeCatalog()
+{
+    if (!_genomeCatalog) {
+        return;
+    }
+    auto name = "Genome catalog";
+    ImGui::OpenPopup(name);
+    ImGui::SetNextWindowPos(ImGui::GetMainViewport()->GetCenter(), ImGuiCond_Appearing, ImVec2(0.5f, 0.5f));
+    if (ImGui::BeginPopupModal(name, NULL)) {
+        auto& catalog = *_genomeCatalog;
+        static ImGuiTableFlags flags = ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV
+            | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("##catalog", 5, flags, ImVec2(scale(600.0f), scale(300.0f)))) {
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Cells", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Cells incl. subgenomes", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Depth", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Bytes", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
+
+            ImGuiListClipper clipper;
+            clipper.Begin(toInt(catalog.entries.size()));
+            while (clipper.Step()) {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                    auto const& entry = catalog.entries.at(row);
+                    ImGui::PushID(row);
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    if (ImGui::Selectable(entry.name.c_str(), catalog.selectedEntry == row, ImGuiSelectableFlags_SpanAllColumns)) {
+                        catalog.selectedEntry = row;
+                    }
+                    ImGui::TableNextColumn();
+                    AlienImGui::Text(std::to_string(entry.numNodes));
+                    ImGui::TableNextColumn();
+                    AlienImGui::Text(std::to_string(entry.numNodesRecursively));
+                    ImGui::TableNextColumn();
+                    AlienImGui::Text(std::to_string(entry.depth));
+                    ImGui::TableNextColumn();
+                    AlienImGui::Text(std::to_string(entry.numBytes));
+                    ImGui::PopID();
+                }
+            }
+            ImGui::EndTable();
+        }
+
+        AlienImGui::InputText(AlienImGui::InputTextParameters().hint("Name of the current genome").textWidth(150), catalog.nameOfGenomeToAdd);
+        ImGui::SameLine();
+        ImGui::BeginDisabled(catalog.nameOfGenomeToAdd.empty());
+        if (AlienImGui::Button("Add current genome")) {
+            onAddCurrentGenomeToCatalog();
+        }
+        ImGui::EndDisabled();
+
+        AlienImGui::Separator();
+
+        auto close = false;
+        ImGui::BeginDisabled(!catalog.selectedEntry);
+        if (AlienImGui::Button("Open")) {
+            if (auto genome = loadSelectedCatalogGenome()) {
+                openTab(GenomeDescriptionConverter::convertBytesToDescription(*genome));
+                close = true;
+            }
+        }
+        ImGui::SameLine();
+        if (AlienImGui::Button("Create spore")) {
+            if (auto genome = loadSelectedCatalogGenome()) {
+                createSpore(*genome);
+            }
+        }
+        ImGui::EndDisabled();
+
+
+        ImGui::SameLine();
+        if (AlienImGui::Button("Close")) {
+            close = true;
+        }
+        if (close) {
+            ImGui::CloseCurrentPopup();
+            _genomeCatalog.reset();
+        }
+        ImGui::EndPopup();
+    }
+}
+
+std::optional<std::vector<uint8_t>> _GenomeEditorWindow::loadSelectedCatalogGenome() const
+{
+    auto const& catalog = *_genomeCatalog;
+    std::vector<uint8_t> result;
+    if (!GenomeCatalog::deserializeGenomeFromFile(result, catalog.filename, catalog.entries.at(*catalog.selectedEntry))) {
+        MessageDialog::getInstance().show("Genome catalog", "The selected genome could not be read.");
+        return std::nullopt;
+    }
+    return result;
+}
+
+void _GenomeEditorWindow::onAddCurrentGenomeToCatalog()
+{
+    auto& catalog = *_genomeCatalog;
+    auto const& selectedTab = _tabDatas.at(_selectedTabIndex);
+    NamedGenome genome{.name = catalog.nameOfGenomeToAdd, .genome = GenomeDescriptionConverter::convertDescriptionToBytes(selectedTab.genome)};
+    if (!GenomeCatalog::appendGenomeToCatalog(catalog.filename, genome) || !GenomeCatalog::deserializeIndexFromFile(catalog.entries, catalog.filename)) {
+        MessageDialog::getInstance().show("Genome catalog", "The genome could not be added to the catalog.");
+        return;
+    }
+    catalog.selectedEntry = toInt(catalog.entries.size()) - 1;
+    catalog.nameOfGenomeToAdd.clear();
+}
+
 void _GenomeEditorWindow::onSaveGenome()
 {
     GenericFileDialogs::getInstance().showSaveFileDialog(
@@ -846,18 +1007,22 @@ void _GenomeEditorWindow::onNodeIncreaseSequenceNumber()
 }
 
 void _GenomeEditorWindow::onCreateSpore()
+{
+    createSpore(GenomeDescriptionConverter::convertDescriptionToBytes(getCurrentGenome()));
+}
+
+void _GenomeEditorWindow::createSpore(std::vector<uint8_t> const& genome)
 {
     auto pos = _viewport->getCenterInWorldPos();
     pos.x += (toFloat(std::rand()) / RAND_MAX - 0.5f) * 8;
     pos.y += (toFloat(std::rand()) / RAND_MAX - 0.5f) * 8;
 
-    auto genomeDesc = getCurrentGenome();
-    auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(genomeDesc);
+    auto numNodes = GenomeDecoderBase::getNumNodes(genome.data(), toInt(genome.size()));
 
     auto parameter = _simController->getSimulationParameters();
     auto cell = CellDescription()
                     .setPos(pos)
-                    .setEnergy(parameter.cellNormalEnergy[_editorModel->getDefaultColorCode()] * (genomeDesc.cells.size() * 2 + 1))
+                    .setEnergy(parameter.cellNormalEnergy[_editorModel->getDefaultColorCode()] * (numNodes * 2 + 1))
                     .setStiffness(1.0f)
                     .setMaxConnections(6)
                     .setExecutionOrderNumber(0)
@@ -872,8 +1037,11 @@ void _GenomeEditorWindow::onCreateSpore()
 
 void _GenomeEditorWindow::showPreview(TabData& tab)
 {
-    auto const& genome = _tabDatas.at(_selectedTabIndex).genome;
-    auto preview = PreviewDescriptionConverter::convert(genome, tab.selectedNode, _simController->getSimulationParameters());
+    if (tab.previewedGenome != tab.genome) {
+        tab.previewedGenome = tab.genome;
+        tab.previewedGenomeBytes = GenomeDescriptionConverter::convertDescriptionToBytes(tab.genome);
+    }
+    auto const& preview = _previewCache.getPreview(tab.previewedGenomeBytes, _simController->getSimulationParameters());
     if (AlienImGui::ShowPreviewDescription(preview, _previewZoom, tab.selectedNode)) {
         _nodeIndexToJump = tab.selectedNode;
     }
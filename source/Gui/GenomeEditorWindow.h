@@ -1,7 +1,9 @@
 #pragma once
 
+#include "EngineInterface/GenomeCatalog.h"
 #include "EngineInterface/GenomeDescriptions.h"
 #include "EngineInterface/PreviewDescriptions.h"
+#include "EngineInterface/PreviewDescriptionConverter.h"
 
 #include "AlienWindow.h"
 #include "Definitions.h"
@@ -25,6 +27,10 @@ private:
         int id;
         GenomeDescription genome;
         std::optional<int> selectedNode;
+
+        //the genome is only encoded again for the preview after it has been edited
+        std::optional<GenomeDescription> previewedGenome;
+        std::vector<uint8_t> previewedGenomeBytes;
     };
     void processTab(TabData& tab);
     void processGenomeHeader(TabData& tab);
@@ -34,12 +40,18 @@ private:
     void processSubGenomeWidgets(TabData const& tab, Description& desc);
 
     void onOpenGenome();
+    void onOpenGenomeCatalog();
+    void onCreateGenomeCatalog();
+    void processGenomeCatalog();
+    std::optional<std::vector<uint8_t>> loadSelectedCatalogGenome() const;
+    void onAddCurrentGenomeToCatalog();
     void onSaveGenome();
     void onAddNode();
     void onDeleteNode();
     void onNodeDecreaseSequenceNumber();
     void onNodeIncreaseSequenceNumber();
     void onCreateSpore();
+    void createSpore(std::vector<uint8_t> const& genome);
 
     void showPreview(TabData& tab);
 
@@ -62,9 +74,19 @@ private:
     int _selectedInput = 0;
     int _selectedOutput = 0;
     float _previewZoom = 30.0f;
+    PreviewDescriptionCache _previewCache;
     std::optional<std::vector<uint8_t>> _copiedGenome;
     std::string _startingPath;
 
+    struct GenomeCatalogData
+    {
+        std::string filename;
+        std::vector<GenomeCatalogEntry> entries;
+        std::optional<int> selectedEntry;
+        std::string nameOfGenomeToAdd;
+    };
+    std::optional<GenomeCatalogData> _genomeCatalog;
+
     //actions
     std::optional<int> _tabIndexToSelect;
     std::optional<int> _nodeIndexToJump;
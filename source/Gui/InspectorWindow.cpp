@@ -362,8 +362,7 @@ void _InspectorWindow::processCellGenomeTab(Description& desc)
 
             if (ImGui::TreeNodeEx("Data", TreeNodeFlags)) {
                 if (ImGui::BeginChild("##child", ImVec2(0, scale(200)), true, ImGuiWindowFlags_HorizontalScrollbar)) {
-                    auto genomDesc = GenomeDescriptionConverter::convertBytesToDescription(desc.genome);
-                    auto previewDesc = PreviewDescriptionConverter::convert(genomDesc, std::nullopt, parameters);
+                    auto const& previewDesc = _genomePreviewCache.getPreview(desc.genome, parameters);
                     std::optional<int> selectedNodeDummy;
                     AlienImGui::ShowPreviewDescription(previewDesc, _genomeZoom, selectedNodeDummy);
                 }
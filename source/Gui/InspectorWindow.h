@@ -2,6 +2,7 @@
 
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/PreviewDescriptionConverter.h"
 #include "Definitions.h"
 
 struct MemoryEditor;
@@ -68,5 +69,6 @@ private:
     int _selectedInput = 0;
     int _selectedOutput = 0;
     float _genomeZoom = 20.0f;
+    PreviewDescriptionCache _genomePreviewCache;
     bool _selectGenomeTab = false;
 };
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <string>
 
 #include "Base/LoggingService.h"
 #include "EngineInterface/Serializer.h"
@@ -9,8 +10,16 @@
 #include "SimpleLogger.h"
 #include "FileLogger.h"
 
-int main(int, char**)
+int main(int argc, char** argv)
 {
+    //the cpu backend can be selected for systems without a suitable CUDA device, builds without the CUDA toolkit always use it
+    SimulationBackend backend = DefaultSimulationBackend;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "-cpu") {
+            backend = SimulationBackend_Cpu;
+        }
+    }
+
     SimpleLogger logger = std::make_shared<_SimpleLogger>();
     FileLogger fileLogger = std::make_shared<_FileLogger>();
 
@@ -18,7 +27,12 @@ int main(int, char**)
     MainWindow mainWindow;
 
     try {
-        simController = std::make_shared<_SimulationControllerImpl>();
+        if (backend == SimulationBackend_Cpu) {
+            log(Priority::Important,
+                "The CPU backend is used. It does not simulate constructors, the other cell functions besides neurons, nerves and sensors, spots "
+                "and rendering yet.");
+        }
+        simController = std::make_shared<_SimulationControllerImpl>(backend);
         mainWindow = std::make_shared<_MainWindow>(simController, logger);
 
         simController->initCuda();
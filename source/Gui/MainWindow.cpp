@@ -21,6 +21,7 @@
 #include "implot.h"
 #include "Fonts/IconsFontAwesome5.h"
 
+#include "EngineInterface/GenomeOptimizer.h"
 #include "EngineInterface/Serializer.h"
 #include "EngineInterface/SimulationController.h"
 
@@ -71,6 +72,7 @@
 #include "RadiationSourcesWindow.h"
 #include "OverlayMessageController.h"
 #include "BalancerController.h"
+#include "GlobalSettings.h"
 #include "ExitDialog.h"
 
 namespace
@@ -185,6 +187,8 @@ _MainWindow::_MainWindow(SimulationController const& simController, SimpleLogger
         glDeleteTextures(1, &texID);
     };
 
+    _optimizeGenomesOnLoad = GlobalSettings::getInstance().getBoolState("settings.optimize genomes on load", false);
+
     _window = windowData.window;
 }
 
@@ -226,6 +230,7 @@ void _MainWindow::shutdown()
 {
     WindowController::getInstance().shutdown();
     _autosaveController->shutdown();
+    GlobalSettings::getInstance().setBoolState("settings.optimize genomes on load", _optimizeGenomesOnLoad);
 
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
@@ -549,6 +554,9 @@ void _MainWindow::processMenubar()
             if (ImGui::MenuItem("Network settings", "ALT+K")) {
                 _networkSettingsDialog->open();
             }
+            if (ImGui::MenuItem("Optimize genomes on load", "", _optimizeGenomesOnLoad)) {
+                _optimizeGenomesOnLoad = !_optimizeGenomesOnLoad;
+            }
             AlienImGui::EndMenuButton();
         }
 
@@ -760,6 +768,9 @@ void _MainWindow::onOpenSimulation()
 
             DeserializedSimulation deserializedData;
             if (Serializer::deserializeSimulationFromFiles(deserializedData, firstFilename.string())) {
+                if (_optimizeGenomesOnLoad) {
+                    GenomeOptimizer::optimize(deserializedData.mainData);
+                }
                 printOverlayMessage("Loading ...");
                 delayedExecution([=, this] {
                     _simController->closeSimulation();
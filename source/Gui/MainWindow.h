@@ -87,6 +87,7 @@ private:
     bool _toolsMenuToggled = false;
     bool _helpMenuToggled = false;
     bool _renderSimulation = true;
+    bool _optimizeGenomesOnLoad = false;
 
     std::string _startingPath;
 };
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "EngineInterface/Colors.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/GenomeOptimizer.h"
 #include "EngineInterface/SimulationController.h"
 
 #include "AlienImGui.h"
@@ -90,6 +91,11 @@ void _MassOperationsDialog::process()
         AlienImGui::InputInt(AlienImGui::InputIntParameters().name("Maximum age").textWidth(RightColumnWidth), _maxAge);
         ImGui::EndDisabled();
 
+        AlienImGui::Group("Genomes");
+        ImGui::Checkbox("##optimizeGenomes", &_optimizeGenomes);
+        ImGui::SameLine(0, ImGui::GetStyle().FramePadding.x * 4);
+        AlienImGui::Text("Validate and compact genomes");
+
         AlienImGui::Group("Options");
         ImGui::Checkbox("##restrictToSelectedClusters", &_restrictToSelectedClusters);
         ImGui::SameLine(0, ImGui::GetStyle().FramePadding.x * 4);
@@ -169,6 +175,9 @@ void _MassOperationsDialog::onExecute()
     if (_randomizeAges) {
         DescriptionHelper::randomizeAges(content, _minAge, _maxAge);
     }
+    if (_optimizeGenomes) {
+        GenomeOptimizer::optimize(content);
+    }
 
     if (_restrictToSelectedClusters) {
         _simController->removeSelectedObjects(true);
@@ -182,24 +191,22 @@ void _MassOperationsDialog::onExecute()
 
 bool _MassOperationsDialog::isOkEnabled()
 {
-    bool result = false;
-    if (_randomizeCellColors) {
-        for (bool checkColor : _checkedCellColors) {
-            result |= checkColor;
-        }
-    }
-    if (_randomizeGenomeColors) {
-        for (bool checkColor : _checkedGenomeColors) {
-            result |= checkColor;
+    //a color randomization without any checked color cannot be executed
+    auto isAnyColorChecked = [](bool* colors) {
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            if (colors[i]) {
+                return true;
+            }
         }
+        return false;
+    };
+    if (_randomizeCellColors && !isAnyColorChecked(_checkedCellColors)) {
+        return false;
     }
-    if (_randomizeEnergies) {
-        result = true;
-    }
-    if (_randomizeAges) {
-        result = true;
+    if (_randomizeGenomeColors && !isAnyColorChecked(_checkedGenomeColors)) {
+        return false;
     }
-    return result;
+    return _randomizeCellColors || _randomizeGenomeColors || _randomizeEnergies || _randomizeAges || _optimizeGenomes;
 }
 
 void _MassOperationsDialog::validationAndCorrection()
@@ -38,5 +38,7 @@ private:
     int _minAge = 0;
     int _maxAge = 0;
 
+    bool _optimizeGenomes = false;
+
     bool _restrictToSelectedClusters = false;
 };
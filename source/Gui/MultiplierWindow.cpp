@@ -151,7 +151,7 @@ void _MultiplierWindow::validationAndCorrection()
 
 void _MultiplierWindow::onBuild()
 {
-    _origSelection = _simController->getSelectedSimulationData(true);
+    _origSelection = SharedDataDescription(_simController->getSelectedSimulationData(true));
     auto multiplicationResult = [&] {
         if (_mode == MultiplierMode::Grid) {
             return DescriptionHelper::gridMultiply(_origSelection, _gridParameters);
@@ -176,7 +176,7 @@ void _MultiplierWindow::onBuild()
 void _MultiplierWindow::onUndo()
 {
     _simController->removeSelectedObjects(true);
-    _simController->addAndSelectSimulationData(_origSelection);
+    _simController->addAndSelectSimulationData(_origSelection.toDataDescription());
     _selectionDataAfterMultiplication = std::nullopt;
 }
 
@@ -2,6 +2,7 @@
 
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/SharedDataDescription.h"
 #include "EngineInterface/SelectionShallowData.h"
 
 #include "Definitions.h"
@@ -37,6 +38,6 @@ private:
     DescriptionHelper::GridMultiplyParameters _gridParameters;
     DescriptionHelper::RandomMultiplyParameters _randomParameters;
 
-    DataDescription _origSelection;
+    SharedDataDescription _origSelection;
     std::optional<SelectionShallowData> _selectionDataAfterMultiplication;
 };
\ No newline at end of file
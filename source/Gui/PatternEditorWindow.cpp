@@ -373,7 +373,7 @@ bool _PatternEditorWindow::isCopyingPossible() const
 
 void _PatternEditorWindow::onCopy()
 {
-    _copiedSelection = _simController->getSelectedSimulationData(_editorModel->isRolloutToClusters());
+    _copiedSelection = SharedDataDescription(_simController->getSelectedSimulationData(_editorModel->isRolloutToClusters()));
 }
 
 bool _PatternEditorWindow::isPastingPossible() const
@@ -383,7 +383,7 @@ bool _PatternEditorWindow::isPastingPossible() const
 
 void _PatternEditorWindow::onPaste()
 {
-    auto data = *_copiedSelection;
+    auto data = _copiedSelection->toDataDescription();
     auto center = _viewport->getCenterInWorldPos();
     data.setCenter(center);
     DescriptionHelper::generateNewCreatureIds(data);
@@ -404,9 +404,9 @@ void _PatternEditorWindow::onDelete()
 
 void _PatternEditorWindow::onGenerateExecutionOrderNumbers()
 {
+    //only the ids are needed from the selection without clusters, so its data is released before fetching the clusters
+    auto cellIds = _simController->getSelectedSimulationData(false).getCellIds();
     auto dataWithClusters = _simController->getSelectedSimulationData(true);
-    auto dataWithoutClusters = _simController->getSelectedSimulationData(false);
-    std::unordered_set<uint64_t> cellIds = dataWithoutClusters.getCellIds();
 
     auto parameters = _simController->getSimulationParameters();
     DescriptionHelper::generateExecutionOrderNumbers(dataWithClusters, cellIds, parameters.cellNumExecutionOrderNumbers);
@@ -3,6 +3,7 @@
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/SelectionShallowData.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SharedDataDescription.h"
 #include "Definitions.h"
 #include "AlienWindow.h"
 
@@ -47,5 +48,5 @@ private:
     float _angle = 0;
     float _angularVel = 0;
     std::optional<SelectionShallowData> _lastSelection;
-    std::optional<DataDescription> _copiedSelection;
+    std::optional<SharedDataDescription> _copiedSelection;
 };
\ No newline at end of file
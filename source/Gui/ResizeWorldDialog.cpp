@@ -84,7 +84,7 @@ void _ResizeWorldDialog::onResizing()
 
     _simController->newSimulation(timestep, generalSettings, parameters);
 
-    DescriptionHelper::correctConnections(content, {_width, _height});
+    DescriptionHelper::correctConnections(content, {_width, _height}, parameters.cellMaxBindingDistance);
     if (_scaleContent) {
         DescriptionHelper::duplicate(content, origWorldSize, {_width, _height});
     }